@@ -0,0 +1,327 @@
+#!/bin/sh
+"exec" "python3" "-u" "-B" "$0" "$@"
+##############################################################################
+# Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+# other Serac Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (BSD-3-Clause)
+##############################################################################
+
+import argparse
+import glob
+import json
+import os
+import shutil
+import subprocess
+import sys
+
+
+# This script runs Serac's benchmark executables with fixed problem sizes,
+# collects the Caliper profile (.cali file) written by each of them, and
+# compares the time spent in each annotated region against a stored baseline.
+#
+# A region has regressed if it takes more than (1 + tolerance) times as long
+# as it did in the baseline. The script exits unsuccessfully if any region
+# has regressed or the baseline is missing (unless --allow-missing-baseline
+# is given), and successfully otherwise.
+#
+# Reading .cali files requires Caliper's cali-query tool, everything else is
+# done locally with the Python standard library.
+
+# Caliper metrics that hold the inclusive time spent in a region, in order of preference.
+# The "spot" profile written by serac::profiling aggregates these across MPI ranks, and
+# the slowest rank determines the runtime. Times are never summed across ranks.
+TIME_METRICS = ["max#inclusive#sum#time.duration",
+                "avg#inclusive#sum#time.duration",
+                "inclusive#sum#time.duration",
+                "sum#time.duration"]
+
+# Caliper global attribute holding the git SHA of the build (set in serac::profiling::initialize)
+GIT_SHA_ATTRIBUTE = "serac_git_sha"
+
+
+def parse_args():
+    usage = """
+Run Serac's benchmarks and compare their Caliper profiles against a baseline.
+
+Example usages:
+    # run the benchmarks, and save the results as the new baseline
+    performance_regression.py run --bin-dir build/benchmarks --config performance_regression.json
+                                  --output-dir build/performance/latest --update-baseline build/performance/baseline.json
+
+    # run the benchmarks, and compare the results against the baseline
+    performance_regression.py run --bin-dir build/benchmarks --config performance_regression.json
+                                  --output-dir build/performance/latest --baseline build/performance/baseline.json
+
+    # compare two previously collected sets of results
+    performance_regression.py compare --baseline baseline.json --test build/performance/latest/profile.json
+
+Example usage for --tolerance:
+    --tolerance=0.1 // allow every region to be up to 10% slower than the baseline
+
+Example JSON file for --tolerance-file:
+    {
+        \"default\": 0.1,                                // used for all non-specified regions
+        \"benchmark_functional/vector H1\": 0.25,        // a region of a specific benchmark
+        \"assemble gradient\": 0.2                       // a region in any benchmark
+    }
+"""
+
+    parser = argparse.ArgumentParser(description=usage,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = subparsers.add_parser("run", help="Run the benchmarks, then compare against a baseline")
+    run_parser.add_argument("--bin-dir", type=str, required=True,
+                            help="Directory containing the benchmark executables")
+    run_parser.add_argument("--config", type=str, required=True,
+                            help="JSON file listing the benchmarks to run, with their arguments")
+    run_parser.add_argument("--output-dir", type=str, required=True,
+                            help="Directory to write the .cali files and the profile summary to")
+    run_parser.add_argument("--cali-query", type=str, default="cali-query",
+                            help="Path to Caliper's cali-query executable")
+    run_parser.add_argument("--mpiexec", type=str, default="",
+                            help="MPI launcher used to run the benchmarks (e.g. mpirun)")
+    run_parser.add_argument("--mpiexec-numproc-flag", type=str, default="-n",
+                            help="MPI launcher flag for the number of ranks")
+    run_parser.add_argument("--update-baseline", type=str,
+                            help="Save the results as the new baseline, instead of comparing against it")
+    run_parser.add_argument("--allow-missing-baseline", action="store_true",
+                            help="Succeed without comparing if the baseline does not exist (e.g. on a first run)")
+
+    compare_parser = subparsers.add_parser("compare", help="Compare two profile summaries")
+    compare_parser.add_argument("--test", type=str, required=True,
+                                help="Path to the test profile summary")
+
+    for subparser in [run_parser, compare_parser]:
+        subparser.add_argument("--baseline", type=str,
+                               help="Path to the baseline profile summary")
+        subparser.add_argument("--tolerance", type=float, default=0.1,
+                               help="Allowed relative slowdown of each region (default: 0.1)")
+        subparser.add_argument("--tolerance-file", type=str,
+                               help="JSON file specifying the allowed relative slowdown of specific regions")
+        subparser.add_argument("--min-time", type=float, default=1.0e-3,
+                               help="Regions faster than this (in seconds) in the baseline are not compared")
+
+    args = parser.parse_args()
+
+    if args.command == "compare" and args.baseline is None:
+        parser.error("compare requires --baseline")
+
+    return args
+
+
+# Check if file exists and error out if not found
+def ensure_file(path):
+    if not os.path.isfile(path):
+        print("ERROR: Given file does not exist: {0}".format(path))
+        sys.exit(1)
+
+
+# Run cali-query on a .cali file and return the resulting JSON records
+def cali_query(cali_query_exe, cali_file, extra_args=[]):
+    command = [cali_query_exe] + extra_args + ["-j", cali_file]
+    try:
+        result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                                universal_newlines=True, check=True)
+    except (OSError, subprocess.CalledProcessError) as e:
+        print("ERROR: Could not read Caliper file '{0}' with '{1}': {2}".format(cali_file, cali_query_exe, e))
+        sys.exit(1)
+
+    return json.loads(result.stdout) if result.stdout.strip() else []
+
+
+# Read the inclusive time spent in each region (keyed by its path) from a .cali file
+#
+# A spot profile holds one record per region, already aggregated across ranks. Other profiles
+# may hold one record per rank (or per flush) for the same region; those are not added up,
+# the largest one is taken instead, consistent with the slowest rank determining the runtime.
+def read_region_times(cali_query_exe, cali_file):
+    records = [record for record in cali_query(cali_query_exe, cali_file) if record.get("path") is not None]
+
+    # use the same metric for every region, so their times are comparable
+    metric = next((m for m in TIME_METRICS if any(m in record for record in records)), None)
+    if metric is None:
+        print("ERROR: Caliper file '{0}' has none of the time metrics {1}".format(cali_file, TIME_METRICS))
+        sys.exit(1)
+
+    regions = {}
+    for record in records:
+        if metric not in record:
+            continue
+
+        path = record["path"]
+        if isinstance(path, list):
+            path = "/".join(path)
+
+        regions[path] = max(regions.get(path, 0.0), float(record[metric]))
+
+    return regions
+
+
+# Read the git SHA recorded in a .cali file, if there is one
+def read_git_sha(cali_query_exe, cali_file):
+    for record in cali_query(cali_query_exe, cali_file, ["-G"]):
+        if GIT_SHA_ATTRIBUTE in record:
+            return record[GIT_SHA_ATTRIBUTE]
+    return "unknown"
+
+
+# Run one benchmark in its own directory and return the path to the Caliper profile it wrote
+def run_benchmark(benchmark, args):
+    name = benchmark["name"]
+    work_dir = os.path.join(args.output_dir, name)
+    shutil.rmtree(work_dir, ignore_errors=True)
+    os.makedirs(work_dir)
+
+    executable = os.path.abspath(os.path.join(args.bin_dir, name))
+    ensure_file(executable)
+
+    command = []
+    if args.mpiexec:
+        command += [args.mpiexec, args.mpiexec_numproc_flag, str(benchmark.get("ranks", 1))]
+    command += [executable] + benchmark.get("args", [])
+
+    print("Running: {0}".format(" ".join(command)))
+    with open(os.path.join(work_dir, "output.log"), "w") as log:
+        result = subprocess.run(command, cwd=work_dir, stdout=log, stderr=subprocess.STDOUT)
+    if result.returncode != 0:
+        print("ERROR: Benchmark '{0}' failed, see {1}".format(name, os.path.join(work_dir, "output.log")))
+        sys.exit(1)
+
+    cali_files = glob.glob(os.path.join(work_dir, "*.cali"))
+    if len(cali_files) != 1:
+        print("ERROR: Expected benchmark '{0}' to write one .cali file, found {1}".format(name, len(cali_files)))
+        sys.exit(1)
+
+    cali_file = os.path.join(args.output_dir, name + ".cali")
+    shutil.move(cali_files[0], cali_file)
+    return cali_file
+
+
+# Run every benchmark in the configuration file, and write the profile summary
+def run_benchmarks(args):
+    ensure_file(args.config)
+    with open(args.config) as config_file:
+        config = json.load(config_file)
+
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    summary = {"git_sha": "unknown", "benchmarks": {}}
+    for benchmark in config["benchmarks"]:
+        cali_file = run_benchmark(benchmark, args)
+        summary["git_sha"] = read_git_sha(args.cali_query, cali_file)
+        summary["benchmarks"][benchmark["name"]] = {
+            "cali_file": os.path.abspath(cali_file),
+            "regions": read_region_times(args.cali_query, cali_file)
+        }
+
+    summary_file = os.path.join(args.output_dir, "profile.json")
+    with open(summary_file, "w") as output:
+        json.dump(summary, output, indent=2, sort_keys=True)
+    print("Wrote profile summary: {0}".format(summary_file))
+
+    return summary
+
+
+# Look up the tolerance for a region, from most to least specific
+def get_tolerance(tolerance_dict, benchmark_name, region):
+    for key in ["{0}/{1}".format(benchmark_name, region), region, "default"]:
+        if key in tolerance_dict:
+            return tolerance_dict[key]
+
+
+# Compare the region timings of two profile summaries, and return True if none have regressed
+def compare(baseline, test, tolerance_dict, min_time):
+    print("Baseline git SHA: {0}".format(baseline.get("git_sha", "unknown")))
+    print("Test git SHA:     {0}".format(test.get("git_sha", "unknown")))
+
+    regressions = []
+    for benchmark_name, baseline_benchmark in sorted(baseline["benchmarks"].items()):
+        if benchmark_name not in test["benchmarks"]:
+            print("WARNING: Benchmark '{0}' is missing from the test results".format(benchmark_name))
+            continue
+
+        test_regions = test["benchmarks"][benchmark_name]["regions"]
+
+        print("")
+        print("{0}:".format(benchmark_name))
+        print("  {0:<60} {1:>12} {2:>12} {3:>9}".format("region", "baseline (s)", "test (s)", "change"))
+        for region, baseline_time in sorted(baseline_benchmark["regions"].items()):
+            if region not in test_regions:
+                print("  WARNING: Region '{0}' is missing from the test results".format(region))
+                continue
+
+            test_time = test_regions[region]
+            change = (test_time - baseline_time) / baseline_time if baseline_time > 0 else 0.0
+
+            status = ""
+            if baseline_time >= min_time and change > get_tolerance(tolerance_dict, benchmark_name, region):
+                status = "  <-- REGRESSION"
+                regressions.append("{0}/{1}".format(benchmark_name, region))
+
+            print("  {0:<60} {1:>12.4e} {2:>12.4e} {3:>+8.1f}%{4}"
+                  .format(region, baseline_time, test_time, 100.0 * change, status))
+
+    print("")
+    if regressions:
+        print("ERROR: {0} region(s) regressed:".format(len(regressions)))
+        for region in regressions:
+            print("       {0}".format(region))
+        return False
+
+    print("Success: No regions regressed")
+    return True
+
+
+def main():
+    args = parse_args()
+
+    # Create a tolerance dictionary
+    if args.tolerance_file is not None:
+        ensure_file(args.tolerance_file)
+        with open(args.tolerance_file) as tolerance_file:
+            tolerance_dict = json.load(tolerance_file)
+        tolerance_dict.setdefault("default", args.tolerance)
+    else:
+        tolerance_dict = {"default": args.tolerance}
+
+    if args.command == "run":
+        test = run_benchmarks(args)
+
+        if args.update_baseline is not None:
+            os.makedirs(os.path.dirname(os.path.abspath(args.update_baseline)), exist_ok=True)
+            with open(args.update_baseline, "w") as output:
+                json.dump(test, output, indent=2, sort_keys=True)
+            print("Updated baseline: {0}".format(args.update_baseline))
+            return
+
+        if args.baseline is None or not os.path.isfile(args.baseline):
+            if args.baseline is None:
+                message = "No baseline given"
+            else:
+                message = "Baseline '{0}' does not exist".format(args.baseline)
+
+            if args.allow_missing_baseline:
+                print("WARNING: {0}, skipping comparison".format(message))
+                return
+
+            print("ERROR: {0}. Use --update-baseline to create it, or --allow-missing-baseline "
+                  "to skip the comparison.".format(message))
+            sys.exit(1)
+    else:
+        ensure_file(args.test)
+        with open(args.test) as test_file:
+            test = json.load(test_file)
+
+    ensure_file(args.baseline)
+    with open(args.baseline) as baseline_file:
+        baseline = json.load(baseline_file)
+
+    if not compare(baseline, test, tolerance_dict, args.min_time):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
+    sys.exit(0)
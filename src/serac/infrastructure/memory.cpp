@@ -0,0 +1,228 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/infrastructure/memory.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+
+#include <sys/resource.h>
+
+#include "axom/fmt.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac {
+
+namespace {
+
+/// @brief the bytes recorded by TrackedAllocations on this rank, for each category
+std::array<std::size_t, num_memory_categories> tracked_bytes{};
+
+/// @brief guards `tracked_bytes`
+std::mutex tracked_bytes_mutex;
+
+void track(MemoryCategory category, std::size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(tracked_bytes_mutex);
+  tracked_bytes[static_cast<std::size_t>(category)] += bytes;
+}
+
+void untrack(MemoryCategory category, std::size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(tracked_bytes_mutex);
+  tracked_bytes[static_cast<std::size_t>(category)] -= bytes;
+}
+
+/**
+ * @brief an MPI reduction of arrays of doubles laid out as [values, -values, values], which computes
+ * the maxima of the first two thirds (i.e. the maxima and the negated minima) and the sums of the last third
+ */
+void maxMaxSum(void* in, void* inout, int* length, MPI_Datatype*)
+{
+  auto* a = static_cast<double*>(in);
+  auto* b = static_cast<double*>(inout);
+  int   n = *length / 3;
+  for (int i = 0; i < 2 * n; i++) {
+    b[i] = std::max(a[i], b[i]);
+  }
+  for (int i = 2 * n; i < 3 * n; i++) {
+    b[i] += a[i];
+  }
+}
+
+}  // namespace
+
+std::size_t memoryHighWaterMark()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+
+#ifdef __APPLE__
+  // macOS reports the maximum resident set size in bytes ...
+  return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+  // ... and Linux reports it in kilobytes
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+std::size_t memoryHighWaterMark(MPI_Comm comm)
+{
+  unsigned long long local  = memoryHighWaterMark();
+  unsigned long long global = 0;
+  MPI_Allreduce(&local, &global, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+  return static_cast<std::size_t>(global);
+}
+
+std::string name(MemoryCategory category)
+{
+  switch (category) {
+    case MemoryCategory::ElementRestriction:
+      return "element_restriction";
+    case MemoryCategory::GeometricFactors:
+      return "geometric_factors";
+    case MemoryCategory::QFunctionDerivatives:
+      return "qfunction_derivatives";
+    case MemoryCategory::QuadratureData:
+      return "quadrature_data";
+    case MemoryCategory::SparseMatrix:
+      return "sparse_matrix";
+    case MemoryCategory::AMG:
+      return "amg";
+  }
+  return "unknown";
+}
+
+TrackedAllocation::TrackedAllocation(MemoryCategory category, std::size_t bytes) : category_(category), bytes_(bytes)
+{
+  track(category_, bytes_);
+}
+
+TrackedAllocation::TrackedAllocation(const TrackedAllocation& other) : category_(other.category_), bytes_(other.bytes_)
+{
+  track(category_, bytes_);
+}
+
+TrackedAllocation::TrackedAllocation(TrackedAllocation&& other) noexcept
+    : category_(other.category_), bytes_(other.bytes_)
+{
+  other.bytes_ = 0;
+}
+
+TrackedAllocation& TrackedAllocation::operator=(const TrackedAllocation& other)
+{
+  if (this != &other) {
+    release();
+    category_ = other.category_;
+    bytes_    = other.bytes_;
+    track(category_, bytes_);
+  }
+  return *this;
+}
+
+TrackedAllocation& TrackedAllocation::operator=(TrackedAllocation&& other) noexcept
+{
+  if (this != &other) {
+    release();
+    category_    = other.category_;
+    bytes_       = other.bytes_;
+    other.bytes_ = 0;
+  }
+  return *this;
+}
+
+TrackedAllocation::~TrackedAllocation() { release(); }
+
+void TrackedAllocation::release()
+{
+  if (bytes_ > 0) {
+    untrack(category_, bytes_);
+    bytes_ = 0;
+  }
+}
+
+std::array<std::size_t, num_memory_categories> trackedMemory()
+{
+  std::lock_guard<std::mutex> lock(tracked_bytes_mutex);
+  return tracked_bytes;
+}
+
+std::size_t memoryFootprint(const mfem::HypreParMatrix& A)
+{
+  hypre_ParCSRMatrix* parcsr = A;
+
+  std::size_t bytes = 0;
+  for (hypre_CSRMatrix* block : {hypre_ParCSRMatrixDiag(parcsr), hypre_ParCSRMatrixOffd(parcsr)}) {
+    auto nnz  = static_cast<std::size_t>(hypre_CSRMatrixNumNonzeros(block));
+    auto rows = static_cast<std::size_t>(hypre_CSRMatrixNumRows(block));
+    bytes += nnz * (sizeof(HYPRE_Real) + sizeof(HYPRE_Int)) + (rows + 1) * sizeof(HYPRE_Int);
+  }
+  return bytes;
+}
+
+std::map<std::string, MemoryStatistics> memoryReport(MPI_Comm comm)
+{
+  // the tracked categories, then their total, then the high-water mark
+  constexpr std::size_t n = num_memory_categories + 2;
+
+  std::array<std::size_t, num_memory_categories> tracked = trackedMemory();
+
+  std::array<double, n>      local{};
+  std::array<std::string, n> names;
+
+  for (std::size_t i = 0; i < num_memory_categories; i++) {
+    names[i] = name(static_cast<MemoryCategory>(i));
+    local[i] = static_cast<double>(tracked[i]);
+    local[num_memory_categories] += local[i];
+  }
+  names[num_memory_categories]     = "total";
+  names[num_memory_categories + 1] = "high_water_mark";
+  local[num_memory_categories + 1] = static_cast<double>(memoryHighWaterMark());
+
+  // the maxima, minima (as the maxima of the negated values) and sums are computed in a single reduction
+  std::array<double, 3 * n> send, recv;
+  for (std::size_t i = 0; i < n; i++) {
+    send[i]         = local[i];
+    send[n + i]     = -local[i];
+    send[2 * n + i] = local[i];
+  }
+
+  MPI_Op max_max_sum;
+  MPI_Op_create(maxMaxSum, /* commute = */ 1, &max_max_sum);
+  MPI_Allreduce(send.data(), recv.data(), static_cast<int>(3 * n), MPI_DOUBLE, max_max_sum, comm);
+  MPI_Op_free(&max_max_sum);
+
+  int num_ranks = 0;
+  MPI_Comm_size(comm, &num_ranks);
+
+  std::map<std::string, MemoryStatistics> report;
+  for (std::size_t i = 0; i < n; i++) {
+    report[names[i]] = {-recv[n + i], recv[i], recv[2 * n + i] / num_ranks};
+  }
+  return report;
+}
+
+void logMemoryReport(const std::string& label, MPI_Comm comm)
+{
+  auto report = memoryReport(comm);
+
+  constexpr double   MB = 1024.0 * 1024.0;
+  std::ostringstream output;
+  output << axom::fmt::format("Memory usage {0} (MB per rank):\n", label);
+  output << axom::fmt::format("  {0:<24} {1:>12} {2:>12} {3:>12}\n", "category", "min", "avg", "max");
+  for (const auto& [category, stats] : report) {
+    output << axom::fmt::format("  {0:<24} {1:>12.2f} {2:>12.2f} {3:>12.2f}\n", category, stats.min / MB,
+                                stats.avg / MB, stats.max / MB);
+  }
+
+  SLIC_INFO_ROOT(output.str());
+}
+
+}  // namespace serac
@@ -0,0 +1,155 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file memory.hpp
+ *
+ * @brief This file contains functions for querying the memory usage of a simulation
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "mpi.h"
+#include "mfem.hpp"
+
+namespace serac {
+
+/**
+ * @brief Returns the largest amount of memory (in bytes) this process has occupied so far, i.e. its peak
+ * resident set size
+ *
+ * @return The memory high-water mark of this process, or 0 if the platform doesn't provide it
+ */
+std::size_t memoryHighWaterMark();
+
+/**
+ * @brief Returns the largest memory high-water mark (in bytes) of the processes in a communicator
+ *
+ * @param comm The MPI communicator
+ * @return The maximum over the ranks of `memoryHighWaterMark()`
+ *
+ * @note This is a collective operation
+ */
+std::size_t memoryHighWaterMark(MPI_Comm comm);
+
+/**
+ * @brief The kinds of large allocations whose sizes are tracked by TrackedAllocation
+ */
+enum class MemoryCategory
+{
+  ElementRestriction,    ///< the dof lists of each element, used by Functional's gather / scatter operations
+  GeometricFactors,      ///< the positions and jacobians at each quadrature point
+  QFunctionDerivatives,  ///< the derivatives of the q-functions stored by Functional for linearization
+  QuadratureData,        ///< the material state stored at each quadrature point
+  SparseMatrix,          ///< assembled (CSR) matrices
+  AMG                    ///< algebraic multigrid hierarchies
+};
+
+/// @brief the number of different MemoryCategory values
+inline constexpr std::size_t num_memory_categories = 6;
+
+/**
+ * @brief Returns the name of a memory category (e.g. "geometric_factors")
+ */
+std::string name(MemoryCategory category);
+
+/**
+ * @brief Records that some memory of a given category is allocated, for as long as this object exists
+ *
+ * Objects that own large allocations hold one of these alongside them, so that `memoryReport()` can attribute
+ * the memory in use on each rank to the objects that allocated it. Copying a TrackedAllocation records another
+ * allocation of the same size (as copying its owner copies the memory), while moving it transfers the record.
+ */
+class TrackedAllocation {
+public:
+  /// @brief Records nothing
+  TrackedAllocation() = default;
+
+  /**
+   * @brief Record an allocation
+   *
+   * @param category The kind of allocation
+   * @param bytes The size of the allocation
+   */
+  TrackedAllocation(MemoryCategory category, std::size_t bytes);
+
+  /// @brief Record another allocation of the same size
+  TrackedAllocation(const TrackedAllocation& other);
+
+  /// @brief Take over the record of another allocation
+  TrackedAllocation(TrackedAllocation&& other) noexcept;
+
+  /// @brief Replace the current record with another allocation of the same size as @a other
+  TrackedAllocation& operator=(const TrackedAllocation& other);
+
+  /// @brief Replace the current record with the record of @a other
+  TrackedAllocation& operator=(TrackedAllocation&& other) noexcept;
+
+  /// @brief Remove the record of the allocation
+  ~TrackedAllocation();
+
+  /// @brief The size (in bytes) of the recorded allocation
+  std::size_t bytes() const { return bytes_; }
+
+private:
+  /// @brief Remove the record of the allocation (if any)
+  void release();
+
+  /// @brief The kind of allocation
+  MemoryCategory category_ = MemoryCategory::ElementRestriction;
+
+  /// @brief The size of the allocation
+  std::size_t bytes_ = 0;
+};
+
+/**
+ * @brief Returns the number of bytes currently recorded by TrackedAllocations on this rank, for each category
+ */
+std::array<std::size_t, num_memory_categories> trackedMemory();
+
+/**
+ * @brief Returns the size (in bytes) of the part of a parallel sparse matrix stored on this rank
+ *
+ * @param A The matrix
+ * @return The size of the CSR arrays (values, column indices and row offsets) of its diagonal and off-diagonal blocks
+ */
+std::size_t memoryFootprint(const mfem::HypreParMatrix& A);
+
+/**
+ * @brief The distribution of a memory usage (in bytes) across the ranks of a communicator
+ */
+struct MemoryStatistics {
+  double min;  ///< the smallest value on any rank
+  double max;  ///< the largest value on any rank
+  double avg;  ///< the average value over the ranks
+};
+
+/**
+ * @brief Summarize the memory in use by each category of TrackedAllocation across the ranks of a communicator
+ *
+ * @param comm The MPI communicator
+ * @return The statistics for each category (by name), for their "total", and for the "high_water_mark" of the ranks
+ *
+ * @note This is a collective operation
+ */
+std::map<std::string, MemoryStatistics> memoryReport(MPI_Comm comm = MPI_COMM_WORLD);
+
+/**
+ * @brief Write the result of `memoryReport()` to the log (on the root rank)
+ *
+ * @param label A description of when the report was made, e.g. "after completeSetup"
+ * @param comm The MPI communicator
+ *
+ * @note This is a collective operation
+ */
+void logMemoryReport(const std::string& label, MPI_Comm comm = MPI_COMM_WORLD);
+
+}  // namespace serac
@@ -6,8 +6,11 @@
 
 #include "serac/infrastructure/profiling.hpp"
 
+#include "serac/infrastructure/about.hpp"
 #include "serac/infrastructure/logger.hpp"
 
+#include <utility>
+
 #ifdef SERAC_USE_CALIPER
 #include <optional>
 #endif
@@ -17,6 +20,59 @@ namespace serac::profiling {
 #ifdef SERAC_USE_CALIPER
 namespace {
 std::optional<cali::ConfigManager> mgr;
+
+/// @brief The Caliper attributes describing the work done in a KernelRegion
+struct KernelAttributes {
+  cali_id_t bytes;     ///< the number of bytes read and written
+  cali_id_t elements;  ///< the number of elements processed
+  cali_id_t qpts;      ///< the number of quadrature points processed
+};
+
+const KernelAttributes& kernelAttributes()
+{
+  // the values are summed by Caliper's aggregation service, and setting them
+  // shouldn't take a snapshot of its own (see ~KernelRegion)
+  constexpr int properties = CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE | CALI_ATTR_SKIP_EVENTS;
+
+  static const KernelAttributes attributes{cali_create_attribute("serac.bytes", CALI_TYPE_DOUBLE, properties),
+                                           cali_create_attribute("serac.elements", CALI_TYPE_DOUBLE, properties),
+                                           cali_create_attribute("serac.qpts", CALI_TYPE_DOUBLE, properties)};
+  return attributes;
+}
+
+/**
+ * @brief The Caliper option that reports the work done in each KernelRegion: the counts are
+ * summed over the region's snapshots on each rank, and then over the ranks
+ */
+constexpr const char* kernel_metrics_spec = R"json(
+{
+  "name"        : "serac.kernel_metrics",
+  "type"        : "bool",
+  "category"    : "metric",
+  "description" : "Report the bytes moved and the elements and quadrature points processed in serac kernels",
+  "query"       :
+  [
+    {
+      "level"  : "local",
+      "select" :
+      [
+        { "expr": "sum(serac.bytes)",    "as": "Bytes" },
+        { "expr": "sum(serac.elements)", "as": "Elements" },
+        { "expr": "sum(serac.qpts)",     "as": "Quadrature points" }
+      ]
+    },
+    {
+      "level"  : "cross",
+      "select" :
+      [
+        { "expr": "sum(sum#serac.bytes)",    "as": "Bytes" },
+        { "expr": "sum(sum#serac.elements)", "as": "Elements" },
+        { "expr": "sum(sum#serac.qpts)",     "as": "Quadrature points" }
+      ]
+    }
+  ]
+}
+)json";
 }  // namespace
 #endif
 
@@ -34,11 +90,17 @@ void initialize([[maybe_unused]] MPI_Comm comm, [[maybe_unused]] std::string opt
   adiak::walltime();
   adiak::cputime();
   adiak::systime();
+
+  // Record which build produced the profile, so profiles of different builds can be compared
+  SERAC_SET_METADATA("serac_version", serac::version(false));
+  SERAC_SET_METADATA("serac_git_sha", serac::gitSHA());
 #endif
 
 #ifdef SERAC_USE_CALIPER
   // Initialize Caliper
-  mgr               = cali::ConfigManager();
+  mgr = cali::ConfigManager();
+  mgr->add_option_spec(kernel_metrics_spec);
+
   auto check_result = mgr->check(options.c_str());
 
   if (check_result.empty()) {
@@ -48,11 +110,37 @@ void initialize([[maybe_unused]] MPI_Comm comm, [[maybe_unused]] std::string opt
   }
 
   // Defaults, should probably always be enabled
-  mgr->add("runtime-report,spot");
+  mgr->add("runtime-report(serac.kernel_metrics=true),spot(serac.kernel_metrics=true)");
   mgr->start();
 #endif
 }
 
+KernelRegion::KernelRegion(std::string name, double bytes, double elements, double qpts)
+    : name_(std::move(name)), bytes_(bytes), elements_(elements), qpts_(qpts)
+{
+#ifdef SERAC_USE_CALIPER
+  cali_begin_region(name_.c_str());
+#endif
+}
+
+KernelRegion::~KernelRegion()
+{
+#ifdef SERAC_USE_CALIPER
+  // the snapshot taken when the region ends is attributed to the region, so the counts
+  // are set just before it (and removed right after) to be recorded exactly once
+  const KernelAttributes& attributes = kernelAttributes();
+  cali_set_double(attributes.bytes, bytes_);
+  cali_set_double(attributes.elements, elements_);
+  cali_set_double(attributes.qpts, qpts_);
+
+  cali_end_region(name_.c_str());
+
+  cali_end(attributes.bytes);
+  cali_end(attributes.elements);
+  cali_end(attributes.qpts);
+#endif
+}
+
 void finalize()
 {
 #ifdef SERAC_USE_ADIAK
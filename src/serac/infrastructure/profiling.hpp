@@ -90,7 +90,8 @@ namespace serac::profiling {
 /**
  * @brief Initializes performance monitoring using the Caliper and Adiak libraries
  * @param comm The MPI communicator (used by Adiak), optional
- * @param options The Caliper ConfigManager config string, optional
+ * @param options The Caliper ConfigManager config string, optional. It may use the "serac.kernel_metrics"
+ * option (see `KernelRegion`), e.g. "hatchet-region-profile(serac.kernel_metrics=true)".
  * @see https://software.llnl.gov/Caliper/ConfigManagerAPI.html#configmanager-configuration-string-syntax
  */
 void initialize([[maybe_unused]] MPI_Comm comm = MPI_COMM_WORLD, [[maybe_unused]] std::string options = "");
@@ -100,6 +101,54 @@ void initialize([[maybe_unused]] MPI_Comm comm = MPI_COMM_WORLD, [[maybe_unused]
  */
 void finalize();
 
+/**
+ * @brief Marks a stage of a computational kernel as a Caliper region, and records how much work was done in it
+ *
+ * The amount of data moved and the number of elements and quadrature points processed are attached to the
+ * region (when it ends) as the aggregatable Caliper attributes "serac.bytes", "serac.elements" and "serac.qpts".
+ * The Caliper option "serac.kernel_metrics" (defined by `initialize`, and enabled in its default "spot" and
+ * "runtime-report" profiles) reports their sums for each region, i.e. sum(serac.bytes) on each rank and the sum
+ * of those over all ranks. Together with the region's time they give its bandwidth and throughput, i.e. its
+ * placement on a roofline plot.
+ *
+ * @note The byte counts are estimates of the compulsory memory traffic of each stage (every value read or written
+ * once), not measurements. When Serac is built without Caliper, this class does nothing.
+ */
+class KernelRegion {
+public:
+  /**
+   * @brief Begin the region
+   *
+   * @param name The name of the region, e.g. "serac::domain::Square::action"
+   * @param bytes The number of bytes read and written in the region
+   * @param elements The number of elements processed in the region
+   * @param qpts The number of quadrature points processed in the region
+   */
+  KernelRegion(std::string name, double bytes, double elements = 0.0, double qpts = 0.0);
+
+  /// @brief End the region, recording its work
+  ~KernelRegion();
+
+  /// @brief Regions can't be copied, since that would end them twice
+  KernelRegion(const KernelRegion&) = delete;
+
+  /// @brief Regions can't be copied, since that would end them twice
+  KernelRegion& operator=(const KernelRegion&) = delete;
+
+private:
+  /// @brief The name of the region
+  [[maybe_unused]] std::string name_;
+
+  /// @brief The number of bytes read and written in the region
+  [[maybe_unused]] double bytes_;
+
+  /// @brief The number of elements processed in the region
+  [[maybe_unused]] double elements_;
+
+  /// @brief The number of quadrature points processed in the region
+  [[maybe_unused]] double qpts_;
+};
+
 /// Produces a string by applying << to all arguments
 template <typename... T>
 std::string concat(T... args)
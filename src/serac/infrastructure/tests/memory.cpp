@@ -0,0 +1,89 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <utility>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+
+#include "serac/infrastructure/memory.hpp"
+
+namespace serac {
+
+std::size_t tracked(MemoryCategory category) { return trackedMemory()[static_cast<std::size_t>(category)]; }
+
+TEST(Memory, TrackedAllocation)
+{
+  std::size_t initial = tracked(MemoryCategory::QuadratureData);
+
+  {
+    TrackedAllocation a(MemoryCategory::QuadratureData, 1000);
+    EXPECT_EQ(tracked(MemoryCategory::QuadratureData), initial + 1000);
+
+    // copies record another allocation
+    TrackedAllocation b = a;
+    EXPECT_EQ(tracked(MemoryCategory::QuadratureData), initial + 2000);
+
+    // moves transfer the record
+    TrackedAllocation c = std::move(b);
+    EXPECT_EQ(b.bytes(), std::size_t{0});
+    EXPECT_EQ(c.bytes(), std::size_t{1000});
+    EXPECT_EQ(tracked(MemoryCategory::QuadratureData), initial + 2000);
+
+    // assignment replaces the previous record
+    a = TrackedAllocation(MemoryCategory::QuadratureData, 500);
+    EXPECT_EQ(tracked(MemoryCategory::QuadratureData), initial + 1500);
+  }
+
+  EXPECT_EQ(tracked(MemoryCategory::QuadratureData), initial);
+}
+
+TEST(Memory, Report)
+{
+  int num_ranks = 0;
+  int rank      = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  std::size_t initial = tracked(MemoryCategory::AMG);
+
+  // every rank allocates a different amount
+  TrackedAllocation amg(MemoryCategory::AMG, 1000 * static_cast<std::size_t>(rank + 1));
+
+  auto report = memoryReport(MPI_COMM_WORLD);
+
+  ASSERT_EQ(report.count("amg"), std::size_t{1});
+  ASSERT_EQ(report.count("total"), std::size_t{1});
+  ASSERT_EQ(report.count("high_water_mark"), std::size_t{1});
+
+  if (initial == 0) {
+    EXPECT_EQ(report["amg"].min, 1000.0);
+    EXPECT_EQ(report["amg"].max, 1000.0 * num_ranks);
+    EXPECT_EQ(report["amg"].avg, 500.0 * (num_ranks + 1));
+  }
+  EXPECT_GE(report["total"].min, report["amg"].min);
+  EXPECT_GT(report["high_water_mark"].max, 0.0);
+
+  logMemoryReport("in Memory.Report");
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
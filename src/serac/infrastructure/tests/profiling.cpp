@@ -5,8 +5,12 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <array>
+#include <cstdio>
 #include <cstring>
 #include <exception>
+#include <fstream>
+#include <optional>
+#include <string>
 
 #include "axom/slic/core/SimpleLogger.hpp"
 #include <gtest/gtest.h>
@@ -97,6 +101,83 @@ TEST(Profiling, Exception)
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
+#ifdef SERAC_USE_CALIPER
+/// @brief read the value of `key` from a record written in Caliper's "expand" format (key=value,key=value,...)
+std::optional<double> recordValue(const std::string& record, const std::string& key)
+{
+  std::string field = key + "=";
+  auto        begin = record.find(field);
+  if (begin == std::string::npos) {
+    return std::nullopt;
+  }
+  begin += field.size();
+  return std::stod(record.substr(begin, record.find(',', begin) - begin));
+}
+#endif
+
+TEST(Profiling, KernelRegion)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+  serac::profiling::initialize();
+
+#ifdef SERAC_USE_CALIPER
+  // a separate channel that sums the work recorded in each region, like the "serac.kernel_metrics" option
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  std::string report_file = profiling::concat("kernel_region_report_", rank, ".txt");
+
+  cali_id_t channel = cali::create_channel(
+      "serac.kernel_region_test", 0,
+      {{"CALI_SERVICES_ENABLE", "event,trace,report"},
+       {"CALI_REPORT_FILENAME", report_file},
+       {"CALI_REPORT_CONFIG",
+        "select sum(serac.bytes) as bytes,sum(serac.elements) as elements,sum(serac.qpts) as qpts "
+        "group by region format expand"}});
+#endif
+
+  mfem::Vector x(1000), y(1000);
+  x = 1.0;
+
+  {
+    // nested regions record their own work
+    profiling::KernelRegion outer("Outer kernel", 0.0);
+    for (int i = 0; i < 3; i++) {
+      profiling::KernelRegion inner("Inner kernel", 2.0 * sizeof(double) * x.Size(), 10.0, 40.0);
+      y = x;
+    }
+  }
+
+#ifdef SERAC_USE_CALIPER
+  cali_channel_flush(channel, 0);
+  cali_delete_channel(channel);
+
+  std::optional<std::string> inner_record, outer_record;
+
+  std::ifstream report(report_file);
+  for (std::string record; std::getline(report, record);) {
+    if (record.find("Inner kernel") != std::string::npos) {
+      inner_record = record;
+    } else if (record.find("Outer kernel") != std::string::npos) {
+      outer_record = record;
+    }
+  }
+  report.close();
+  std::remove(report_file.c_str());
+
+  // the work of each region is recorded exactly once per iteration, and not attributed to the enclosing region
+  ASSERT_TRUE(inner_record && outer_record);
+  EXPECT_EQ(recordValue(*inner_record, "bytes"), 3 * 2.0 * sizeof(double) * x.Size());
+  EXPECT_EQ(recordValue(*inner_record, "elements"), 30.0);
+  EXPECT_EQ(recordValue(*inner_record, "qpts"), 120.0);
+  EXPECT_EQ(recordValue(*outer_record, "bytes").value_or(0.0), 0.0);
+  EXPECT_EQ(recordValue(*outer_record, "elements").value_or(0.0), 0.0);
+#endif
+
+  serac::profiling::finalize();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
 }  // namespace serac
 
 int main(int argc, char* argv[])
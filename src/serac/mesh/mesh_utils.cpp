@@ -6,7 +6,12 @@
 
 #include "serac/mesh/mesh_utils.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <numeric>
 
 #include "axom/core.hpp"
 #include "axom/fmt.hpp"
@@ -396,6 +401,8 @@ void InputOptions::defineInputFileSchema(axom::inlet::Container& container)
   // Refinement levels
   container.addInt("ser_ref_levels", "Number of times to refine the mesh uniformly in serial.").defaultValue(0);
   container.addInt("par_ref_levels", "Number of times to refine the mesh uniformly in parallel.").defaultValue(0);
+  container.addString("partition_cache",
+                      "Prefix of per-rank files to read the partitioned mesh from, or to save it to if they don't exist");
 
   // Types of meshes we support
   container.addString("type", "Type of mesh").required().validValues({"ball", "box", "disk", "file"});
@@ -422,31 +429,40 @@ void InputOptions::defineInputFileSchema(axom::inlet::Container& container)
 
 std::unique_ptr<mfem::ParMesh> buildParallelMesh(const InputOptions& options, const MPI_Comm comm)
 {
-  std::optional<mfem::Mesh> serial_mesh;
-
-  if (const auto file_opts = std::get_if<FileInputOptions>(&options.extra_options)) {
-    SLIC_ERROR_ROOT_IF(file_opts->absolute_mesh_file_name.empty(),
-                       "Absolute path to mesh file was not configured, did you forget to call findMeshFilePath?");
-    serial_mesh.emplace(buildMeshFromFile(file_opts->absolute_mesh_file_name));
-  } else if (const auto box_opts = std::get_if<BoxInputOptions>(&options.extra_options)) {
-    const auto& elems = box_opts->elements;
-    const auto& sizes = box_opts->overall_size;
-    if (elems.size() == 2) {
-      serial_mesh.emplace(buildRectangleMesh(elems.at(0), elems.at(1), sizes.at(0), sizes.at(1)));
-    } else {
-      serial_mesh.emplace(
-          buildCuboidMesh(elems.at(0), elems.at(1), elems.at(2), sizes.at(0), sizes.at(1), sizes.at(2)));
-    }
-  } else if (const auto ball_opts = std::get_if<NBallInputOptions>(&options.extra_options)) {
-    if (ball_opts->dimension == 2) {
-      serial_mesh.emplace(buildDiskMesh(ball_opts->approx_elements));
-    } else {
-      serial_mesh.emplace(buildBallMesh(ball_opts->approx_elements));
+  auto build_serial_mesh = [&options]() {
+    std::optional<mfem::Mesh> serial_mesh;
+
+    if (const auto file_opts = std::get_if<FileInputOptions>(&options.extra_options)) {
+      SLIC_ERROR_ROOT_IF(file_opts->absolute_mesh_file_name.empty(),
+                         "Absolute path to mesh file was not configured, did you forget to call findMeshFilePath?");
+      serial_mesh.emplace(buildMeshFromFile(file_opts->absolute_mesh_file_name));
+    } else if (const auto box_opts = std::get_if<BoxInputOptions>(&options.extra_options)) {
+      const auto& elems = box_opts->elements;
+      const auto& sizes = box_opts->overall_size;
+      if (elems.size() == 2) {
+        serial_mesh.emplace(buildRectangleMesh(elems.at(0), elems.at(1), sizes.at(0), sizes.at(1)));
+      } else {
+        serial_mesh.emplace(
+            buildCuboidMesh(elems.at(0), elems.at(1), elems.at(2), sizes.at(0), sizes.at(1), sizes.at(2)));
+      }
+    } else if (const auto ball_opts = std::get_if<NBallInputOptions>(&options.extra_options)) {
+      if (ball_opts->dimension == 2) {
+        serial_mesh.emplace(buildDiskMesh(ball_opts->approx_elements));
+      } else {
+        serial_mesh.emplace(buildBallMesh(ball_opts->approx_elements));
+      }
     }
+
+    SLIC_ERROR_ROOT_IF(!serial_mesh, "Mesh input options were invalid");
+    return std::move(*serial_mesh);
+  };
+
+  if (!options.partition_cache.empty()) {
+    return refineAndDistributeCached(build_serial_mesh, options.partition_cache, options.ser_ref_levels,
+                                     options.par_ref_levels, comm);
   }
 
-  SLIC_ERROR_ROOT_IF(!serial_mesh, "Mesh input options were invalid");
-  return refineAndDistribute(std::move(*serial_mesh), options.ser_ref_levels, options.par_ref_levels, comm);
+  return refineAndDistribute(build_serial_mesh(), options.ser_ref_levels, options.par_ref_levels, comm);
 }
 
 std::unique_ptr<mfem::ParMesh> refineAndDistribute(mfem::Mesh&& serial_mesh, const int refine_serial,
@@ -469,6 +485,168 @@ std::unique_ptr<mfem::ParMesh> refineAndDistribute(mfem::Mesh&& serial_mesh, con
   return parallel_mesh;
 }
 
+namespace {
+
+/// @brief the name of the file holding a given rank's part of a partitioned mesh
+std::string partitionFileName(const std::string& prefix, int rank)
+{
+  return axom::fmt::format("{}.{:06d}", prefix, rank);
+}
+
+}  // namespace
+
+bool partitionedMeshExists(const std::string& prefix, const MPI_Comm comm)
+{
+  int rank      = 0;
+  int num_ranks = 0;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  int found = axom::utilities::filesystem::pathExists(partitionFileName(prefix, rank));
+
+  // a partition written for more ranks can't be used either
+  if (rank == 0 && axom::utilities::filesystem::pathExists(partitionFileName(prefix, num_ranks))) {
+    found = 0;
+  }
+
+  int found_everywhere = 0;
+  MPI_Allreduce(&found, &found_everywhere, 1, MPI_INT, MPI_MIN, comm);
+  return found_everywhere == 1;
+}
+
+std::unique_ptr<mfem::ParMesh> readPartitionedMesh(const std::string& prefix, const MPI_Comm comm)
+{
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+
+  std::string   filename = partitionFileName(prefix, rank);
+  std::ifstream input(filename);
+  SLIC_ERROR_IF(!input, axom::fmt::format("Can not open partitioned mesh file: '{0}'", filename));
+
+  auto parallel_mesh = std::make_unique<mfem::ParMesh>(comm, input);
+
+  parallel_mesh->EnsureNodes();
+  parallel_mesh->ExchangeFaceNbrData();
+
+  return parallel_mesh;
+}
+
+void writePartitionedMesh(const mfem::ParMesh& mesh, const std::string& prefix)
+{
+  // the directory is created by one rank, so the others don't race to create it
+  std::string directory = axom::utilities::filesystem::getDirName(prefix);
+  if (mesh.GetMyRank() == 0 && !directory.empty() && !axom::utilities::filesystem::pathExists(directory)) {
+    axom::utilities::filesystem::makeDirsForPath(directory);
+  }
+  MPI_Barrier(mesh.GetComm());
+
+  // write to a temporary file first, so that an interrupted run doesn't leave a truncated partition behind
+  std::string filename  = partitionFileName(prefix, mesh.GetMyRank());
+  std::string temporary = filename + ".tmp";
+  {
+    std::ofstream output(temporary);
+    SLIC_ERROR_IF(!output, axom::fmt::format("Can not write partitioned mesh file: '{0}'", temporary));
+    output.precision(16);
+    mesh.ParPrint(output);
+  }
+  SLIC_ERROR_IF(std::rename(temporary.c_str(), filename.c_str()) != 0,
+                axom::fmt::format("Can not rename partitioned mesh file '{0}' to '{1}': {2}", temporary, filename,
+                                  std::strerror(errno)));
+}
+
+std::unique_ptr<mfem::ParMesh> refineAndDistributeCached(const std::function<mfem::Mesh()>& build_serial_mesh,
+                                                         const std::string& partition_cache, const int refine_serial,
+                                                         const int refine_parallel, const MPI_Comm comm)
+{
+  if (partitionedMeshExists(partition_cache, comm)) {
+    SLIC_INFO_ROOT(axom::fmt::format("Reading partitioned mesh: '{0}'", partition_cache));
+    return readPartitionedMesh(partition_cache, comm);
+  }
+
+  auto parallel_mesh = refineAndDistribute(build_serial_mesh(), refine_serial, refine_parallel, comm);
+
+  SLIC_INFO_ROOT(axom::fmt::format("Saving partitioned mesh: '{0}'", partition_cache));
+  writePartitionedMesh(*parallel_mesh, partition_cache);
+
+  return parallel_mesh;
+}
+
+namespace {
+
+/// @brief assign parts [first_part, first_part + num_parts) to the given elements, by recursive bisection
+void recursiveCoordinateBisection(const mfem::DenseMatrix& centroids, const mfem::Vector& weights,
+                                  std::vector<int>::iterator begin, std::vector<int>::iterator end, int first_part,
+                                  int num_parts, std::vector<int>& partition)
+{
+  if (num_parts == 1) {
+    for (auto it = begin; it != end; ++it) {
+      partition[static_cast<std::size_t>(*it)] = first_part;
+    }
+    return;
+  }
+
+  // cut perpendicular to the direction in which these elements are the most spread out
+  int    dim        = centroids.Height();
+  int    axis       = 0;
+  double max_extent = -1.0;
+  for (int d = 0; d < dim; d++) {
+    auto [min, max] = std::minmax_element(begin, end, [&](int a, int b) { return centroids(d, a) < centroids(d, b); });
+    if (centroids(d, *max) - centroids(d, *min) > max_extent) {
+      max_extent = centroids(d, *max) - centroids(d, *min);
+      axis       = d;
+    }
+  }
+  std::sort(begin, end, [&](int a, int b) { return centroids(axis, a) < centroids(axis, b); });
+
+  double total_weight = 0.0;
+  for (auto it = begin; it != end; ++it) {
+    total_weight += weights[*it];
+  }
+
+  // split the weight in proportion to the number of parts on each side, leaving
+  // at least one element for each part
+  int    left_parts  = num_parts / 2;
+  double left_target = total_weight * left_parts / num_parts;
+  auto   num         = std::distance(begin, end);
+  auto   split       = begin;
+  double left_weight = 0.0;
+  while (split != end && left_weight + 0.5 * weights[*split] < left_target) {
+    left_weight += weights[*split];
+    ++split;
+  }
+  auto lowest  = begin + std::min<long>(left_parts, num);
+  auto highest = end - std::min<long>(num_parts - left_parts, std::distance(lowest, end));
+  split        = std::clamp(split, lowest, highest);
+
+  recursiveCoordinateBisection(centroids, weights, begin, split, first_part, left_parts, partition);
+  recursiveCoordinateBisection(centroids, weights, split, end, first_part + left_parts, num_parts - left_parts,
+                               partition);
+}
+
+}  // namespace
+
+std::vector<int> weightedPartition(const mfem::Mesh& mesh, const mfem::Vector& weights, int num_parts)
+{
+  SLIC_ERROR_ROOT_IF(weights.Size() != mesh.GetNE(), "Element weights must be given for every element of the mesh");
+  SLIC_ERROR_ROOT_IF(num_parts < 1, "The number of parts must be positive");
+
+  int               dim = mesh.SpaceDimension();
+  mfem::DenseMatrix centroids(dim, mesh.GetNE());
+  mfem::Vector      centroid;
+  for (int e = 0; e < mesh.GetNE(); e++) {
+    // GetElementCenter isn't const-qualified, but doesn't modify the mesh
+    const_cast<mfem::Mesh&>(mesh).GetElementCenter(e, centroid);
+    centroids.SetCol(e, centroid);
+  }
+
+  std::vector<int> elements(static_cast<std::size_t>(mesh.GetNE()));
+  std::iota(elements.begin(), elements.end(), 0);
+
+  std::vector<int> partition(elements.size(), 0);
+  recursiveCoordinateBisection(centroids, weights, elements.begin(), elements.end(), 0, num_parts, partition);
+  return partition;
+}
+
 }  // namespace mesh
 }  // namespace serac
 
@@ -477,6 +655,11 @@ serac::mesh::InputOptions FromInlet<serac::mesh::InputOptions>::operator()(const
   int ser_ref = base["ser_ref_levels"];
   int par_ref = base["par_ref_levels"];
 
+  std::string partition_cache;
+  if (base.contains("partition_cache")) {
+    partition_cache = base["partition_cache"].get<std::string>();
+  }
+
   // This is for cuboid/rectangular meshes
   std::string mesh_type = base["type"];
   if (mesh_type == "box") {
@@ -501,17 +684,17 @@ serac::mesh::InputOptions FromInlet<serac::mesh::InputOptions>::operator()(const
       overall_size = std::vector<double>(elements.size(), 1.);
     }
 
-    return {serac::mesh::BoxInputOptions{elements, overall_size}, ser_ref, par_ref};
+    return {serac::mesh::BoxInputOptions{elements, overall_size}, ser_ref, par_ref, partition_cache};
   } else if (mesh_type == "disk" || mesh_type == "ball") {
     int approx_elements = base["approx_elements"];
     int dim             = 3;
     if (mesh_type == "disk") {
       dim = 2;
     }
-    return {serac::mesh::NBallInputOptions{approx_elements, dim}, ser_ref, par_ref};
+    return {serac::mesh::NBallInputOptions{approx_elements, dim}, ser_ref, par_ref, partition_cache};
   } else if (mesh_type == "file") {  // This is for file-based meshes
     std::string mesh_path = base["mesh"];
-    return {serac::mesh::FileInputOptions{mesh_path}, ser_ref, par_ref};
+    return {serac::mesh::FileInputOptions{mesh_path}, ser_ref, par_ref, partition_cache};
   }
 
   // If it reaches here, we haven't found a supported type
@@ -49,6 +49,13 @@ struct InputOptions {
    *
    */
   int par_ref_levels;
+
+  /**
+   * @brief The prefix of the per-rank partition files to read the parallel mesh from (or save it to, if absent)
+   *
+   * @note When empty, the mesh is always built, refined and partitioned from scratch
+   */
+  std::string partition_cache{};
 };
 
 /**
@@ -13,8 +13,11 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <variant>
+#include <vector>
 #include "mfem.hpp"
 
 #include "serac/infrastructure/input.hpp"
@@ -223,6 +226,79 @@ struct NBallInputOptions {
 std::unique_ptr<mfem::ParMesh> refineAndDistribute(mfem::Mesh&& serial_mesh, const int refine_serial = 0,
                                                    const int refine_parallel = 0, const MPI_Comm comm = MPI_COMM_WORLD);
 
+/**
+ * @brief Finalizes a serial mesh into a refined parallel mesh, reusing a previously saved partition if available
+ *
+ * If every rank finds its part of a partitioned mesh saved under @a partition_cache (see `readPartitionedMesh`),
+ * the parallel mesh is read directly from those files and @a build_serial_mesh is never called. Otherwise, the
+ * serial mesh is built, refined and distributed as in `refineAndDistribute`, and the resulting partition is saved
+ * under @a partition_cache for subsequent runs.
+ *
+ * @param[in] build_serial_mesh A callback that constructs the "base" serial mesh
+ * @param[in] partition_cache The prefix of the per-rank partition files
+ * @param[in] refine_serial The number of serial refinements
+ * @param[in] refine_parallel The number of parallel refinements
+ * @param[in] comm The MPI communicator
+ *
+ * @return A unique_ptr containing the constructed mesh
+ *
+ * @note The cache is not invalidated automatically: a different prefix should be used if the base mesh or
+ * the refinement levels change. A cache written with a different number of ranks is not used.
+ */
+std::unique_ptr<mfem::ParMesh> refineAndDistributeCached(const std::function<mfem::Mesh()>& build_serial_mesh,
+                                                         const std::string& partition_cache,
+                                                         const int refine_serial = 0, const int refine_parallel = 0,
+                                                         const MPI_Comm comm = MPI_COMM_WORLD);
+
+/**
+ * @brief Checks whether a partitioned mesh for the ranks of @a comm exists
+ *
+ * @param[in] prefix The prefix of the per-rank mesh files
+ * @param[in] comm The MPI communicator
+ *
+ * @return true on every rank if each rank's file exists, and the files were written for the same number of ranks
+ */
+bool partitionedMeshExists(const std::string& prefix, const MPI_Comm comm = MPI_COMM_WORLD);
+
+/**
+ * @brief Reads a mesh that has already been partitioned, with each rank reading only its own part
+ *
+ * Rank `r` reads the file `<prefix>.<r>`, with `r` zero-padded to six digits. This is the format
+ * written by `writePartitionedMesh` and mfem::ParMesh::Save, so the startup cost does not grow with
+ * the number of ranks.
+ *
+ * @param[in] prefix The prefix of the per-rank mesh files
+ * @param[in] comm The MPI communicator, which must have as many ranks as the mesh has parts
+ *
+ * @return A unique_ptr containing the parallel mesh
+ */
+std::unique_ptr<mfem::ParMesh> readPartitionedMesh(const std::string& prefix, const MPI_Comm comm = MPI_COMM_WORLD);
+
+/**
+ * @brief Saves each rank's part of a parallel mesh to its own file, so that it can be read with `readPartitionedMesh`
+ *
+ * @param[in] mesh The parallel mesh
+ * @param[in] prefix The prefix of the per-rank mesh files
+ *
+ * @note This is a collective operation, as the directory of the files is created by the root rank
+ */
+void writePartitionedMesh(const mfem::ParMesh& mesh, const std::string& prefix);
+
+/**
+ * @brief Partitions a mesh by recursive coordinate bisection of the element centroids, such that each part
+ * receives (approximately) the same total element weight
+ *
+ * @param[in] mesh The serial mesh to partition
+ * @param[in] weights The (positive) weight of each element, e.g. its measured evaluation cost
+ * @param[in] num_parts The number of parts
+ *
+ * @return The part number of each element, suitable for the mfem::ParMesh constructor
+ *
+ * @note mfem's graph partitioner does not accept element weights, which is why a geometric
+ * partitioner is used here
+ */
+std::vector<int> weightedPartition(const mfem::Mesh& mesh, const mfem::Vector& weights, int num_parts);
+
 }  // namespace mesh
 
 }  // namespace serac
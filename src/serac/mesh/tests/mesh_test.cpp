@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: (BSD-3-Clause)
 
+#include <filesystem>
 #include <fstream>
 
 #include <gtest/gtest.h>
@@ -23,6 +24,51 @@ TEST(Mesh, LoadExodus)
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
+TEST(Mesh, PartitionCache)
+{
+  std::string mesh_file = std::string(SERAC_REPO_DIR) + "/data/meshes/beam-hex.mesh";
+  std::string cache     = "partition_cache_test/beam-hex";
+
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  int  num_serial_builds = 0;
+  auto build_serial_mesh = [&]() {
+    num_serial_builds++;
+    return buildMeshFromFile(mesh_file);
+  };
+
+  // the first run partitions the mesh and saves it ...
+  auto pmesh = mesh::refineAndDistributeCached(build_serial_mesh, cache, 1, 1);
+  EXPECT_EQ(num_serial_builds, 1);
+  EXPECT_TRUE(mesh::partitionedMeshExists(cache));
+
+  // ... and subsequent runs read the partition back without touching the serial mesh
+  auto cached = mesh::refineAndDistributeCached(build_serial_mesh, cache, 1, 1);
+  EXPECT_EQ(num_serial_builds, 1);
+
+  EXPECT_EQ(cached->GetNE(), pmesh->GetNE());
+  EXPECT_EQ(cached->GetGlobalNE(), pmesh->GetGlobalNE());
+  EXPECT_EQ(cached->GetNBE(), pmesh->GetNBE());
+  EXPECT_EQ(cached->GetNSharedFaces(), pmesh->GetNSharedFaces());
+
+  mfem::Vector difference(*cached->GetNodes());
+  difference -= *pmesh->GetNodes();
+  EXPECT_LT(difference.Normlinf(), 1.0e-14);
+
+  // a partition for a different number of ranks is not used
+  MPI_Comm single_rank;
+  MPI_Comm_split(MPI_COMM_WORLD, rank, rank, &single_rank);
+  EXPECT_FALSE(mesh::partitionedMeshExists(cache, single_rank));
+  MPI_Comm_free(&single_rank);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if (rank == 0) {
+    std::filesystem::remove_all(std::filesystem::path(cache).parent_path());
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
 }  // namespace serac
 
 //------------------------------------------------------------------------------
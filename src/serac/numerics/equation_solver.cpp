@@ -6,34 +6,445 @@
 
 #include "serac/numerics/equation_solver.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <sstream>
 #include <ios>
 #include <iostream>
+#include <functional>
+
+#include "_hypre_parcsr_ls.h"
 
 #include "serac/infrastructure/logger.hpp"
 #include "serac/infrastructure/terminator.hpp"
 #include "serac/serac_config.hpp"
 #include "serac/infrastructure/profiling.hpp"
+#include "serac/numerics/stdfunction_operator.hpp"
+#include "serac/numerics/single_precision_amg.hpp"
 
 namespace serac {
 
+namespace {
+
+/// @brief adds the wall-clock time (in seconds) elapsed during its lifetime to a running total
+class ScopedTimer {
+public:
+  /// @brief start timing
+  ScopedTimer(double& total) : total_(total), start_(std::chrono::steady_clock::now()) {}
+
+  /// @brief stop timing, and add the elapsed time to the total
+  ~ScopedTimer() { total_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count(); }
+
+private:
+  /// @brief the running total
+  double& total_;
+
+  /// @brief when timing started
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// @brief An operator that forwards to another, and records the number and cost of its evaluations
+class InstrumentedOperator : public mfem::Operator {
+public:
+  /// @brief wrap @a op, recording its evaluations in @a statistics
+  InstrumentedOperator(const mfem::Operator& op, SolverStatistics& statistics)
+      : mfem::Operator(op.Height(), op.Width()), op_(op), statistics_(statistics)
+  {
+  }
+
+  /// @overload
+  void Mult(const mfem::Vector& x, mfem::Vector& y) const override
+  {
+    statistics_.residual_evaluations++;
+    ScopedTimer timer(statistics_.residual_time);
+    op_.Mult(x, y);
+  }
+
+  /// @overload
+  mfem::Operator& GetGradient(const mfem::Vector& x) const override
+  {
+    statistics_.jacobian_evaluations++;
+    ScopedTimer timer(statistics_.assembly_time);
+    return op_.GetGradient(x);
+  }
+
+  /// @brief the unassembled gradient of the wrapped operator at @a x, or nullptr if it doesn't provide one
+  mfem::Operator* GetMatrixFreeGradient(const mfem::Vector& x) const
+  {
+    if (auto function_op = dynamic_cast<const mfem_ext::StdFunctionOperator*>(&op_)) {
+      return function_op->GetMatrixFreeGradient(x);
+    }
+    return nullptr;
+  }
+
+  /// @brief the wrapped operator
+  const mfem::Operator& wrapped() const { return op_; }
+
+private:
+  /// @brief the operator being wrapped
+  const mfem::Operator& op_;
+
+  /// @brief where the evaluations are recorded
+  SolverStatistics& statistics_;
+};
+
+/**
+ * @brief Make the next evaluation of @a op also linearize it, if it supports that
+ * (see StdFunctionOperator::linearizeNextMult)
+ */
+void linearizeNextMult(const mfem::Operator* op)
+{
+  if (auto instrumented = dynamic_cast<const InstrumentedOperator*>(op)) {
+    op = &instrumented->wrapped();
+  }
+  if (auto function_op = dynamic_cast<const mfem_ext::StdFunctionOperator*>(op)) {
+    function_op->linearizeNextMult();
+  }
+}
+
+/**
+ * @brief Whether @a preconditioner applies the operator it was built for, rather than only data computed from it
+ *
+ * The finest level of p-multigrid also applies its operator, but it can be replaced without a new setup.
+ */
+bool refersToOperator(const mfem::Solver& preconditioner)
+{
+  return dynamic_cast<const mfem::HypreSolver*>(&preconditioner) ||
+         dynamic_cast<const mfem::HypreSmoother*>(&preconditioner) ||
+         dynamic_cast<const SinglePrecisionAMG*>(&preconditioner) ||
+         dynamic_cast<const BlockSchurPreconditioner*>(&preconditioner);
+}
+
+/// @brief A preconditioner that forwards to another, and optionally keeps it for later operators until it is stale
+class ReusablePreconditioner : public mfem::Solver {
+public:
+  /// @brief wrap @a preconditioner, recording its setups in @a statistics, and deciding on reuse across @a comm
+  ReusablePreconditioner(mfem::Solver& preconditioner, SolverStatistics& statistics, MPI_Comm comm)
+      : mfem::Solver(preconditioner.Height(), preconditioner.Width()),
+        preconditioner_(preconditioner),
+        statistics_(statistics),
+        comm_(comm)
+  {
+  }
+
+  /// @brief set up the preconditioner for @a op, unless the one for an earlier operator is reused
+  void SetOperator(const mfem::Operator& op) override
+  {
+    height = op.Height();
+    width  = op.Width();
+
+    auto*      matrix     = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+    auto*      pmg        = dynamic_cast<PMultigridPreconditioner*>(&preconditioner_);
+    const bool needs_copy = !pmg && refersToOperator(preconditioner_);
+
+    const mfem::Array<int>  no_dofs;
+    const mfem::Array<int>& essential_dofs = essential_dofs_ ? essential_dofs_() : no_dofs;
+
+    // a preconditioner that applies its operator is only kept if it was built for a copy, and any preconditioner
+    // is only kept (on every rank) for operators of the same size with the same essential dofs
+    int reusable = reuse_ && !stale_ && built_ && (built_for_ || !needs_copy) && op.Height() == built_height_ &&
+                   essential_dofs.Size() == built_essential_dofs_.Size() &&
+                   std::equal(essential_dofs.begin(), essential_dofs.end(), built_essential_dofs_.begin());
+    if (comm_ != MPI_COMM_NULL) {
+      MPI_Allreduce(MPI_IN_PLACE, &reusable, 1, MPI_INT, MPI_MIN, comm_);
+    }
+
+    if (reusable) {
+      if (pmg) {
+        pmg->setFinestOperator(op);
+      }
+      statistics_.preconditioner_reuses++;
+      return;
+    }
+
+    statistics_.preconditioner_setups++;
+    stale_               = false;
+    baseline_iterations_ = -1;
+    built_               = true;
+    built_height_        = op.Height();
+    essential_dofs.Copy(built_essential_dofs_);
+
+    if (reuse_ && needs_copy && matrix) {
+      // e.g. the finest level of BoomerAMG refers to the matrix, so it is built for a copy that outlives
+      // the Jacobian it came from (other operators can't be copied, so their preconditioner isn't kept)
+      built_for_ = std::make_unique<mfem::HypreParMatrix>(*matrix);
+      memory_    = TrackedAllocation(MemoryCategory::SparseMatrix, memoryFootprint(*built_for_));
+      preconditioner_.SetOperator(*built_for_);
+    } else {
+      built_for_.reset();
+      memory_ = TrackedAllocation();
+      preconditioner_.SetOperator(op);
+    }
+  }
+
+  /// @overload
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override { preconditioner_.Mult(b, x); }
+
+  /// @brief record the outcome of a linear solve with the preconditioner, to decide whether it is stale
+  void recordSolve(int iterations, bool converged)
+  {
+    if (!converged) {
+      stale_ = true;
+    } else if (baseline_iterations_ < 0) {
+      baseline_iterations_ = iterations;
+    } else if (iterations > max_iteration_growth_ * std::max(baseline_iterations_, 1)) {
+      stale_ = true;
+    }
+  }
+
+  /// @brief see EquationSolver::reusePreconditioner
+  void setReuse(bool reuse, double max_iteration_growth)
+  {
+    reuse_                = reuse;
+    max_iteration_growth_ = max_iteration_growth;
+  }
+
+  /// @brief rebuild the preconditioner for the next operator
+  void rebuild() { stale_ = true; }
+
+  /// @brief see EquationSolver::setEssentialDofs
+  void setEssentialDofs(std::function<const mfem::Array<int>&()> essential_dofs)
+  {
+    essential_dofs_ = std::move(essential_dofs);
+  }
+
+private:
+  /// @brief the preconditioner being wrapped
+  mfem::Solver& preconditioner_;
+
+  /// @brief where the setups are recorded
+  SolverStatistics& statistics_;
+
+  /// @brief the ranks that decide together whether the preconditioner is reused (or MPI_COMM_NULL, in serial)
+  MPI_Comm comm_;
+
+  /// @brief provides the essential dofs of the next operator
+  std::function<const mfem::Array<int>&()> essential_dofs_;
+
+  /// @brief whether the preconditioner is kept for later operators
+  bool reuse_ = false;
+
+  /// @brief the growth of the linear iterations that makes the preconditioner stale
+  double max_iteration_growth_ = 2.0;
+
+  /// @brief whether the preconditioner must be rebuilt for the next operator
+  bool stale_ = true;
+
+  /// @brief the iterations of the first linear solve with the current preconditioner (or -1, before that solve)
+  int baseline_iterations_ = -1;
+
+  /// @brief whether the preconditioner has been built
+  bool built_ = false;
+
+  /// @brief the (local) size of the operator the preconditioner was built for
+  int built_height_ = 0;
+
+  /// @brief the essential dofs of the operator the preconditioner was built for
+  mfem::Array<int> built_essential_dofs_;
+
+  /// @brief a copy of the operator the preconditioner was built for, when it refers to it and may be reused
+  std::unique_ptr<mfem::HypreParMatrix> built_for_;
+
+  /// @brief records the size of the copied operator for `serac::memoryReport()`
+  TrackedAllocation memory_;
+};
+
+/// @brief A linear solver that forwards to another, and records the number and cost of its solves
+class InstrumentedSolver : public mfem::Solver {
+public:
+  /**
+   * @brief wrap @a solver, recording its solves in @a statistics
+   *
+   * @param solver The linear solver
+   * @param statistics Where the solves are recorded
+   * @param preconditioner The preconditioner of the linear solver, if it is an iterative solver whose preconditioner
+   * may be reused, which is told about the outcome of each solve
+   */
+  InstrumentedSolver(mfem::Solver& solver, SolverStatistics& statistics,
+                     ReusablePreconditioner* preconditioner = nullptr)
+      : mfem::Solver(solver.Height(), solver.Width()),
+        solver_(solver),
+        statistics_(statistics),
+        preconditioner_(preconditioner)
+  {
+  }
+
+  /// @overload
+  void SetOperator(const mfem::Operator& op) override
+  {
+    ScopedTimer timer(statistics_.linear_setup_time);
+    height = op.Height();
+    width  = op.Width();
+    solver_.SetOperator(op);
+  }
+
+  /// @overload
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override
+  {
+    statistics_.linear_solves++;
+    {
+      ScopedTimer timer(statistics_.linear_solve_time);
+      solver_.iterative_mode = iterative_mode;
+      solver_.Mult(b, x);
+    }
+
+    if (auto iterative_solver = dynamic_cast<const mfem::IterativeSolver*>(&solver_)) {
+      statistics_.linear_iterations += iterative_solver->GetNumIterations();
+      if (preconditioner_) {
+        preconditioner_->recordSolve(iterative_solver->GetNumIterations(), iterative_solver->GetConverged());
+      }
+    }
+  }
+
+  /// @brief the linear solver being wrapped
+  mfem::Solver& wrapped() const { return solver_; }
+
+private:
+  /// @brief the linear solver being wrapped
+  mfem::Solver& solver_;
+
+  /// @brief where the solves are recorded
+  SolverStatistics& statistics_;
+
+  /// @brief the reusable preconditioner of the linear solver, if any
+  ReusablePreconditioner* preconditioner_;
+};
+
+/// @brief the Krylov solver used by @a solver (directly, or through an InstrumentedSolver), if it is one
+mfem::IterativeSolver* krylovSolver(mfem::Solver* solver)
+{
+  if (auto instrumented = dynamic_cast<InstrumentedSolver*>(solver)) {
+    solver = &instrumented->wrapped();
+  }
+  return dynamic_cast<mfem::IterativeSolver*>(solver);
+}
+
+/**
+ * @brief The relative tolerances (forcing terms) of the linear solves in an inexact Newton method
+ *
+ * See ForcingTerm for the available choices.
+ */
+class ForcingTermSequence {
+public:
+  /**
+   * @brief Start a new sequence, for a nonlinear solve
+   *
+   * @param options The forcing term parameters
+   * @param min_forcing_term The smallest relative tolerance to use (e.g. the fixed tolerance of the linear solver)
+   * @param norm_goal The nonlinear residual norm at which the nonlinear solve converges
+   */
+  ForcingTermSequence(const NonlinearSolverOptions& options, double min_forcing_term, double norm_goal)
+      : options_(options), min_forcing_term_(min_forcing_term), norm_goal_(norm_goal)
+  {
+  }
+
+  /// @brief whether the forcing terms are adaptive
+  bool adaptive() const { return options_.forcing_term != ForcingTerm::Fixed; }
+
+  /// @brief whether the sequence needs the norm of the residual of the linear model after each step
+  bool needsLinearResidual() const { return options_.forcing_term == ForcingTerm::EisenstatWalker1; }
+
+  /**
+   * @brief The relative tolerance for the linear solve at the current iterate
+   *
+   * @param norm The nonlinear residual norm at the current iterate
+   */
+  double next(double norm)
+  {
+    double eta = options_.initial_forcing_term;
+
+    if (previous_norm_ > 0.0) {
+      if (options_.forcing_term == ForcingTerm::EisenstatWalker1) {
+        // | ||r_k|| - ||r_{k-1} + J_{k-1} s_{k-1}|| | / ||r_{k-1}||, safeguarded with alpha = (1 + sqrt(5)) / 2
+        constexpr double alpha = 1.6180339887498949;
+        eta                    = std::abs(norm - linear_residual_norm_) / previous_norm_;
+        if (std::pow(eta_, alpha) > 0.1) {
+          eta = std::max(eta, std::pow(eta_, alpha));
+        }
+      } else {
+        // gamma * (||r_k|| / ||r_{k-1}||)^alpha
+        const double gamma = options_.forcing_term_gamma;
+        const double alpha = options_.forcing_term_alpha;
+        eta                = gamma * std::pow(norm / previous_norm_, alpha);
+        if (gamma * std::pow(eta_, alpha) > 0.1) {
+          eta = std::max(eta, gamma * std::pow(eta_, alpha));
+        }
+      }
+    }
+
+    eta = std::min(eta, options_.max_forcing_term);
+
+    // don't solve the final linear systems much more accurately than the nonlinear solve needs
+    if (norm > 0.0) {
+      eta = std::max(eta, 0.5 * norm_goal_ / norm);
+    }
+    eta = std::max(eta, min_forcing_term_);
+
+    eta_           = eta;
+    previous_norm_ = norm;
+    return eta;
+  }
+
+  /**
+   * @brief Record how well the linear model is satisfied by the most recent step
+   *
+   * @param norm The norm of r + J s, for the residual r, jacobian J and step s of the most recent iterate
+   */
+  void recordLinearResidual(double norm) { linear_residual_norm_ = norm; }
+
+private:
+  /// @brief the forcing term parameters
+  const NonlinearSolverOptions& options_;
+
+  /// @brief the smallest relative tolerance
+  double min_forcing_term_;
+
+  /// @brief the nonlinear residual norm at which the nonlinear solve converges
+  double norm_goal_;
+
+  /// @brief the most recent forcing term
+  double eta_ = 0.0;
+
+  /// @brief the nonlinear residual norm at the previous iterate (or 0 before the first)
+  double previous_norm_ = 0.0;
+
+  /// @brief the norm of the residual of the linear model at the previous iterate
+  double linear_residual_norm_ = 0.0;
+};
+
+}  // namespace
+
 /// Newton solver with a 2-way line-search.  Reverts to regular Newton if max_line_search_iterations is set to 0.
 class NewtonSolver : public mfem::NewtonSolver {
 protected:
   /// initial solution vector to do line-search off of
   mutable mfem::Vector x0;
+  /// residual of the linear model, J * c - r, used by the EisenstatWalker1 forcing term
+  mutable mfem::Vector linear_residual;
   /// nonlinear solver options
   NonlinearSolverOptions nonlinear_options;
+  /// linear solver options
+  LinearSolverOptions linear_options;
+  /// whether the Jacobian pointed to by grad was assembled for the current operator
+  mutable bool jacobian_assembled = false;
 
 public:
+  /// whether to keep using the most recent Jacobian (and linear solver setup) while it remains effective
+  bool reuse_jacobian = false;
+
   /// constructor
-  NewtonSolver(const NonlinearSolverOptions& nonlinear_opts) : nonlinear_options(nonlinear_opts) {}
+  NewtonSolver(const NonlinearSolverOptions& nonlinear_opts, const LinearSolverOptions& linear_opts)
+      : nonlinear_options(nonlinear_opts), linear_options(linear_opts)
+  {
+  }
 
 #ifdef MFEM_USE_MPI
   /// parallel constructor
-  NewtonSolver(MPI_Comm comm_, const NonlinearSolverOptions& nonlinear_opts)
-      : mfem::NewtonSolver(comm_), nonlinear_options(nonlinear_opts)
+  NewtonSolver(MPI_Comm comm_, const NonlinearSolverOptions& nonlinear_opts, const LinearSolverOptions& linear_opts)
+      : mfem::NewtonSolver(comm_), nonlinear_options(nonlinear_opts), linear_options(linear_opts)
   {
   }
 #endif
@@ -52,11 +463,19 @@ public:
     return normEval;
   }
 
+  /// @brief Set the nonlinear operator, discarding the Jacobian of the previous one
+  void SetOperator(const mfem::Operator& op) override
+  {
+    mfem::NewtonSolver::SetOperator(op);
+    jacobian_assembled = false;
+  }
+
   /// assemble the jacobian
   void assembleJacobian(const mfem::Vector& x) const
   {
     CALI_CXX_MARK_FUNCTION;
-    grad = &oper->GetGradient(x);
+    grad               = &oper->GetGradient(x);
+    jacobian_assembled = true;
   }
 
   /// set the preconditioner for the linear solver
@@ -81,6 +500,18 @@ public:
 
     using real_t = mfem::real_t;
 
+    // a solve that doesn't reuse the Jacobian forgets the one from the previous solve as well, since the
+    // operator is free to discard it in the meantime (e.g. by assembling a new one for a warm start)
+    if (!reuse_jacobian) {
+      jacobian_assembled = false;
+    }
+    real_t last_reduction = 0.0;
+
+    // the Jacobian is needed at the initial guess unless it is already converged, or a previous one is reused
+    if (!jacobian_assembled) {
+      linearizeNextMult(oper);
+    }
+
     real_t norm, norm_goal;
     norm = initial_norm = evaluateNorm(x, r);
 
@@ -91,6 +522,10 @@ public:
     norm_goal            = std::max(rel_tol * initial_norm, abs_tol);
     prec->iterative_mode = false;
 
+    // the linear solves are only inexact if the linear solver is a Krylov method
+    ForcingTermSequence    forcing(nonlinear_options, linear_options.relative_tol, norm_goal);
+    mfem::IterativeSolver* krylov = forcing.adaptive() ? krylovSolver(prec) : nullptr;
+
     int it = 0;
     for (; true; it++) {
       MFEM_ASSERT(mfem::IsFinite(norm), "norm = " << norm);
@@ -112,17 +547,33 @@ public:
 
       real_t norm_nm1 = norm;
 
-      assembleJacobian(x);
-      setPreconditioner();
+      if (!reuse_jacobian || !jacobian_assembled || last_reduction > nonlinear_options.jacobian_reuse_reduction) {
+        assembleJacobian(x);
+        setPreconditioner();
+      }
+      if (krylov) {
+        krylov->SetRelTol(forcing.next(norm));
+      }
       solveLinearSystem(r, c);
+      if (krylov && forcing.needsLinearResidual()) {
+        linear_residual.SetSize(r.Size());
+        grad->Mult(c, linear_residual);
+        linear_residual -= r;
+        forcing.recordLinearResidual(Norm(linear_residual));
+      }
 
       // there must be a better way to do this?
       x0.SetSize(x.Size());
       x0 = 0.0;
       x0.Add(1.0, x);
 
+      // the full step is usually accepted, so the operator is linearized there (unless the Jacobian
+      // is reused), while the other points of the line search are only evaluated
       real_t stepScale = 1.0;
       add(x0, -stepScale, c, x);
+      if (!reuse_jacobian) {
+        linearizeNextMult(oper);
+      }
       norm = evaluateNorm(x, r);
 
       const int               max_ls_iters = nonlinear_options.max_line_search_iterations;
@@ -177,11 +628,18 @@ public:
                     << std::endl;
         }
       }
+
+      last_reduction = norm / norm_nm1;
     }
 
     final_iter = it;
     final_norm = norm;
 
+    // the linear solver may also be used on its own (e.g. for adjoint solves)
+    if (krylov) {
+      krylov->SetRelTol(linear_options.relative_tol);
+    }
+
     if (print_options.summary || (!converged && print_options.warnings) || print_options.first_and_last) {
       mfem::out << "Newton: Number of iterations: " << final_iter << '\n' << "   ||r|| = " << final_norm << '\n';
     }
@@ -290,6 +748,15 @@ protected:
   /// handle to the preconditioner used by the trust region, it ignores the linear solver as a SPD preconditioner is
   /// currently required
   Solver& trPrecond;
+  /// the operator whose action hess_vec applies, either the assembled Jacobian or its matrix-free counterpart
+  mutable const mfem::Operator* hessian = nullptr;
+
+  /// total number of cg iterations in the most recent call to Mult
+  mutable int totalCgIterations = 0;
+  /// time spent setting up the preconditioner in the most recent call to Mult
+  mutable double precondSetupTime = 0.0;
+  /// time spent minimizing the trust region subproblems in the most recent call to Mult
+  mutable double cgTime = 0.0;
 
 public:
 #ifdef MFEM_USE_MPI
@@ -301,6 +768,14 @@ public:
   }
 #endif
 
+  /// record the linear algebra done in the most recent call to Mult, which doesn't go through the linear solver
+  void recordLinearSolves(SolverStatistics& statistics) const
+  {
+    statistics.linear_iterations += totalCgIterations;
+    statistics.linear_setup_time += precondSetupTime;
+    statistics.linear_solve_time += cgTime;
+  }
+
   /// finds tau s.t. (z + tau*d)^2 = trSize^2
   void project_to_boundary_with_coefs(mfem::Vector& z, const mfem::Vector& d, double trSize, double zz, double zd,
                                       double dd) const
@@ -430,6 +905,19 @@ public:
     grad = &oper->GetGradient(x);
   }
 
+  /// linearize the jacobian without assembling it, returns nullptr if the operator doesn't support that
+  const mfem::Operator* matrix_free_jacobian(const mfem::Vector& x) const
+  {
+    CALI_CXX_MARK_FUNCTION;
+    if (auto instrumented = dynamic_cast<const InstrumentedOperator*>(oper)) {
+      return instrumented->GetMatrixFreeGradient(x);
+    }
+    if (auto function_op = dynamic_cast<const mfem_ext::StdFunctionOperator*>(oper)) {
+      return function_op->GetMatrixFreeGradient(x);
+    }
+    return nullptr;
+  }
+
   /// evaluate the nonlinear residual
   mfem::real_t computeResidual(const mfem::Vector& x_, mfem::Vector& r_) const
   {
@@ -438,11 +926,11 @@ public:
     return Norm(r_);
   }
 
-  /// apply the action of the assembled Jacobian matrix to a vector
+  /// apply the action of the Jacobian to a vector
   void hess_vec(const mfem::Vector& x_, mfem::Vector& v_) const
   {
     CALI_CXX_MARK_FUNCTION;
-    grad->Mult(x_, v_);
+    hessian->Mult(x_, v_);
   }
 
   /// apply trust region specific preconditioner
@@ -460,6 +948,10 @@ public:
 
     using real_t = mfem::real_t;
 
+    // the first iteration always needs the Jacobian at the initial guess, while the trial points are only
+    // evaluated, and the operator is linearized at the ones that are accepted when their Jacobian is needed
+    linearizeNextMult(oper);
+
     real_t norm, norm_goal;
     norm = initial_norm = computeResidual(X, r);
     norm_goal           = std::max(rel_tol * initial_norm, abs_tol);
@@ -469,6 +961,10 @@ public:
     prec->iterative_mode     = false;
     trPrecond.iterative_mode = false;
 
+    totalCgIterations = 0;
+    precondSetupTime  = 0.0;
+    cgTime            = 0.0;
+
     // local arrays
     xPred.SetSize(X.Size());
     xPred = 0.0;
@@ -483,6 +979,9 @@ public:
     settings.cgTol           = 0.2 * norm_goal;
     double trSize            = 10.0;
     size_t cumulativeCgIters = 0;
+    int    lastPrecondUpdate = 0;
+
+    ForcingTermSequence forcing(nonlinear_options, 0.0, norm_goal);
 
     int it = 0;
     for (; true; it++) {
@@ -503,12 +1002,29 @@ public:
         break;
       }
 
-      assemble_jacobian(X);
+      // the relative accuracy of the trust region subproblem solve
+      const double forcing_term = forcing.adaptive() ? forcing.next(norm) : 1e-3;
+
+      const bool precondOutdated =
+          it == 0 || trResults.cgIterationsCount >= settings.maxCgIterations ||
+          (cumulativeCgIters >= settings.maxCumulativeIteration &&
+           it - lastPrecondUpdate >= nonlinear_options.preconditioner_update_interval);
+
+      // when matrix-free, the jacobian is only assembled to update the preconditioner
+      hessian = nullptr;
+      if (nonlinear_options.matrix_free_hessian && !precondOutdated) {
+        hessian = matrix_free_jacobian(X);
+      }
+
+      // assembling a new jacobian may invalidate the one the preconditioner was built from
+      if (!hessian) {
+        assemble_jacobian(X);
+        hessian = grad;
 
-      if (it == 0 || (trResults.cgIterationsCount >= settings.maxCgIterations ||
-                      cumulativeCgIters >= settings.maxCumulativeIteration)) {
+        ScopedTimer timer(precondSetupTime);
         trPrecond.SetOperator(*grad);
         cumulativeCgIters = 0;
+        lastPrecondUpdate = it;
         if (print_options.iterations) {
           // currently it will always be updated
           // mfem::out << "Updating trust region preconditioner." << std::endl;
@@ -546,10 +1062,12 @@ public:
         trResults.cgIterationsCount = 1;
         trResults.interiorStatus    = TrustRegionResults::Status::OnBoundary;
       } else {
-        settings.cgTol = std::max(0.2 * norm_goal, 1e-3 * norm);
+        settings.cgTol = std::max(0.2 * norm_goal, forcing_term * norm);
+        ScopedTimer timer(cgTime);
         solve_trust_region_minimization(r, scratch, hess_vec_func, precond_func, settings, trSize, trResults);
       }
       cumulativeCgIters += trResults.cgIterationsCount;
+      totalCgIterations += static_cast<int>(trResults.cgIterationsCount);
 
       bool happyAboutTrSize = false;
       int  lineSearchIter   = 0;
@@ -564,6 +1082,11 @@ public:
         double dHd            = Dot(d, Hd);
         double modelObjective = Dot(r, d) + 0.5 * dHd;
 
+        if (forcing.needsLinearResidual()) {
+          add(r, Hd, scratch);
+          forcing.recordLinearResidual(Norm(scratch));
+        }
+
         add(X, d, xPred);
 
         double realObjective = std::numeric_limits<double>::max();
@@ -643,6 +1166,11 @@ EquationSolver::EquationSolver(NonlinearSolverOptions nonlinear_opts, LinearSolv
   lin_solver_     = std::move(lin_solver);
   preconditioner_ = std::move(preconditioner);
   nonlin_solver_  = buildNonlinearSolver(nonlinear_opts, lin_opts, *preconditioner_, comm);
+
+  if (preconditioner_) {
+    reusable_preconditioner_ = std::make_unique<ReusablePreconditioner>(*preconditioner_, *statistics_, comm);
+    reusePreconditioner(lin_opts.reuse_preconditioner, lin_opts.max_iteration_growth);
+  }
 }
 
 EquationSolver::EquationSolver(std::unique_ptr<mfem::NewtonSolver> nonlinear_solver,
@@ -655,145 +1183,341 @@ EquationSolver::EquationSolver(std::unique_ptr<mfem::NewtonSolver> nonlinear_sol
   nonlin_solver_  = std::move(nonlinear_solver);
   lin_solver_     = std::move(linear_solver);
   preconditioner_ = std::move(preconditioner);
+
+  if (preconditioner_) {
+    reusable_preconditioner_ =
+        std::make_unique<ReusablePreconditioner>(*preconditioner_, *statistics_, nonlin_solver_->GetComm());
+  }
 }
 
 void EquationSolver::setOperator(const mfem::Operator& op)
 {
-  nonlin_solver_->SetOperator(op);
+  instrumented_op_ = std::make_unique<InstrumentedOperator>(op, *statistics_);
+  nonlin_solver_->SetOperator(*instrumented_op_);
 
   // Now that the nonlinear solver knows about the operator, we can set its linear solver
   if (!nonlin_solver_set_solver_called_) {
-    nonlin_solver_->SetSolver(linearSolver());
+    // the preconditioner of an iterative solver goes through the wrapper that decides when it is rebuilt
+    auto* reusable = static_cast<ReusablePreconditioner*>(reusable_preconditioner_.get());
+    if (auto krylov = krylovSolver(lin_solver_.get()); krylov && reusable) {
+      krylov->SetPreconditioner(*reusable);
+    } else {
+      reusable = nullptr;
+    }
+
+    instrumented_lin_solver_ = std::make_unique<InstrumentedSolver>(linearSolver(), *statistics_, reusable);
+    nonlin_solver_->SetSolver(*instrumented_lin_solver_);
     nonlin_solver_set_solver_called_ = true;
   }
 }
 
+void EquationSolver::reuseJacobian(bool reuse)
+{
+  if (auto newton = dynamic_cast<NewtonSolver*>(nonlin_solver_.get())) {
+    newton->reuse_jacobian = reuse;
+  }
+}
+
+void EquationSolver::reusePreconditioner(bool reuse, double max_iteration_growth)
+{
+  SLIC_ERROR_ROOT_IF(max_iteration_growth < 1.0, "The maximum growth of the linear iterations must be at least 1");
+  if (reusable_preconditioner_) {
+    static_cast<ReusablePreconditioner*>(reusable_preconditioner_.get())->setReuse(reuse, max_iteration_growth);
+  }
+}
+
+void EquationSolver::setEssentialDofs(std::function<const mfem::Array<int>&()> essential_dofs)
+{
+  if (reusable_preconditioner_) {
+    static_cast<ReusablePreconditioner*>(reusable_preconditioner_.get())->setEssentialDofs(std::move(essential_dofs));
+  }
+}
+
+void EquationSolver::rebuildPreconditioner()
+{
+  if (reusable_preconditioner_) {
+    static_cast<ReusablePreconditioner*>(reusable_preconditioner_.get())->rebuild();
+  }
+}
+
 void EquationSolver::solve(mfem::Vector& x) const
 {
-  mfem::Vector zero(x);
-  zero = 0.0;
-  // KINSOL does not handle non-zero RHS, so we enforce that the RHS
-  // of the nonlinear system is zero
-  nonlin_solver_->Mult(zero, x);
+  statistics_->nonlinear_solves++;
+  {
+    ScopedTimer timer(statistics_->nonlinear_solve_time);
+
+    mfem::Vector zero(x);
+    zero = 0.0;
+    // KINSOL does not handle non-zero RHS, so we enforce that the RHS
+    // of the nonlinear system is zero
+    nonlin_solver_->Mult(zero, x);
+  }
+  statistics_->nonlinear_iterations += nonlin_solver_->GetNumIterations();
+
+  // the trust region solver does its own (CG) linear solves
+  if (auto trust_region = dynamic_cast<const TrustRegion*>(nonlin_solver_.get())) {
+    trust_region->recordLinearSolves(*statistics_);
+  }
 }
 
-void SuperLUSolver::Mult(const mfem::Vector& input, mfem::Vector& output) const
+namespace {
+
+/// @brief Mix a value into a (64-bit FNV-1a) hash of a sparsity pattern
+void hashCombine(std::uint64_t& hash, HYPRE_BigInt value)
 {
-  SLIC_ERROR_ROOT_IF(!superlu_mat_, "Operator must be set prior to solving with SuperLU");
+  constexpr std::uint64_t prime = 1099511628211ull;
 
-  // Use the underlying MFEM-based solver and SuperLU matrix type to solve the system
-  superlu_solver_.Mult(input, output);
+  auto bits = static_cast<std::uint64_t>(value);
+  for (int byte = 0; byte < 8; byte++) {
+    hash ^= (bits >> (8 * byte)) & 0xff;
+    hash *= prime;
+  }
 }
 
 /**
- * @brief Function for building a monolithic parallel Hypre matrix from a block system of smaller Hypre matrices
- *
- * @param block_operator The block system of HypreParMatrices
- * @return The assembled monolithic HypreParMatrix
+ * @brief Add the sizes, row and column offsets, and local CSR structure of a HypreParMatrix to a sparsity fingerprint
  *
- * @pre @a block_operator must have assembled HypreParMatrices for its sub-blocks
+ * @param matrix The matrix, or null for an empty block of a block operator
+ * @param fingerprint The fingerprint of the sparsity pattern
  */
-std::unique_ptr<mfem::HypreParMatrix> buildMonolithicMatrix(const mfem::BlockOperator& block_operator)
+void addToFingerprint(const mfem::HypreParMatrix* matrix, DirectSolver::SparsityFingerprint& fingerprint)
 {
-  int row_blocks = block_operator.NumRowBlocks();
-  int col_blocks = block_operator.NumColBlocks();
+  if (!matrix) {
+    hashCombine(fingerprint.hash, -1);
+    return;
+  }
 
-  SLIC_ERROR_ROOT_IF(row_blocks != col_blocks, "Attempted to use a direct solver on a non-square block system.");
+  matrix->HostRead();
+  hypre_ParCSRMatrix* parcsr = *matrix;
 
-  mfem::Array2D<const mfem::HypreParMatrix*> hypre_blocks(row_blocks, col_blocks);
+  hashCombine(fingerprint.hash, hypre_ParCSRMatrixGlobalNumRows(parcsr));
+  hashCombine(fingerprint.hash, hypre_ParCSRMatrixGlobalNumCols(parcsr));
+  hashCombine(fingerprint.hash, hypre_ParCSRMatrixFirstRowIndex(parcsr));
+  hashCombine(fingerprint.hash, hypre_ParCSRMatrixFirstColDiag(parcsr));
 
-  for (int i = 0; i < row_blocks; ++i) {
-    for (int j = 0; j < col_blocks; ++j) {
-      // checks for presence of empty (null) blocks, which happen fairly common in multirank contact
-      if (!block_operator.IsZeroBlock(i, j)) {
-        auto* hypre_block = dynamic_cast<const mfem::HypreParMatrix*>(&block_operator.GetBlock(i, j));
-        SLIC_ERROR_ROOT_IF(!hypre_block,
-                           "Trying to use SuperLU on a block operator that does not contain HypreParMatrix blocks.");
+  for (hypre_CSRMatrix* block : {hypre_ParCSRMatrixDiag(parcsr), hypre_ParCSRMatrixOffd(parcsr)}) {
+    HYPRE_Int  rows = hypre_CSRMatrixNumRows(block);
+    HYPRE_Int  nnz  = hypre_CSRMatrixNumNonzeros(block);
+    HYPRE_Int* I    = hypre_CSRMatrixI(block);
+    HYPRE_Int* J    = hypre_CSRMatrixJ(block);
 
-        hypre_blocks(i, j) = hypre_block;
-      } else {
-        hypre_blocks(i, j) = nullptr;
-      }
+    hashCombine(fingerprint.hash, rows);
+    hashCombine(fingerprint.hash, nnz);
+    for (HYPRE_Int i = 0; I && i <= rows; i++) {
+      hashCombine(fingerprint.hash, I[i]);
+    }
+    for (HYPRE_Int k = 0; J && k < nnz; k++) {
+      hashCombine(fingerprint.hash, J[k]);
+    }
+    fingerprint.nonzeros += nnz;
+  }
+  fingerprint.rows += hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(parcsr));
+
+  // the global column indices of the off-diagonal part
+  HYPRE_BigInt* col_map_offd = hypre_ParCSRMatrixColMapOffd(parcsr);
+  HYPRE_Int     offd_cols    = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(parcsr));
+  for (HYPRE_Int k = 0; col_map_offd && k < offd_cols; k++) {
+    hashCombine(fingerprint.hash, col_map_offd[k]);
+  }
+}
+
+}  // namespace
+
+DirectSolver::DirectSolver(MPI_Comm comm, int max_factorization_reuse, double relative_tol, double absolute_tol)
+    : comm_(comm),
+      max_factorization_reuse_(max_factorization_reuse),
+      relative_tol_(relative_tol),
+      absolute_tol_(absolute_tol)
+{
+}
+
+void DirectSolver::Mult(const mfem::Vector& input, mfem::Vector& output) const
+{
+  SLIC_ERROR_ROOT_IF(!op_, axom::fmt::format("Operator must be set prior to solving with {}", name()));
+
+  if (stale_) {
+    if (refine(input, output)) {
+      return;
     }
+
+    // the earlier factorization is not a good enough preconditioner for the current operator
+    factorCurrentOperator();
   }
 
-  // Note that MFEM passes ownership of this matrix to the caller
-  return std::unique_ptr<mfem::HypreParMatrix>(mfem::HypreParMatrixFromBlocks(hypre_blocks));
+  // Use the underlying MFEM-based solver to solve the system
+  solve(input, output);
 }
 
-void SuperLUSolver::SetOperator(const mfem::Operator& op)
+void DirectSolver::SetOperator(const mfem::Operator& op)
 {
+  height = op.Height();
+  width  = op.Width();
+  op_    = &op;
+
   // Check if this is a block operator
   auto* block_operator = dynamic_cast<const mfem::BlockOperator*>(&op);
 
-  // If it is, make a monolithic system from the underlying blocks
+  // If it is, collect its HypreParMatrix blocks, which are only combined into a monolithic system when factored
   if (block_operator) {
-    auto monolithic_mat = buildMonolithicMatrix(*block_operator);
-
-    superlu_mat_ = std::make_unique<mfem::SuperLURowLocMatrix>(*monolithic_mat);
+    int row_blocks = block_operator->NumRowBlocks();
+    int col_blocks = block_operator->NumColBlocks();
+
+    SLIC_ERROR_ROOT_IF(row_blocks != col_blocks, "Attempted to use a direct solver on a non-square block system.");
+
+    blocks_.SetSize(row_blocks, col_blocks);
+
+    for (int i = 0; i < row_blocks; ++i) {
+      for (int j = 0; j < col_blocks; ++j) {
+        // checks for presence of empty (null) blocks, which happen fairly common in multirank contact
+        if (!block_operator->IsZeroBlock(i, j)) {
+          auto* hypre_block = dynamic_cast<const mfem::HypreParMatrix*>(&block_operator->GetBlock(i, j));
+          SLIC_ERROR_ROOT_IF(
+              !hypre_block,
+              axom::fmt::format("Trying to use {} on a block operator that does not contain HypreParMatrix blocks.",
+                                name()));
+
+          blocks_(i, j) = hypre_block;
+        } else {
+          blocks_(i, j) = nullptr;
+        }
+      }
+    }
   } else {
     // If this is not a block system, check that the input operator is a HypreParMatrix as expected
     auto* matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op);
 
-    SLIC_ERROR_ROOT_IF(!matrix, "Matrix must be an assembled HypreParMatrix for use with SuperLU");
+    SLIC_ERROR_ROOT_IF(!matrix,
+                       axom::fmt::format("Matrix must be an assembled HypreParMatrix for use with {}", name()));
 
-    superlu_mat_ = std::make_unique<mfem::SuperLURowLocMatrix>(*matrix);
+    blocks_.SetSize(1, 1);
+    blocks_(0, 0) = matrix;
   }
 
-  superlu_solver_.SetOperator(*superlu_mat_);
-}
+  // Compare the sparsity pattern against the previous operator's. The factorization is a collective
+  // operation, so the pattern is only considered unchanged if it is unchanged on every rank.
+  SparsityFingerprint fingerprint;
+  for (int i = 0; i < blocks_.NumRows(); ++i) {
+    for (int j = 0; j < blocks_.NumCols(); ++j) {
+      addToFingerprint(blocks_(i, j), fingerprint);
+    }
+  }
 
-#ifdef MFEM_USE_STRUMPACK
+  int same_pattern = (num_factorizations_ > 0) && (fingerprint == sparsity_fingerprint_);
+  MPI_Allreduce(MPI_IN_PLACE, &same_pattern, 1, MPI_INT, MPI_MIN, comm_);
+  same_pattern_         = same_pattern;
+  sparsity_fingerprint_ = fingerprint;
 
-void StrumpackSolver::Mult(const mfem::Vector& input, mfem::Vector& output) const
-{
-  SLIC_ERROR_ROOT_IF(!strumpack_mat_, "Operator must be set prior to solving with Strumpack");
+  if (same_pattern_ && operators_since_factorization_ < max_factorization_reuse_) {
+    // keep solving with the earlier factorization, see DirectSolver::refine
+    stale_ = true;
+    operators_since_factorization_++;
+    return;
+  }
 
-  // Use the underlying MFEM-based solver and Strumpack matrix type to solve the system
-  strumpack_solver_.Mult(input, output);
+  factorCurrentOperator();
 }
 
-void StrumpackSolver::SetOperator(const mfem::Operator& op)
+void DirectSolver::factorCurrentOperator() const
 {
-  // Check if this is a block operator
-  auto* block_operator = dynamic_cast<const mfem::BlockOperator*>(&op);
-
-  // If it is, make a monolithic system from the underlying blocks
-  if (block_operator) {
-    auto monolithic_mat = buildMonolithicMatrix(*block_operator);
-
-    strumpack_mat_ = std::make_unique<mfem::STRUMPACKRowLocMatrix>(*monolithic_mat);
+  if (auto* matrix = dynamic_cast<const mfem::HypreParMatrix*>(op_)) {
+    factor(*matrix, same_pattern_);
   } else {
-    // If this is not a block system, check that the input operator is a HypreParMatrix as expected
-    auto* matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+    // Note that MFEM passes ownership of this matrix to the caller
+    mfem::Array2D<const mfem::HypreParMatrix*> blocks = blocks_;
+    std::unique_ptr<mfem::HypreParMatrix>      monolithic_mat(mfem::HypreParMatrixFromBlocks(blocks));
 
-    SLIC_ERROR_ROOT_IF(!matrix, "Matrix must be an assembled HypreParMatrix for use with Strumpack");
+    factor(*monolithic_mat, same_pattern_);
+  }
 
-    strumpack_mat_ = std::make_unique<mfem::STRUMPACKRowLocMatrix>(*matrix);
+  num_factorizations_++;
+  if (!same_pattern_) {
+    num_symbolic_factorizations_++;
   }
 
-  strumpack_solver_.SetOperator(*strumpack_mat_);
+  stale_                         = false;
+  operators_since_factorization_ = 0;
 }
 
-#endif
-
-std::unique_ptr<mfem::NewtonSolver> buildNonlinearSolver(const NonlinearSolverOptions& nonlinear_opts,
-                                                         const LinearSolverOptions& linear_opts, mfem::Solver& prec,
-                                                         MPI_Comm comm)
+bool DirectSolver::refine(const mfem::Vector& input, mfem::Vector& output) const
+{
+  const double norm_goal = std::max(relative_tol_ * std::sqrt(mfem::InnerProduct(comm_, input, input)), absolute_tol_);
+
+  mfem::Vector residual(input);
+  mfem::Vector correction(input.Size());
+  output = 0.0;
+
+  for (int i = 0; i < max_refinement_iterations; i++) {
+    solve(residual, correction);
+    output += correction;
+
+    // r = b - A x, with the current operator
+    op_->Mult(output, residual);
+    mfem::subtract(input, residual, residual);
+
+    if (std::sqrt(mfem::InnerProduct(comm_, residual, residual)) <= norm_goal) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void SuperLUSolver::factor(const mfem::HypreParMatrix& matrix, bool same_pattern) const
+{
+  superlu_mat_ = std::make_unique<mfem::SuperLURowLocMatrix>(matrix);
+
+  superlu_solver_.SetOperator(*superlu_mat_);
+
+  // SuperLU computes the factorization in the first solve with the new matrix, which can reuse the
+  // column permutation of the previous one if the pattern is unchanged. This has to be requested
+  // after SetOperator, which resets the factorization options of the mfem::SuperLUSolver.
+  fact_ = same_pattern ? mfem::superlu::SamePattern : mfem::superlu::DOFACT;
+  superlu_solver_.SetFact(fact_);
+}
+
+void SuperLUSolver::solve(const mfem::Vector& input, mfem::Vector& output) const
+{
+  // Use the underlying MFEM-based solver and SuperLU matrix type to solve the system
+  superlu_solver_.Mult(input, output);
+}
+
+#ifdef MFEM_USE_STRUMPACK
+
+void StrumpackSolver::factor(const mfem::HypreParMatrix& matrix, bool same_pattern) const
+{
+  strumpack_mat_ = std::make_unique<mfem::STRUMPACKRowLocMatrix>(matrix);
+
+  // If the pattern is unchanged, Strumpack only updates the values of its matrix,
+  // and keeps the reordering and symbolic factorization of the previous one
+  strumpack_solver_.SetReorderingReuse(same_pattern);
+  strumpack_solver_.SetOperator(*strumpack_mat_);
+}
+
+void StrumpackSolver::solve(const mfem::Vector& input, mfem::Vector& output) const
+{
+  // Use the underlying MFEM-based solver and Strumpack matrix type to solve the system
+  strumpack_solver_.Mult(input, output);
+}
+
+#endif
+
+std::unique_ptr<mfem::NewtonSolver> buildNonlinearSolver(const NonlinearSolverOptions& nonlinear_opts,
+                                                         const LinearSolverOptions& linear_opts, mfem::Solver& prec,
+                                                         MPI_Comm comm)
 {
   std::unique_ptr<mfem::NewtonSolver> nonlinear_solver;
 
   if (nonlinear_opts.nonlin_solver == NonlinearSolver::Newton) {
     SLIC_ERROR_ROOT_IF(nonlinear_opts.min_iterations != 0 || nonlinear_opts.max_line_search_iterations != 0,
                        "Newton's method does not support nonzero min_iterations or max_line_search_iterations");
-    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts);
+    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts, linear_opts);
     // nonlinear_solver = std::make_unique<mfem::NewtonSolver>(comm);
   } else if (nonlinear_opts.nonlin_solver == NonlinearSolver::LBFGS) {
     SLIC_ERROR_ROOT_IF(nonlinear_opts.min_iterations != 0 || nonlinear_opts.max_line_search_iterations != 0,
                        "LBFGS does not support nonzero min_iterations or max_line_search_iterations");
     nonlinear_solver = std::make_unique<mfem::LBFGSSolver>(comm);
   } else if (nonlinear_opts.nonlin_solver == NonlinearSolver::NewtonLineSearch) {
-    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts);
+    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts, linear_opts);
   } else if (nonlinear_opts.nonlin_solver == NonlinearSolver::TrustRegion) {
     nonlinear_solver = std::make_unique<TrustRegion>(comm, nonlinear_opts, linear_opts, prec);
   }
@@ -843,17 +1567,29 @@ std::unique_ptr<mfem::NewtonSolver> buildNonlinearSolver(const NonlinearSolverOp
 std::pair<std::unique_ptr<mfem::Solver>, std::unique_ptr<mfem::Solver>> buildLinearSolverAndPreconditioner(
     LinearSolverOptions linear_opts, MPI_Comm comm)
 {
-  auto preconditioner = buildPreconditioner(linear_opts.preconditioner, linear_opts.preconditioner_print_level, comm);
+  std::unique_ptr<mfem::Solver> preconditioner;
+  if (linear_opts.mixed_precision && linear_opts.preconditioner == Preconditioner::HypreAMG) {
+    preconditioner = std::make_unique<SinglePrecisionAMG>(linear_opts.preconditioner_print_level);
+  } else {
+    // note: the direct solvers already refine the solutions of reused factorizations in double precision
+    SLIC_WARNING_ROOT_IF(linear_opts.mixed_precision,
+                         "Mixed precision is only supported for the HypreAMG preconditioner, using double precision");
+    preconditioner = buildPreconditioner(linear_opts.preconditioner, linear_opts.preconditioner_print_level, comm);
+  }
 
   if (linear_opts.linear_solver == LinearSolver::SuperLU) {
-    auto lin_solver = std::make_unique<SuperLUSolver>(linear_opts.print_level, comm);
+    auto lin_solver = std::make_unique<SuperLUSolver>(linear_opts.print_level, comm,
+                                                      linear_opts.max_factorization_reuse, linear_opts.relative_tol,
+                                                      linear_opts.absolute_tol);
     return {std::move(lin_solver), std::move(preconditioner)};
   }
 
 #ifdef MFEM_USE_STRUMPACK
 
   if (linear_opts.linear_solver == LinearSolver::Strumpack) {
-    auto lin_solver = std::make_unique<StrumpackSolver>(linear_opts.print_level, comm);
+    auto lin_solver = std::make_unique<StrumpackSolver>(linear_opts.print_level, comm,
+                                                        linear_opts.max_factorization_reuse, linear_opts.relative_tol,
+                                                        linear_opts.absolute_tol);
     return {std::move(lin_solver), std::move(preconditioner)};
   }
 
@@ -868,6 +1604,9 @@ std::pair<std::unique_ptr<mfem::Solver>, std::unique_ptr<mfem::Solver>> buildLin
     case LinearSolver::GMRES:
       iter_lin_solver = std::make_unique<mfem::GMRESSolver>(comm);
       break;
+    case LinearSolver::FGMRES:
+      iter_lin_solver = std::make_unique<mfem::FGMRESSolver>(comm);
+      break;
     default:
       SLIC_ERROR_ROOT("Linear solver type not recognized.");
       exitGracefully(true);
@@ -885,6 +1624,986 @@ std::pair<std::unique_ptr<mfem::Solver>, std::unique_ptr<mfem::Solver>> buildLin
   return {std::move(iter_lin_solver), std::move(preconditioner)};
 }
 
+std::vector<std::unique_ptr<mfem::HypreParVector>> rigidBodyModes(mfem::ParFiniteElementSpace& space)
+{
+  const int dim = space.GetParMesh()->SpaceDimension();
+
+  SLIC_ERROR_ROOT_IF(space.GetVDim() != dim,
+                     axom::fmt::format("Rigid body modes require a vector-valued space with {} components, got {}", dim,
+                                       space.GetVDim()));
+
+  std::vector<std::function<void(const mfem::Vector&, mfem::Vector&)>> modes;
+
+  for (int i = 0; i < dim; i++) {
+    modes.push_back([i](const mfem::Vector&, mfem::Vector& u) {
+      u    = 0.0;
+      u[i] = 1.0;
+    });
+  }
+
+  // infinitesimal rotations about each coordinate axis (only about z in 2D)
+  for (int axis = (dim == 2) ? 2 : 0; axis < 3; axis++) {
+    int j = (axis + 1) % 3;
+    int k = (axis + 2) % 3;
+    modes.push_back([j, k](const mfem::Vector& X, mfem::Vector& u) {
+      u    = 0.0;
+      u[j] = -X[k];
+      u[k] = X[j];
+    });
+  }
+
+  std::vector<std::unique_ptr<mfem::HypreParVector>> output;
+
+  mfem::ParGridFunction mode(&space);
+  for (auto& f : modes) {
+    mfem::VectorFunctionCoefficient coef(dim, f);
+    mode.ProjectCoefficient(coef);
+    output.emplace_back(mode.ParallelProject());
+  }
+
+  return output;
+}
+
+void BoomerAMG::setElasticityNearNullspace(mfem::ParFiniteElementSpace& space)
+{
+  components_ = space.GetParMesh()->SpaceDimension();
+
+  // the hierarchy of an operator that was set before is built without the new options, and a previous
+  // Newton step may have freed that operator, so the next operator has to be set before applying it
+  needs_operator_ = hierarchy_built_;
+
+  permutation_.reset();
+  if (space.GetOrdering() == mfem::Ordering::byNODES) {
+    // the permutation P maps byVDIM vectors to byNODES vectors: u_nodes = P u_vdim
+    const int nodes    = space.GetTrueVSize() / components_;
+    local_permutation_ = std::make_unique<mfem::SparseMatrix>(space.GetTrueVSize(), space.GetTrueVSize());
+    for (int n = 0; n < nodes; n++) {
+      for (int c = 0; c < components_; c++) {
+        local_permutation_->Set(c * nodes + n, n * components_ + c, 1.0);
+      }
+    }
+    local_permutation_->Finalize();
+
+    const int offsets = HYPRE_AssumedPartitionCheck() ? 2 : space.GetNRanks() + 1;
+    permutation_offsets_.SetSize(offsets);
+    std::copy(space.GetTrueDofOffsets(), space.GetTrueDofOffsets() + offsets, permutation_offsets_.begin());
+
+    permutation_ = std::make_unique<mfem::HypreParMatrix>(space.GetComm(), space.GlobalTrueVSize(),
+                                                          permutation_offsets_.GetData(), local_permutation_.get());
+  }
+
+  // the translations are already reproduced exactly by the systems interpolation,
+  // so hypre only needs the rotational modes
+  modes_ = rigidBodyModes(space);
+  modes_.erase(modes_.begin(), modes_.begin() + components_);
+  if (permutation_) {
+    for (auto& mode : modes_) {
+      auto permuted = std::make_unique<mfem::HypreParVector>(*permutation_);
+      permutation_->MultTranspose(*mode, *permuted);
+      mode = std::move(permuted);
+    }
+  }
+
+  hypre_modes_.clear();
+  for (auto& mode : modes_) {
+    hypre_modes_.push_back(static_cast<HYPRE_ParVector>(*mode));
+  }
+
+}
+
+void BoomerAMG::SetOperator(const mfem::Operator& op)
+{
+  auto* matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+  SLIC_ERROR_ROOT_IF(!matrix, "BoomerAMG requires an assembled (HypreParMatrix) operator");
+
+  if (permutation_) {
+    permuted_operator_.reset(mfem::RAP(matrix, permutation_.get()));
+    mfem::HypreBoomerAMG::SetOperator(*permuted_operator_);
+  } else {
+    permuted_operator_.reset();
+    mfem::HypreBoomerAMG::SetOperator(op);
+  }
+  hierarchy_built_ = true;
+  needs_operator_  = false;
+
+  memory_             = TrackedAllocation();
+  hierarchy_measured_ = false;
+  if (!modes_.empty()) {
+    applyNearNullspace();
+  }
+}
+
+void BoomerAMG::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(needs_operator_, "BoomerAMG::SetOperator() must be called after setElasticityNearNullspace()");
+
+  if (permuted_operator_) {
+    permuted_b_.SetSize(b.Size());
+    permuted_x_.SetSize(x.Size());
+    permutation_->MultTranspose(b, permuted_b_);
+    if (iterative_mode) {
+      permutation_->MultTranspose(x, permuted_x_);
+    } else {
+      permuted_x_ = 0.0;
+    }
+    mfem::HypreBoomerAMG::Mult(permuted_b_, permuted_x_);
+    permutation_->Mult(permuted_x_, x);
+  } else {
+    mfem::HypreBoomerAMG::Mult(b, x);
+  }
+
+  if (!hierarchy_measured_) {
+    // a permuted copy of the finest operator belongs to the preconditioner too
+    std::size_t bytes = hierarchyBytes();
+    if (permuted_operator_) {
+      bytes += memoryFootprint(*permuted_operator_);
+    }
+    memory_             = TrackedAllocation(MemoryCategory::AMG, bytes);
+    hierarchy_measured_ = true;
+  }
+}
+
+std::size_t BoomerAMG::hierarchyBytes() const
+{
+  HYPRE_Solver solver   = *this;
+  auto*        amg_data = reinterpret_cast<hypre_ParAMGData*>(solver);
+
+  int                  num_levels = hypre_ParAMGDataNumLevels(amg_data);
+  hypre_ParCSRMatrix** A          = hypre_ParAMGDataAArray(amg_data);
+  hypre_ParCSRMatrix** P          = hypre_ParAMGDataPArray(amg_data);
+
+  // the finest operator is owned by the caller, so only the coarse levels belong to the hierarchy
+  std::size_t bytes = 0;
+  for (int level = 0; level < num_levels; level++) {
+    if (level > 0 && A && A[level]) {
+      bytes += memoryFootprint(mfem::HypreParMatrix(A[level], false));
+    }
+    if (level < num_levels - 1 && P && P[level]) {
+      bytes += memoryFootprint(mfem::HypreParMatrix(P[level], false));
+    }
+  }
+  return bytes;
+}
+
+void BoomerAMG::applyNearNullspace()
+{
+  // the operator given to hypre is ordered byVDIM (see SetOperator), as nodal coarsening requires
+  SetSystemsOptions(components_, false);
+
+  // nodal coarsening, with the strength of the connection between two nodes measured by the row sum norm
+  // of their block (as in mfem::HypreBoomerAMG::SetElasticityOptions)
+  HYPRE_Solver solver = *this;
+  HYPRE_BoomerAMGSetNodal(solver, 4);
+  HYPRE_BoomerAMGSetNodalDiag(solver, 1);
+  HYPRE_BoomerAMGSetInterpVecVariant(solver, 2);
+  HYPRE_BoomerAMGSetInterpVecQMax(solver, 4);
+  HYPRE_BoomerAMGSetSmoothInterpVectors(solver, 1);
+  HYPRE_BoomerAMGSetInterpVectors(solver, static_cast<HYPRE_Int>(hypre_modes_.size()), hypre_modes_.data());
+}
+
+namespace {
+
+/**
+ * @brief Interpolate a smooth, non-polynomial probe function onto the true dofs of a nodal H1 space
+ *
+ * The true dofs of two spaces with the same nodes (in the same order) have the same interpolants, up to roundoff.
+ */
+mfem::Vector interpolateProbe(mfem::ParFiniteElementSpace& space)
+{
+  mfem::VectorFunctionCoefficient probe(space.GetVDim(), [](const mfem::Vector& X, mfem::Vector& f) {
+    double value = 0.0;
+    for (int d = 0; d < X.Size(); d++) {
+      value += std::sin(1.3 * (d + 1) * X[d] + 0.1 * d);
+    }
+    for (int c = 0; c < f.Size(); c++) {
+      f[c] = value + c;
+    }
+  });
+
+  mfem::ParGridFunction interpolant(&space);
+  interpolant.ProjectCoefficient(probe);
+
+  mfem::Vector true_dofs(space.GetTrueVSize());
+  interpolant.GetTrueDofs(true_dofs);
+  return true_dofs;
+}
+
+}  // namespace
+
+/// @brief a coefficient that is constant on each element of the high-order mesh, and on its refinements
+class LORPreconditioner::ElementCoefficient : public mfem::Coefficient {
+public:
+  /**
+   * @brief Construct a coefficient with the value @a value on every element
+   *
+   * @param mesh The high-order mesh
+   * @param parents The element of @a mesh that each element of the refined mesh belongs to
+   * @param value The initial value of the coefficient
+   */
+  ElementCoefficient(const mfem::ParMesh& mesh, const mfem::Array<int>& parents, double value)
+      : values(mesh.GetNE()), mesh_(mesh), parents_(parents)
+  {
+    values = value;
+  }
+
+  /// @overload
+  double Eval(mfem::ElementTransformation& T, const mfem::IntegrationPoint&) override
+  {
+    // the legacy LOR assembly evaluates the coefficient on the refined mesh, and the batched one on the high-order mesh
+    return values[(T.mesh == &mesh_) ? T.ElementNo : parents_[T.ElementNo]];
+  }
+
+  /// @brief the value of the coefficient on each element of the high-order mesh
+  mfem::Vector values;
+
+private:
+  /// @brief the high-order mesh
+  const mfem::ParMesh& mesh_;
+
+  /// @brief the element of the high-order mesh that each element of the refined mesh belongs to
+  const mfem::Array<int>& parents_;
+};
+
+LORPreconditioner::LORPreconditioner(int print_level) { amg_.SetPrintLevel(print_level); }
+
+LORPreconditioner::~LORPreconditioner() = default;
+
+void LORPreconditioner::setSpace(mfem::ParFiniteElementSpace& space,
+                                 std::function<const mfem::Array<int>&()> essential_dofs,
+                                 ElementMatrixSource                      element_matrices)
+{
+  auto* h1 = dynamic_cast<const mfem::H1_FECollection*>(space.FEColl());
+  SLIC_ERROR_ROOT_IF(!h1 || h1->GetBasisType() != mfem::BasisType::GaussLobatto,
+                     "The LOR preconditioner requires an H1 space with a Gauss-Lobatto basis");
+
+  const int components = space.GetVDim();
+
+  lor_              = std::make_unique<mfem::ParLORDiscretization>(space);
+  auto& lor_space   = lor_->GetParFESpace();
+  essential_dofs_   = std::move(essential_dofs);
+  element_matrices_ = std::move(element_matrices);
+  assembled_        = false;
+
+  // the vertices of the refined mesh are the nodes of the high-order space, so each true dof of the
+  // high-order space must be the true dof of the low-order space at the same node (and component)
+  int same_dofs = (lor_space.GetMyTDofOffset() == space.GetMyTDofOffset()) &&
+                  (lor_space.GetTrueVSize() == space.GetTrueVSize());
+  if (same_dofs) {
+    mfem::Vector mismatch = interpolateProbe(lor_space);
+    mismatch -= interpolateProbe(space);
+    same_dofs = mismatch.Normlinf() < 1.0e-10;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &same_dofs, 1, MPI_INT, MPI_MIN, space.GetComm());
+  SLIC_ERROR_ROOT_IF(!same_dofs, "The true dofs of the LOR space don't correspond to those of the high-order space");
+
+  auto& mesh       = *space.GetParMesh();
+  auto& lor_mesh   = *lor_space.GetParMesh();
+  auto& refinement = lor_mesh.GetRefinementTransforms();
+  parents_.SetSize(lor_mesh.GetNE());
+  for (int e = 0; e < lor_mesh.GetNE(); e++) {
+    parents_[e] = refinement.embeddings[e].parent;
+  }
+
+  // the element matrices are matched with their elements by their dofs
+  elements_.clear();
+  if (element_matrices_) {
+    mfem::Array<int> vdofs;
+    for (int e = 0; e < space.GetNE(); e++) {
+      space.GetElementVDofs(e, vdofs);
+      std::vector<int> key(vdofs.begin(), vdofs.end());
+      std::sort(key.begin(), key.end());
+      elements_[key] = e;
+    }
+  }
+
+  // unit (diffusion or Lame) coefficients and no mass, until they are fitted to an operator
+  coefficients_.clear();
+  for (double value : (components == 1) ? std::vector<double>{1.0, 0.0} : std::vector<double>{1.0, 1.0, 0.0}) {
+    coefficients_.push_back(std::make_unique<ElementCoefficient>(mesh, parents_, value));
+  }
+
+  model_ = std::make_unique<mfem::ParBilinearForm>(&space);
+  if (components == 1) {
+    model_->AddDomainIntegrator(new mfem::DiffusionIntegrator(*coefficients_[0]));
+    model_->AddDomainIntegrator(new mfem::MassIntegrator(*coefficients_[1]));
+  } else {
+    model_->AddDomainIntegrator(new mfem::ElasticityIntegrator(*coefficients_[0], *coefficients_[1]));
+    model_->AddDomainIntegrator(new mfem::VectorMassIntegrator(*coefficients_[2]));
+  }
+
+  if (components > 1 && components == mesh.SpaceDimension()) {
+    amg_.setElasticityNearNullspace(space);
+  }
+}
+
+void LORPreconditioner::fitModel()
+{
+  auto&      space        = *model_->ParFESpace();
+  const int  num_elements = space.GetNE();
+  const int  n            = static_cast<int>(coefficients_.size());
+  const bool scalar       = space.GetVDim() == 1;
+
+  // the element matrices of the model with a unit value of each coefficient (and zero for the others)
+  mfem::ConstantCoefficient                                  one(1.0);
+  mfem::ConstantCoefficient                                  zero(0.0);
+  std::vector<std::unique_ptr<mfem::BilinearFormIntegrator>> unit_models;
+  if (scalar) {
+    unit_models.emplace_back(new mfem::DiffusionIntegrator(one));
+    unit_models.emplace_back(new mfem::MassIntegrator(one));
+  } else {
+    unit_models.emplace_back(new mfem::ElasticityIntegrator(one, zero));
+    unit_models.emplace_back(new mfem::ElasticityIntegrator(zero, one));
+    unit_models.emplace_back(new mfem::VectorMassIntegrator(one));
+  }
+
+  std::vector<mfem::DenseMatrix> unit_matrices(static_cast<std::size_t>(n));
+  auto                           assemble_unit_matrices = [&](int e) {
+    for (std::size_t k = 0; k < unit_matrices.size(); k++) {
+      unit_models[k]->AssembleElementMatrix(*space.GetFE(e), *space.GetElementTransformation(e), unit_matrices[k]);
+    }
+  };
+
+  // the (Frobenius) inner products of the element matrices of the operator with those of the unit models,
+  // summed over the integrals of each element
+  mfem::DenseMatrix projections(num_elements, n);
+  projections = 0.0;
+
+  mfem::Array<int> vdofs;
+  std::vector<int> key;
+  std::vector<int> position;
+  element_matrices_([&](const mfem::Array<int>& rows, const mfem::Array<int>& columns, const mfem::DenseMatrix& K) {
+    key.assign(rows.begin(), rows.end());
+    std::sort(key.begin(), key.end());
+    auto found = elements_.find(key);
+
+    // boundary integrals (and couplings to other fields) aren't part of the model
+    if (found == elements_.end() || rows.Size() != columns.Size() ||
+        !std::equal(rows.begin(), rows.end(), columns.begin())) {
+      return;
+    }
+
+    const int e = found->second;
+    space.GetElementVDofs(e, vdofs);
+    position.resize(static_cast<std::size_t>(rows.Size()));
+    for (int i = 0; i < rows.Size(); i++) {
+      position[static_cast<std::size_t>(i)] = vdofs.Find(rows[i]);
+    }
+
+    assemble_unit_matrices(e);
+    for (int k = 0; k < n; k++) {
+      const auto& B   = unit_matrices[static_cast<std::size_t>(k)];
+      double      sum = 0.0;
+      for (int j = 0; j < K.Width(); j++) {
+        for (int i = 0; i < K.Height(); i++) {
+          sum += K(i, j) * B(position[static_cast<std::size_t>(i)], position[static_cast<std::size_t>(j)]);
+        }
+      }
+      projections(e, k) += sum;
+    }
+  });
+
+  // the least-squares fit of each element matrix by the unit models
+  mfem::DenseMatrix gram(n);
+  mfem::Vector      rhs(n);
+  mfem::Vector      fit(n);
+  for (int e = 0; e < num_elements; e++) {
+    assemble_unit_matrices(e);
+    for (int k = 0; k < n; k++) {
+      const auto& B_k = unit_matrices[static_cast<std::size_t>(k)];
+      for (int l = 0; l <= k; l++) {
+        gram(k, l) = gram(l, k) = B_k * unit_matrices[static_cast<std::size_t>(l)];
+      }
+      rhs(k) = projections(e, k);
+    }
+    mfem::DenseMatrixInverse inverse(gram);
+    inverse.Mult(rhs, fit);
+    for (int k = 0; k < n; k++) {
+      coefficients_[static_cast<std::size_t>(k)]->values[e] = fit(k);
+    }
+  }
+
+  // the fit of an indefinite or degenerate element (e.g. one without a domain integral) is made positive: the
+  // stiffness (diffusion or mu) is kept above a small fraction of its largest value, and the others nonnegative
+  auto&  stiffness     = coefficients_[scalar ? 0 : 1]->values;
+  double max_stiffness = (num_elements > 0) ? stiffness.Max() : 0.0;
+  MPI_Allreduce(MPI_IN_PLACE, &max_stiffness, 1, MPI_DOUBLE, MPI_MAX, space.GetComm());
+  const double min_stiffness = (max_stiffness > 0.0) ? 1.0e-6 * max_stiffness : 1.0;
+  for (int e = 0; e < num_elements; e++) {
+    for (auto& coefficient : coefficients_) {
+      coefficient->values[e] = std::max(coefficient->values[e], 0.0);
+    }
+    stiffness[e] = std::max(stiffness[e], min_stiffness);
+  }
+}
+
+void LORPreconditioner::SetOperator(const mfem::Operator& op)
+{
+  SLIC_ERROR_ROOT_IF(!lor_, "LORPreconditioner::setSpace() must be called before LORPreconditioner::SetOperator()");
+  SLIC_ERROR_ROOT_IF(op.Height() != lor_->GetParFESpace().GetTrueVSize(),
+                     "LORPreconditioner::setSpace() must be called with the space of the operator");
+
+  height = op.Height();
+  width  = op.Width();
+
+  const mfem::Array<int>  no_dofs;
+  const mfem::Array<int>& essential_dofs = essential_dofs_ ? essential_dofs_() : no_dofs;
+
+  // without element matrices, the low-order operator only depends on the essential dofs (on every rank)
+  int unchanged = !element_matrices_ && assembled_ && essential_dofs.Size() == eliminated_dofs_.Size() &&
+                  std::equal(essential_dofs.begin(), essential_dofs.end(), eliminated_dofs_.begin());
+  MPI_Allreduce(MPI_IN_PLACE, &unchanged, 1, MPI_INT, MPI_MIN, lor_->GetParFESpace().GetComm());
+  if (unchanged) {
+    return;
+  }
+
+  if (element_matrices_) {
+    fitModel();
+  }
+
+  essential_dofs.Copy(eliminated_dofs_);
+  lor_->AssembleSystem(*model_, eliminated_dofs_);
+  assembled_ = true;
+
+  auto& lor_operator = lor_->GetAssembledMatrix();
+  memory_            = TrackedAllocation(MemoryCategory::SparseMatrix, memoryFootprint(lor_operator));
+  amg_.SetOperator(lor_operator);
+}
+
+void LORPreconditioner::Mult(const mfem::Vector& b, mfem::Vector& x) const { amg_.Mult(b, x); }
+
+const mfem::HypreParMatrix& LORPreconditioner::lowOrderOperator() const
+{
+  SLIC_ERROR_ROOT_IF(!assembled_, "The LOR preconditioner has no operator yet");
+  return lor_->GetAssembledMatrix();
+}
+
+const mfem::Vector& LORPreconditioner::modelCoefficient(int i) const
+{
+  SLIC_ERROR_ROOT_IF(i < 0 || i >= static_cast<int>(coefficients_.size()), "The model has no such coefficient");
+  return coefficients_[static_cast<std::size_t>(i)]->values;
+}
+
+namespace {
+
+/**
+ * @brief Assemble the interpolation between two H1 spaces on the same mesh, with the same number of components
+ *
+ * @param coarse The (lower-order) space being interpolated from
+ * @param fine The (higher-order) space being interpolated to
+ * @return The interpolation, as a map between the local dofs of the spaces, without its (round-off) zero entries
+ */
+std::unique_ptr<mfem::SparseMatrix> assembleInterpolation(mfem::ParFiniteElementSpace& coarse,
+                                                          mfem::ParFiniteElementSpace& fine)
+{
+  // the weights of the coarse basis functions that vanish at a fine node are only zero up to round-off
+  constexpr double zero_tolerance = 1.0e-12;
+
+  // mfem's discrete interpolators only support scalar-valued spaces,
+  // so each component is interpolated with the scalar interpolation
+  mfem::ParFiniteElementSpace  coarse_scalar(coarse.GetParMesh(), coarse.FEColl());
+  mfem::ParFiniteElementSpace  fine_scalar(fine.GetParMesh(), fine.FEColl());
+  mfem::DiscreteLinearOperator interpolation(&coarse_scalar, &fine_scalar);
+  interpolation.AddDomainInterpolator(new mfem::IdentityInterpolator());
+  interpolation.Assemble();
+  interpolation.Finalize();
+
+  const mfem::SparseMatrix& scalar = interpolation.SpMat();
+  auto                      local  = std::make_unique<mfem::SparseMatrix>(fine.GetVSize(), coarse.GetVSize());
+  for (int c = 0; c < fine.GetVDim(); c++) {
+    for (int i = 0; i < scalar.Height(); i++) {
+      for (int k = scalar.GetI()[i]; k < scalar.GetI()[i + 1]; k++) {
+        if (std::abs(scalar.GetData()[k]) > zero_tolerance) {
+          local->Set(fine.DofToVDof(i, c), coarse.DofToVDof(scalar.GetJ()[k], c), scalar.GetData()[k]);
+        }
+      }
+    }
+  }
+  local->Finalize();
+  return local;
+}
+
+/**
+ * @brief Form the interpolation between the true dofs of two spaces from the one between their local dofs
+ */
+std::unique_ptr<mfem::HypreParMatrix> assembleProlongation(mfem::ParFiniteElementSpace& coarse,
+                                                           mfem::ParFiniteElementSpace& fine,
+                                                           const mfem::SparseMatrix&    interpolation)
+{
+  // keep the rows of the true dofs of the fine space (as in mfem::ParDiscreteLinearOperator::ParallelAssemble)
+  std::unique_ptr<mfem::SparseMatrix> restricted(mfem::Mult(*fine.GetRestrictionMatrix(), interpolation));
+  return std::unique_ptr<mfem::HypreParMatrix>(
+      coarse.Dof_TrueDof_Matrix()->LeftDiagMult(*restricted, fine.GetTrueDofOffsets()));
+}
+
+/**
+ * @brief The essential true dofs of a coarse space, i.e. those interpolating to an essential true dof of a finer one
+ *
+ * @param coarse The coarse space
+ * @param fine The fine space
+ * @param interpolation The interpolation between the local dofs of the spaces
+ * @param fine_essential_dofs The essential true dofs of the fine space
+ */
+mfem::Array<int> coarseEssentialDofs(mfem::ParFiniteElementSpace& coarse, mfem::ParFiniteElementSpace& fine,
+                                     const mfem::SparseMatrix& interpolation,
+                                     const mfem::Array<int>&   fine_essential_dofs)
+{
+  // mark the local copies of the fine essential dofs (including those owned by other ranks)
+  mfem::Vector fine_true_marker(fine.GetTrueVSize());
+  mfem::Vector fine_local_marker(fine.GetVSize());
+  fine_true_marker = 0.0;
+  fine_true_marker.SetSubVector(fine_essential_dofs, 1.0);
+  fine.GetProlongationMatrix()->Mult(fine_true_marker, fine_local_marker);
+
+  mfem::Array<int> local_marker(coarse.GetVSize());
+  local_marker = 0;
+  for (int i = 0; i < interpolation.Height(); i++) {
+    if (fine_local_marker[i] != 0.0) {
+      for (int k = interpolation.GetI()[i]; k < interpolation.GetI()[i + 1]; k++) {
+        local_marker[interpolation.GetJ()[k]] = -1;
+      }
+    }
+  }
+  coarse.Synchronize(local_marker);
+
+  mfem::Array<int> true_marker(coarse.GetTrueVSize());
+  mfem::Array<int> essential_dofs;
+  coarse.GetRestrictionMatrix()->BooleanMult(local_marker, true_marker);
+  mfem::FiniteElementSpace::MarkerToList(true_marker, essential_dofs);
+  return essential_dofs;
+}
+
+}  // namespace
+
+class PMultigridPreconditioner::ElementOperator : public mfem::Operator {
+public:
+  /// @brief an operator on the true dofs of @a space, without element matrices yet
+  explicit ElementOperator(mfem::ParFiniteElementSpace& space)
+      : mfem::Operator(space.GetTrueVSize()), space_(space), x_local_(space.GetVSize()), y_local_(space.GetVSize())
+  {
+  }
+
+  /// @brief add the element matrix of the local dofs @a dofs
+  void add(const mfem::Array<int>& dofs, const mfem::DenseMatrix& matrix)
+  {
+    dofs_.push_back(dofs);
+    matrices_.push_back(matrix);
+    bytes_ += sizeof(int) * std::size_t(dofs.Size()) + sizeof(double) * std::size_t(matrix.Height() * matrix.Width());
+  }
+
+  /// @brief apply the sum of the element matrices, on the true dofs
+  void Mult(const mfem::Vector& x, mfem::Vector& y) const override
+  {
+    space_.GetProlongationMatrix()->Mult(x, x_local_);
+    y_local_ = 0.0;
+    for (std::size_t e = 0; e < matrices_.size(); e++) {
+      x_local_.GetSubVector(dofs_[e], x_element_);
+      y_element_.SetSize(matrices_[e].Height());
+      matrices_[e].Mult(x_element_, y_element_);
+      y_local_.AddElementVector(dofs_[e], y_element_);
+    }
+    space_.GetProlongationMatrix()->MultTranspose(y_local_, y);
+  }
+
+  /// @brief the diagonal of the operator, on the true dofs (exact for conforming meshes)
+  void assembleDiagonal(mfem::Vector& diagonal) const
+  {
+    y_local_ = 0.0;
+    for (std::size_t e = 0; e < matrices_.size(); e++) {
+      for (int i = 0; i < dofs_[e].Size(); i++) {
+        y_local_[dofs_[e][i]] += matrices_[e](i, i);
+      }
+    }
+    diagonal.SetSize(height);
+    space_.GetProlongationMatrix()->MultTranspose(y_local_, diagonal);
+  }
+
+  /// @brief assemble the operator on the true dofs
+  std::unique_ptr<mfem::HypreParMatrix> assemble() const
+  {
+    mfem::SparseMatrix local(space_.GetVSize());
+    for (std::size_t e = 0; e < matrices_.size(); e++) {
+      local.AddSubMatrix(dofs_[e], dofs_[e], matrices_[e]);
+    }
+    local.Finalize();
+
+    mfem::HypreParMatrix A(space_.GetComm(), space_.GlobalVSize(), space_.GetDofOffsets(), &local);
+    return std::unique_ptr<mfem::HypreParMatrix>(mfem::RAP(&A, space_.Dof_TrueDof_Matrix()));
+  }
+
+  /**
+   * @brief add the Galerkin products P^T K P of the element matrices to the operator of a coarser level
+   *
+   * @param interpolation The interpolation from the local dofs of the coarser level
+   * @param coarse The operator of the coarser level
+   */
+  void coarsen(const mfem::SparseMatrix& interpolation, ElementOperator& coarse) const
+  {
+    mfem::Array<int>  coarse_dofs;
+    mfem::DenseMatrix P, K;
+    for (std::size_t e = 0; e < matrices_.size(); e++) {
+      const mfem::Array<int>& fine_dofs = dofs_[e];
+
+      // the coarse dofs of the element are the ones that interpolate to its fine dofs
+      coarse_dofs.SetSize(0);
+      for (int i = 0; i < fine_dofs.Size(); i++) {
+        for (int k = interpolation.GetI()[fine_dofs[i]]; k < interpolation.GetI()[fine_dofs[i] + 1]; k++) {
+          coarse_dofs.Append(interpolation.GetJ()[k]);
+        }
+      }
+      coarse_dofs.Sort();
+      coarse_dofs.Unique();
+
+      P.SetSize(fine_dofs.Size(), coarse_dofs.Size());
+      P = 0.0;
+      for (int i = 0; i < fine_dofs.Size(); i++) {
+        for (int k = interpolation.GetI()[fine_dofs[i]]; k < interpolation.GetI()[fine_dofs[i] + 1]; k++) {
+          P(i, coarse_dofs.FindSorted(interpolation.GetJ()[k])) = interpolation.GetData()[k];
+        }
+      }
+
+      mfem::RAP(matrices_[e], P, K);
+      coarse.add(coarse_dofs, K);
+    }
+  }
+
+  /// @brief the size of the element matrices (and their dofs), in bytes
+  std::size_t bytes() const { return bytes_; }
+
+private:
+  /// @brief the space of the operator
+  mfem::ParFiniteElementSpace& space_;
+
+  /// @brief the local dofs of the rows and columns of each element matrix
+  std::vector<mfem::Array<int>> dofs_;
+
+  /// @brief the element matrices
+  std::vector<mfem::DenseMatrix> matrices_;
+
+  /// @brief the size of the element matrices, in bytes
+  std::size_t bytes_ = 0;
+
+  /// @brief work vectors on the local dofs and on an element
+  mutable mfem::Vector x_local_, y_local_, x_element_, y_element_;
+};
+
+PMultigridPreconditioner::PMultigridPreconditioner(int print_level, int smoother_order)
+    : smoother_order_(smoother_order)
+{
+  SLIC_ERROR_ROOT_IF(smoother_order_ < 1, "The p-multigrid smoothers must have an order of at least 1");
+  amg_.SetPrintLevel(print_level);
+}
+
+PMultigridPreconditioner::~PMultigridPreconditioner() = default;
+
+void PMultigridPreconditioner::setSpace(mfem::ParFiniteElementSpace&             space,
+                                        std::function<const mfem::Array<int>&()> essential_dofs,
+                                        ElementMatrixSource                      element_matrices)
+{
+  const int order = space.GetMaxElementOrder();
+  const int dim   = space.GetParMesh()->Dimension();
+
+  SLIC_ERROR_ROOT_IF(!dynamic_cast<const mfem::H1_FECollection*>(space.FEColl()),
+                     "The p-multigrid preconditioner requires an H1 space");
+  SLIC_ERROR_ROOT_IF(!element_matrices,
+                     "The p-multigrid preconditioner requires the element matrices of its operators");
+
+  essential_dofs_   = std::move(essential_dofs);
+  element_matrices_ = std::move(element_matrices);
+
+  // the spaces of the coarse levels (the finest level is the given space)
+  levels_.clear();
+  levels_.resize(static_cast<std::size_t>(order));
+  for (std::size_t level = 0; level + 1 < levels_.size(); level++) {
+    levels_[level].collection  = std::make_unique<mfem::H1_FECollection>(int(level) + 1, dim);
+    levels_[level].owned_space = std::make_unique<mfem::ParFiniteElementSpace>(
+        space.GetParMesh(), levels_[level].collection.get(), space.GetVDim(), space.GetOrdering());
+    levels_[level].space = levels_[level].owned_space.get();
+  }
+  levels_.back().space = &space;
+
+  for (std::size_t level = 1; level < levels_.size(); level++) {
+    Level& fine        = levels_[level];
+    Level& coarse      = levels_[level - 1];
+    fine.interpolation = assembleInterpolation(*coarse.space, *fine.space);
+    fine.prolongation  = assembleProlongation(*coarse.space, *fine.space, *fine.interpolation);
+  }
+
+  if (space.GetVDim() > 1 && space.GetVDim() == space.GetParMesh()->SpaceDimension()) {
+    amg_.setElasticityNearNullspace(*levels_.front().space);
+  }
+}
+
+void PMultigridPreconditioner::coarsen()
+{
+  Level& finest = levels_.back();
+
+  finest.element_operator = std::make_unique<ElementOperator>(*finest.space);
+  element_matrices_([&finest](const mfem::Array<int>& rows, const mfem::Array<int>& columns,
+                              const mfem::DenseMatrix& matrix) {
+    bool square = (rows.Size() == columns.Size());
+    for (int i = 0; square && i < rows.Size(); i++) {
+      square = (rows[i] == columns[i]);
+    }
+    SLIC_ERROR_IF(!square, "The p-multigrid preconditioner requires element matrices of a single space");
+    finest.element_operator->add(rows, matrix);
+  });
+
+  if (essential_dofs_) {
+    finest.essential_dofs = essential_dofs_();
+  } else {
+    finest.essential_dofs.DeleteAll();
+  }
+
+  for (std::size_t level = levels_.size() - 1; level > 0; level--) {
+    Level& fine   = levels_[level];
+    Level& coarse = levels_[level - 1];
+
+    coarse.element_operator = std::make_unique<ElementOperator>(*coarse.space);
+    fine.element_operator->coarsen(*fine.interpolation, *coarse.element_operator);
+    coarse.essential_dofs = coarseEssentialDofs(*coarse.space, *fine.space, *fine.interpolation, fine.essential_dofs);
+  }
+}
+
+void PMultigridPreconditioner::SetOperator(const mfem::Operator& op)
+{
+  SLIC_ERROR_ROOT_IF(levels_.empty(), "PMultigridPreconditioner::setSpace() must be called before SetOperator()");
+  SLIC_ERROR_ROOT_IF(op.Height() != levels_.back().space->GetTrueVSize(),
+                     "PMultigridPreconditioner::setSpace() must be called with the space of the operator");
+
+  height = op.Height();
+  width  = op.Width();
+
+  coarsen();
+
+  std::size_t bytes = 0;
+  for (std::size_t level = 0; level < levels_.size(); level++) {
+    Level& current = levels_[level];
+    bytes += current.element_operator->bytes();
+
+    if (level == 0) {
+      // only the p = 1 operator is assembled, with the identity on its essential rows and columns
+      current.assembled_operator = current.element_operator->assemble();
+      std::unique_ptr<mfem::HypreParMatrix> eliminated(
+          current.assembled_operator->EliminateRowsCols(current.essential_dofs));
+      current.op = current.assembled_operator.get();
+      bytes += memoryFootprint(*current.assembled_operator);
+    } else if (level + 1 < levels_.size()) {
+      current.constrained_operator =
+          std::make_unique<mfem::ConstrainedOperator>(current.element_operator.get(), current.essential_dofs);
+      current.op = current.constrained_operator.get();
+    } else {
+      current.op = &op;
+    }
+
+    if (level > 0) {
+      current.element_operator->assembleDiagonal(current.diagonal);
+      current.diagonal.SetSubVector(current.essential_dofs, 1.0);
+      current.smoother = std::make_unique<mfem::OperatorChebyshevSmoother>(
+          *current.op, current.diagonal, current.essential_dofs, smoother_order_, current.space->GetComm());
+      current.smoother->iterative_mode = true;
+      current.residual.SetSize(current.op->Height());
+    }
+
+    current.rhs.SetSize(current.op->Height());
+    current.solution.SetSize(current.op->Height());
+  }
+
+  // the element matrices of the finest level are only needed to form the coarse levels
+  bytes -= levels_.back().element_operator->bytes();
+  levels_.back().element_operator.reset();
+
+  memory_ = TrackedAllocation(MemoryCategory::SparseMatrix, bytes);
+  amg_.SetOperator(*levels_.front().assembled_operator);
+}
+
+void PMultigridPreconditioner::setFinestOperator(const mfem::Operator& op)
+{
+  SLIC_ERROR_ROOT_IF(levels_.empty() || !levels_.front().op,
+                     "PMultigridPreconditioner::SetOperator() must be called before setFinestOperator()");
+  SLIC_ERROR_ROOT_IF(op.Height() != height, "The new finest operator must have the size of the previous one");
+
+  // a single (p = 1) level is assembled, and doesn't refer to the operator
+  if (levels_.size() == 1) {
+    return;
+  }
+
+  // the diagonal of the previous operator is still a good estimate for the Chebyshev smoother
+  Level& finest   = levels_.back();
+  finest.op       = &op;
+  finest.smoother = std::make_unique<mfem::OperatorChebyshevSmoother>(
+      op, finest.diagonal, finest.essential_dofs, smoother_order_, finest.space->GetComm());
+  finest.smoother->iterative_mode = true;
+}
+
+void PMultigridPreconditioner::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(levels_.empty() || !levels_.front().op, "The p-multigrid preconditioner has no operator yet");
+  cycle(levels_.size() - 1, b, x);
+}
+
+void PMultigridPreconditioner::cycle(std::size_t level, const mfem::Vector& b, mfem::Vector& x) const
+{
+  if (level == 0) {
+    amg_.Mult(b, x);
+    return;
+  }
+
+  const Level& fine   = levels_[level];
+  const Level& coarse = levels_[level - 1];
+
+  // pre-smoothing
+  x = 0.0;
+  fine.smoother->Mult(b, x);
+
+  // coarse grid correction, which vanishes on the essential dofs
+  fine.op->Mult(x, fine.residual);
+  subtract(b, fine.residual, fine.residual);
+  fine.prolongation->MultTranspose(fine.residual, coarse.rhs);
+  coarse.rhs.SetSubVector(coarse.essential_dofs, 0.0);
+  cycle(level - 1, coarse.rhs, coarse.solution);
+  fine.prolongation->AddMult(coarse.solution, x);
+
+  // post-smoothing
+  fine.smoother->Mult(b, x);
+}
+
+const mfem::Operator& PMultigridPreconditioner::levelOperator(int level) const
+{
+  SLIC_ERROR_ROOT_IF(level < 0 || level >= numLevels() || !levels_[std::size_t(level)].op,
+                     axom::fmt::format("The p-multigrid preconditioner has no operator on level {}", level));
+  return *levels_[std::size_t(level)].op;
+}
+
+const mfem::HypreParMatrix& PMultigridPreconditioner::coarsestOperator() const
+{
+  SLIC_ERROR_ROOT_IF(levels_.empty() || !levels_.front().assembled_operator,
+                     "The p-multigrid preconditioner has no operator yet");
+  return *levels_.front().assembled_operator;
+}
+
+const mfem::HypreParMatrix& PMultigridPreconditioner::prolongation(int level) const
+{
+  SLIC_ERROR_ROOT_IF(level < 0 || level + 1 >= numLevels(),
+                     axom::fmt::format("The p-multigrid preconditioner has no prolongation from level {}", level));
+  return *levels_[std::size_t(level) + 1].prolongation;
+}
+
+BlockSchurPreconditioner::BlockSchurPreconditioner(int print_level)
+{
+  displacement_amg_.SetPrintLevel(print_level);
+  schur_amg_.SetPrintLevel(print_level);
+}
+
+void BlockSchurPreconditioner::setElasticityNearNullspace(mfem::ParFiniteElementSpace& space)
+{
+  displacement_amg_.setElasticityNearNullspace(space);
+}
+
+void BlockSchurPreconditioner::SetOperator(const mfem::Operator& op)
+{
+  height = op.Height();
+  width  = op.Width();
+
+  auto* block_operator = dynamic_cast<const mfem::BlockOperator*>(&op);
+  if (!block_operator) {
+    constraint_ = nullptr;
+    schur_.reset();
+    memory_ = TrackedAllocation();
+    displacement_amg_.SetOperator(op);
+    return;
+  }
+
+  SLIC_ERROR_ROOT_IF(block_operator->NumRowBlocks() != 2 || block_operator->NumColBlocks() != 2,
+                     "The block Schur complement preconditioner requires a 2x2 block operator");
+
+  auto block = [block_operator](int i, int j) -> const mfem::HypreParMatrix* {
+    if (block_operator->IsZeroBlock(i, j)) {
+      return nullptr;
+    }
+    auto* matrix = dynamic_cast<const mfem::HypreParMatrix*>(&block_operator->GetBlock(i, j));
+    SLIC_ERROR_ROOT_IF(!matrix, "The block Schur complement preconditioner requires HypreParMatrix blocks");
+    return matrix;
+  };
+
+  const mfem::HypreParMatrix* K        = block(0, 0);
+  const mfem::HypreParMatrix* inactive = block(1, 1);
+  constraint_                          = block(1, 0);
+  SLIC_ERROR_ROOT_IF(!K || !constraint_,
+                     "The block Schur complement preconditioner requires displacement and constraint blocks");
+
+  offsets_.SetSize(3);
+  offsets_[0] = 0;
+  offsets_[1] = K->Height();
+  offsets_[2] = op.Height();
+
+  const int num_constraints = offsets_[2] - offsets_[1];
+  constraint_residual_.SetSize(num_constraints);
+
+  displacement_amg_.SetOperator(*K);
+
+  // B diag(K)^{-1} B^T
+  mfem::Vector K_diagonal(K->Height());
+  K->GetDiag(K_diagonal);
+  std::unique_ptr<mfem::HypreParMatrix> scaled_transpose(constraint_->Transpose());
+  scaled_transpose->InvScaleRows(K_diagonal);
+  schur_.reset(mfem::ParMult(constraint_, scaled_transpose.get(), true));
+
+  // add D, and ones on the diagonal of constraints that don't involve any (unconstrained) displacements
+  mfem::Vector D_diagonal(num_constraints);
+  mfem::Vector schur_diagonal(num_constraints);
+  D_diagonal = 0.0;
+  if (inactive) {
+    inactive->GetDiag(D_diagonal);
+  }
+  schur_->GetDiag(schur_diagonal);
+
+  signs_.SetSize(num_constraints);
+  mfem::SparseMatrix diagonal(num_constraints);
+  for (int i = 0; i < num_constraints; i++) {
+    if (D_diagonal(i) != 0.0 || schur_diagonal(i) == 0.0) {
+      signs_(i) = 1.0;
+      diagonal.Set(i, i, (D_diagonal(i) != 0.0) ? D_diagonal(i) : 1.0);
+    } else {
+      signs_(i) = -1.0;
+    }
+  }
+  diagonal.Finalize();
+
+  // note: this matrix references (but does not copy) the arrays of the local diagonal
+  mfem::HypreParMatrix diagonal_matrix(schur_->GetComm(), schur_->GetGlobalNumRows(), schur_->RowPart(), &diagonal);
+  schur_.reset(mfem::Add(1.0, *schur_, 1.0, diagonal_matrix));
+
+  memory_ = TrackedAllocation(MemoryCategory::SparseMatrix, memoryFootprint(*schur_));
+  schur_amg_.SetOperator(*schur_);
+}
+
+void BlockSchurPreconditioner::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  if (!constraint_) {
+    displacement_amg_.Mult(b, x);
+    return;
+  }
+
+  const int num_displacements = offsets_[1];
+  const int num_constraints   = offsets_[2] - offsets_[1];
+
+  // b should not change in this method; the const cast is to create vector views of its blocks
+  auto&              b_const = const_cast<mfem::Vector&>(b);
+  const mfem::Vector b_u(b_const, 0, num_displacements);
+  const mfem::Vector b_p(b_const, num_displacements, num_constraints);
+  mfem::Vector       x_u(x, 0, num_displacements);
+  mfem::Vector       x_p(x, num_displacements, num_constraints);
+
+  // forward substitution with the block lower-triangular factor | K  0 |
+  //                                                             | B  S |
+  displacement_amg_.Mult(b_u, x_u);
+
+  constraint_->Mult(x_u, constraint_residual_);
+  subtract(b_p, constraint_residual_, constraint_residual_);
+  constraint_residual_ *= signs_;
+  schur_amg_.Mult(constraint_residual_, x_p);
+}
+
 #ifdef MFEM_USE_AMGX
 std::unique_ptr<mfem::AmgXSolver> buildAMGX(const AMGXOptions& options, const MPI_Comm comm)
 {
@@ -947,7 +2666,7 @@ std::unique_ptr<mfem::Solver> buildPreconditioner(Preconditioner preconditioner,
 
   // Handle the preconditioner - currently just BoomerAMG and HypreSmoother are supported
   if (preconditioner == Preconditioner::HypreAMG) {
-    auto amg_preconditioner = std::make_unique<mfem::HypreBoomerAMG>();
+    auto amg_preconditioner = std::make_unique<BoomerAMG>();
     amg_preconditioner->SetPrintLevel(print_level);
     preconditioner_solver = std::move(amg_preconditioner);
   } else if (preconditioner == Preconditioner::HypreJacobi) {
@@ -967,6 +2686,13 @@ std::unique_ptr<mfem::Solver> buildPreconditioner(Preconditioner preconditioner,
     ilu_preconditioner->SetLevelOfFill(1);
     ilu_preconditioner->SetPrintLevel(print_level);
     preconditioner_solver = std::move(ilu_preconditioner);
+  } else if (preconditioner == Preconditioner::LOR) {
+    // note: the space of the operator is given to these preconditioners by the physics module
+    preconditioner_solver = std::make_unique<LORPreconditioner>(print_level);
+  } else if (preconditioner == Preconditioner::PMultigrid) {
+    preconditioner_solver = std::make_unique<PMultigridPreconditioner>(print_level);
+  } else if (preconditioner == Preconditioner::BlockSchur) {
+    preconditioner_solver = std::make_unique<BlockSchurPreconditioner>(print_level);
   } else if (preconditioner == Preconditioner::AMGX) {
 #ifdef MFEM_USE_AMGX
     preconditioner_solver = buildAMGX(AMGXOptions{}, comm);
@@ -1002,12 +2728,28 @@ void EquationSolver::defineInputFileSchema(axom::inlet::Container& container)
   iterative_container.addDouble("abs_tol", "Absolute tolerance for the linear solve.").defaultValue(1.0e-8);
   iterative_container.addInt("max_iter", "Maximum iterations for the linear solve.").defaultValue(5000);
   iterative_container.addInt("print_level", "Linear print level.").defaultValue(0);
-  iterative_container.addString("solver_type", "Solver type (gmres|minres|cg).").defaultValue("gmres");
-  iterative_container.addString("prec_type", "Preconditioner type (JacobiSmoother|L1JacobiSmoother|AMG|ILU).")
+  iterative_container.addString("solver_type", "Solver type (gmres|fgmres|cg).").defaultValue("gmres");
+  iterative_container
+      .addString("prec_type",
+                 "Preconditioner type (JacobiSmoother|L1JacobiSmoother|AMG|ILU|LOR|PMultigrid|BlockSchur).")
       .defaultValue("JacobiSmoother");
+  iterative_container
+      .addBool("mixed_precision", "Store and apply the (HypreAMG) preconditioner in single precision.")
+      .defaultValue(false);
+  iterative_container
+      .addBool("reuse_preconditioner", "Keep the preconditioner for later Jacobians, until it becomes stale.")
+      .defaultValue(false);
+  iterative_container
+      .addDouble("max_iteration_growth",
+                 "Growth of the linear iterations which makes a reused preconditioner stale, and rebuilt.")
+      .defaultValue(2.0);
 
   auto& direct_container = linear_container.addStruct("direct_options", "Direct solver parameters");
   direct_container.addInt("print_level", "Linear print level.").defaultValue(0);
+  direct_container
+      .addInt("max_factorization_reuse",
+              "Number of matrices to solve with an earlier factorization (as a preconditioner) before refactoring.")
+      .defaultValue(0);
 
   // Only needed for nonlinear problems
   auto& nonlinear_container = container.addStruct("nonlinear", "Newton Equation Solver Parameters").required(false);
@@ -1016,6 +2758,9 @@ void EquationSolver::defineInputFileSchema(axom::inlet::Container& container)
   nonlinear_container.addInt("max_iter", "Maximum iterations for the Newton solve.").defaultValue(500);
   nonlinear_container.addInt("print_level", "Nonlinear print level.").defaultValue(0);
   nonlinear_container.addString("solver_type", "Solver type (Newton|KINFullStep|KINLineSearch)").defaultValue("Newton");
+  nonlinear_container
+      .addString("forcing_term", "Relative tolerance of the linear solves (Fixed|EisenstatWalker1|EisenstatWalker2)")
+      .defaultValue("Fixed");
 }
 
 }  // namespace serac
@@ -1030,19 +2775,25 @@ serac::LinearSolverOptions FromInlet<serac::LinearSolverOptions>::operator()(con
   std::string         type = base["type"];
 
   if (type == "direct") {
-    options.linear_solver = serac::LinearSolver::SuperLU;
-    options.print_level   = base["direct_options/print_level"];
+    options.linear_solver           = serac::LinearSolver::SuperLU;
+    options.print_level             = base["direct_options/print_level"];
+    options.max_factorization_reuse = base["direct_options/max_factorization_reuse"];
     return options;
   }
 
   auto config             = base["iterative_options"];
-  options.relative_tol    = config["rel_tol"];
-  options.absolute_tol    = config["abs_tol"];
-  options.max_iterations  = config["max_iter"];
-  options.print_level     = config["print_level"];
-  std::string solver_type = config["solver_type"];
+  options.relative_tol         = config["rel_tol"];
+  options.absolute_tol         = config["abs_tol"];
+  options.max_iterations       = config["max_iter"];
+  options.print_level          = config["print_level"];
+  options.mixed_precision      = config["mixed_precision"];
+  options.reuse_preconditioner = config["reuse_preconditioner"];
+  options.max_iteration_growth = config["max_iteration_growth"];
+  std::string solver_type      = config["solver_type"];
   if (solver_type == "gmres") {
     options.linear_solver = serac::LinearSolver::GMRES;
+  } else if (solver_type == "fgmres") {
+    options.linear_solver = serac::LinearSolver::FGMRES;
   } else if (solver_type == "cg") {
     options.linear_solver = serac::LinearSolver::CG;
   } else {
@@ -1058,6 +2809,12 @@ serac::LinearSolverOptions FromInlet<serac::LinearSolverOptions>::operator()(con
     options.preconditioner = serac::Preconditioner::HypreAMG;
   } else if (prec_type == "ILU") {
     options.preconditioner = serac::Preconditioner::HypreILU;
+  } else if (prec_type == "LOR") {
+    options.preconditioner = serac::Preconditioner::LOR;
+  } else if (prec_type == "PMultigrid") {
+    options.preconditioner = serac::Preconditioner::PMultigrid;
+  } else if (prec_type == "BlockSchur") {
+    options.preconditioner = serac::Preconditioner::BlockSchur;
 #ifdef MFEM_USE_AMGX
   } else if (prec_type == "AMGX") {
     options.preconditioner = serac::Preconditioner::AMGX;
@@ -1091,6 +2848,16 @@ serac::NonlinearSolverOptions FromInlet<serac::NonlinearSolverOptions>::operator
   } else {
     SLIC_ERROR_ROOT(axom::fmt::format("Unknown nonlinear solver type given: '{0}'", solver_type));
   }
+  const std::string forcing_term = base["forcing_term"];
+  if (forcing_term == "Fixed") {
+    options.forcing_term = serac::ForcingTerm::Fixed;
+  } else if (forcing_term == "EisenstatWalker1") {
+    options.forcing_term = serac::ForcingTerm::EisenstatWalker1;
+  } else if (forcing_term == "EisenstatWalker2") {
+    options.forcing_term = serac::ForcingTerm::EisenstatWalker2;
+  } else {
+    SLIC_ERROR_ROOT(axom::fmt::format("Unknown forcing term given: '{0}'", forcing_term));
+  }
   return options;
 }
 
@@ -1103,6 +2870,7 @@ serac::EquationSolver FromInlet<serac::EquationSolver>::operator()(const axom::i
 
   serac::EquationSolver eq_solver(serac::buildNonlinearSolver(nonlin, lin, *preconditioner, MPI_COMM_WORLD),
                                   std::move(linear_solver), std::move(preconditioner));
+  eq_solver.reusePreconditioner(lin.reuse_preconditioner, lin.max_iteration_growth);
 
   return eq_solver;
 }
@@ -12,17 +12,88 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <variant>
+#include <vector>
 
 #include "mfem.hpp"
 
 #include "serac/infrastructure/input.hpp"
+#include "serac/infrastructure/memory.hpp"
+#include "serac/numerics/functional/element_matrices.hpp"
 #include "serac/numerics/solver_config.hpp"
 
 namespace serac {
 
+/**
+ * @brief Counters and timers describing the work done by an EquationSolver
+ *
+ * The times are wall-clock times (in seconds) on the calling rank.
+ */
+struct SolverStatistics {
+  /// @brief the number of calls to EquationSolver::solve
+  int nonlinear_solves = 0;
+
+  /// @brief the total number of nonlinear (e.g. Newton) iterations
+  int nonlinear_iterations = 0;
+
+  /// @brief the number of linear solves
+  int linear_solves = 0;
+
+  /// @brief the total number of iterations of the linear solver (zero for direct solvers)
+  int linear_iterations = 0;
+
+  /// @brief the number of evaluations of the residual, F(x)
+  int residual_evaluations = 0;
+
+  /// @brief the number of evaluations (and assemblies) of the Jacobian, dF/dx
+  int jacobian_evaluations = 0;
+
+  /// @brief the number of times the preconditioner was built for a new Jacobian
+  int preconditioner_setups = 0;
+
+  /// @brief the number of Jacobians which kept an earlier preconditioner (see EquationSolver::reusePreconditioner)
+  int preconditioner_reuses = 0;
+
+  /// @brief the total time spent in EquationSolver::solve
+  double nonlinear_solve_time = 0.0;
+
+  /// @brief the time spent evaluating the residual
+  double residual_time = 0.0;
+
+  /// @brief the time spent evaluating and assembling the Jacobian
+  double assembly_time = 0.0;
+
+  /// @brief the time spent setting up the linear solver for a new Jacobian (e.g. building a preconditioner)
+  double linear_setup_time = 0.0;
+
+  /// @brief the time spent in linear solves
+  double linear_solve_time = 0.0;
+
+  /// @brief the statistics, keyed by their names (e.g. to be recorded as solver diagnostics)
+  std::map<std::string, double> diagnostics() const
+  {
+    return {{"nonlinear_solves", nonlinear_solves},
+            {"nonlinear_iterations", nonlinear_iterations},
+            {"linear_solves", linear_solves},
+            {"linear_iterations", linear_iterations},
+            {"residual_evaluations", residual_evaluations},
+            {"jacobian_evaluations", jacobian_evaluations},
+            {"preconditioner_setups", preconditioner_setups},
+            {"preconditioner_reuses", preconditioner_reuses},
+            {"nonlinear_solve_time", nonlinear_solve_time},
+            {"residual_time", residual_time},
+            {"assembly_time", assembly_time},
+            {"linear_setup_time", linear_setup_time},
+            {"linear_solve_time", linear_solve_time}};
+  }
+};
+
 /**
  * @brief This class manages the objects typically required to solve a nonlinear set of equations arising from
  * discretization of a PDE of the form F(x) = 0. Specifically, it has
@@ -80,6 +151,52 @@ public:
    */
   void solve(mfem::Vector& x) const;
 
+  /**
+   * @brief Sets whether the following solves reuse the most recent Jacobian (and linear solver setup)
+   *
+   * When enabled, each solve starts with the Jacobian assembled by the previous solve (a modified Newton method),
+   * and only reassembles it once an iteration fails to reduce the residual norm by the factor
+   * NonlinearSolverOptions::jacobian_reuse_reduction (half, by default). This is intended for repeated solves of
+   * slowly changing problems, e.g. the passes of an iterated multiphysics coupling, where the Jacobian passed to the
+   * previous solve must still be alive.
+   *
+   * @param[in] reuse Whether to reuse the Jacobian
+   * @note This has no effect on nonlinear solvers other than Newton and NewtonLineSearch
+   */
+  void reuseJacobian(bool reuse);
+
+  /**
+   * @brief Sets whether the preconditioner of an iterative linear solver is kept for later Jacobians
+   *
+   * When enabled, the preconditioner built for one Jacobian is used for the following ones (across Newton iterations
+   * and timesteps), as long as it stays effective. It becomes stale once a linear solve fails to converge, or takes
+   * more than @a max_iteration_growth times the iterations of the first solve with it, and is then rebuilt for the
+   * next Jacobian. It is also rebuilt when the size or the essential dofs (see @a setEssentialDofs) of the Jacobian
+   * change. Preconditioners that apply the Jacobian they were built for (e.g. the finest level of AMG) keep a copy of
+   * it, so they are only reused for assembled Jacobians. The p-multigrid preconditioner instead keeps its coarse
+   * levels, and gives its finest level each new Jacobian, which doesn't have to be assembled.
+   *
+   * @param[in] reuse Whether to reuse the preconditioner
+   * @param[in] max_iteration_growth The growth of the linear iterations that makes the preconditioner stale
+   * @note The number of (re)builds and reuses are recorded in @a statistics()
+   */
+  void reusePreconditioner(bool reuse, double max_iteration_growth = 2.0);
+
+  /**
+   * @brief Sets where the essential dofs of the Jacobians come from, so a reused preconditioner is rebuilt when they
+   * change (e.g. for a new set of boundary conditions)
+   *
+   * @param[in] essential_dofs Provides the (local) essential true dofs of the next Jacobian
+   */
+  void setEssentialDofs(std::function<const mfem::Array<int>&()> essential_dofs);
+
+  /**
+   * @brief Rebuilds the preconditioner for the next Jacobian, even if it is being reused and isn't stale
+   *
+   * This is intended for known changes to the problem, e.g. a new contact configuration or a large change of timestep.
+   */
+  void rebuildPreconditioner();
+
   /**
    * Returns the underlying solver object
    * @return A non-owning reference to the underlying nonlinear solver
@@ -114,6 +231,17 @@ public:
    */
   const mfem::Solver& preconditioner() const { return *preconditioner_; }
 
+  /**
+   * @brief Returns the work done by this solver since the statistics were last reset
+   * @note Only the work done through @a setOperator and @a solve is recorded
+   */
+  const SolverStatistics& statistics() const { return *statistics_; }
+
+  /**
+   * @brief Sets all of the counters and timers of @a statistics() to zero
+   */
+  void resetStatistics() { *statistics_ = SolverStatistics{}; }
+
   /**
    * Input file parameters specific to this class
    **/
@@ -141,19 +269,188 @@ private:
    * before SetSolver
    */
   bool nonlin_solver_set_solver_called_ = false;
+
+  /**
+   * @brief The work done by this solver
+   * @note This is heap-allocated so that its address (which @a instrumented_op_ and @a instrumented_lin_solver_
+   * refer to) doesn't change when the EquationSolver is moved
+   */
+  std::unique_ptr<SolverStatistics> statistics_ = std::make_unique<SolverStatistics>();
+
+  /**
+   * @brief The operator given to the nonlinear solver, which forwards to the operator passed to @a setOperator
+   * and records its evaluations in @a statistics_
+   */
+  std::unique_ptr<mfem::Operator> instrumented_op_;
+
+  /**
+   * @brief The linear solver given to the nonlinear solver, which forwards to @a lin_solver_ and records its
+   * solves in @a statistics_
+   */
+  std::unique_ptr<mfem::Solver> instrumented_lin_solver_;
+
+  /**
+   * @brief The preconditioner given to an iterative linear solver, which forwards to @a preconditioner_, and
+   * decides whether it is rebuilt for each new Jacobian
+   */
+  std::unique_ptr<mfem::Solver> reusable_preconditioner_;
+};
+
+/**
+ * @brief The logic shared by the wrappers over MFEM's sparse direct solvers
+ *
+ * Serac's Jacobians keep their sparsity pattern across Newton iterations and timesteps, so this class
+ * detects when a new operator has the same pattern as the previous one and lets the underlying solver
+ * reuse its fill-reducing ordering and symbolic factorization, only recomputing the numeric factorization.
+ *
+ * Optionally, a factorization can be reused unchanged for the next few operators, as the preconditioner
+ * of an iterative refinement with the new operator. If the refinement doesn't converge, the new operator
+ * is factored after all.
+ */
+class DirectSolver : public mfem::Solver {
+public:
+  /**
+   * @brief Constructs a direct solver
+   * @param[in] comm The MPI communicator used by the vectors and matrices in the solve
+   * @param[in] max_factorization_reuse The number of operators which may be solved with the factorization of an
+   * earlier operator, before refactoring
+   * @param[in] relative_tol The relative tolerance of the iterative refinement with an earlier factorization
+   * @param[in] absolute_tol The absolute tolerance of the iterative refinement with an earlier factorization
+   */
+  DirectSolver(MPI_Comm comm, int max_factorization_reuse = 0, double relative_tol = 1.0e-8,
+               double absolute_tol = 1.0e-12);
+
+  /**
+   * @brief Solve the linear system y = Op^{-1} x
+   *
+   * @param input The input RHS vector
+   * @param output The output solution vector
+   */
+  void Mult(const mfem::Vector& input, mfem::Vector& output) const override;
+
+  /**
+   * @brief Set the underlying matrix operator to use in the solution algorithm
+   *
+   * @param op The matrix operator to factorize
+   * @pre This operator must be an assembled HypreParMatrix or a BlockOperator
+   * with all blocks either null or HypreParMatrixs
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /// @brief The number of numeric factorizations computed so far
+  int numFactorizations() const { return num_factorizations_; }
+
+  /// @brief The number of factorizations which had to compute a new ordering and symbolic factorization
+  int numSymbolicFactorizations() const { return num_symbolic_factorizations_; }
+
+  /// @brief The maximum number of iterative refinement steps with the factorization of an earlier operator
+  static constexpr int max_refinement_iterations = 10;
+
+  /**
+   * @brief A compact summary of the sparsity pattern of an operator on this rank: its numbers of rows and
+   * nonzeros, and a hash of the sizes, offsets, and CSR structure of its blocks
+   */
+  struct SparsityFingerprint {
+    /// @brief The number of local rows
+    HYPRE_BigInt rows = 0;
+
+    /// @brief The number of local nonzeros, in the diagonal and off-diagonal parts
+    HYPRE_BigInt nonzeros = 0;
+
+    /// @brief The hash of the sparsity pattern
+    std::uint64_t hash = 14695981039346656037ull;
+
+    /// @brief Whether two fingerprints are (almost certainly) of the same sparsity pattern
+    bool operator==(const SparsityFingerprint& other) const
+    {
+      return rows == other.rows && nonzeros == other.nonzeros && hash == other.hash;
+    }
+  };
+
+protected:
+  /**
+   * @brief Factor a matrix with the underlying solver
+   *
+   * @param matrix The (monolithic) matrix to factor
+   * @param same_pattern Whether @a matrix has the same sparsity pattern as the previously factored matrix
+   */
+  virtual void factor(const mfem::HypreParMatrix& matrix, bool same_pattern) const = 0;
+
+  /**
+   * @brief Solve with the most recent factorization
+   *
+   * @param input The input RHS vector
+   * @param output The output solution vector
+   */
+  virtual void solve(const mfem::Vector& input, mfem::Vector& output) const = 0;
+
+  /// @brief The name of the underlying solver, for error messages
+  virtual std::string name() const = 0;
+
+private:
+  /// @brief Factor the current operator, building a monolithic matrix from its blocks if necessary
+  void factorCurrentOperator() const;
+
+  /**
+   * @brief Try to solve with the current operator using iterative refinement with the most recent factorization
+   * @return Whether the refinement converged
+   */
+  bool refine(const mfem::Vector& input, mfem::Vector& output) const;
+
+  /// @brief The MPI communicator used by the vectors and matrices in the solve
+  MPI_Comm comm_;
+
+  /// @brief The number of operators which may be solved with the factorization of an earlier operator
+  int max_factorization_reuse_;
+
+  /// @brief The relative tolerance of the iterative refinement
+  double relative_tol_;
+
+  /// @brief The absolute tolerance of the iterative refinement
+  double absolute_tol_;
+
+  /// @brief The current operator
+  const mfem::Operator* op_ = nullptr;
+
+  /// @brief The HypreParMatrix blocks of the current operator, in row-major order (null for empty blocks)
+  mfem::Array2D<const mfem::HypreParMatrix*> blocks_;
+
+  /// @brief The fingerprint of the sparsity pattern of the current operator
+  SparsityFingerprint sparsity_fingerprint_;
+
+  /// @brief Whether the current operator has the same sparsity pattern as the previous one
+  bool same_pattern_ = false;
+
+  /// @brief Whether the most recent factorization is of an earlier operator
+  mutable bool stale_ = false;
+
+  /// @brief The number of operators set since the most recent factorization
+  mutable int operators_since_factorization_ = 0;
+
+  /// @brief The number of numeric factorizations computed so far
+  mutable int num_factorizations_ = 0;
+
+  /// @brief The number of factorizations which had to compute a new ordering and symbolic factorization
+  mutable int num_symbolic_factorizations_ = 0;
 };
 
 /**
  * @brief A wrapper class for using the MFEM SuperLU solver with a HypreParMatrix
  */
-class SuperLUSolver : public mfem::Solver {
+class SuperLUSolver : public DirectSolver {
 public:
   /**
    * @brief Constructs a wrapper over an mfem::SuperLUSolver
    * @param[in] comm The MPI communicator used by the vectors and matrices in the solve
    * @param[in] print_level The verbosity level for the mfem::SuperLUSolver
+   * @param[in] max_factorization_reuse The number of operators which may be solved with the factorization of an
+   * earlier operator, before refactoring
+   * @param[in] relative_tol The relative tolerance of the iterative refinement with an earlier factorization
+   * @param[in] absolute_tol The absolute tolerance of the iterative refinement with an earlier factorization
    */
-  SuperLUSolver(int print_level, MPI_Comm comm) : superlu_solver_(comm)
+  SuperLUSolver(int print_level, MPI_Comm comm, int max_factorization_reuse = 0, double relative_tol = 1.0e-8,
+                double absolute_tol = 1.0e-12)
+      : DirectSolver(comm, max_factorization_reuse, relative_tol, absolute_tol), superlu_solver_(comm)
   {
     superlu_solver_.SetColumnPermutation(mfem::superlu::PARMETIS);
     if (print_level == 0) {
@@ -162,24 +459,25 @@ public:
   }
 
   /**
-   * @brief Factor and solve the linear system y = Op^{-1} x using DSuperLU
-   *
-   * @param input The input RHS vector
-   * @param output The output solution vector
+   * @brief The factorization option requested from SuperLU for the most recently factored matrix: DOFACT for a
+   * new ordering and symbolic factorization, or SamePattern to reuse the column permutation of the previous one
    */
-  void Mult(const mfem::Vector& input, mfem::Vector& output) const;
+  mfem::superlu::Fact factorizationOption() const { return fact_; }
 
-  /**
-   * @brief Set the underlying matrix operator to use in the solution algorithm
-   *
-   * @param op The matrix operator to factorize with SuperLU
-   * @pre This operator must be an assembled HypreParMatrix or a BlockOperator
-   * with all blocks either null or HypreParMatrixs for compatibility with
-   * SuperLU
-   */
-  void SetOperator(const mfem::Operator& op);
+protected:
+  /// @brief Factor @a matrix with SuperLU, reusing its column permutation if the sparsity pattern is unchanged
+  void factor(const mfem::HypreParMatrix& matrix, bool same_pattern) const override;
+
+  /// @brief Solve with the SuperLU factorization
+  void solve(const mfem::Vector& input, mfem::Vector& output) const override;
+
+  /// @brief The name of the underlying solver, for error messages
+  std::string name() const override { return "SuperLU"; }
 
 private:
+  /// @brief The factorization option requested from SuperLU for the most recently factored matrix
+  mutable mfem::superlu::Fact fact_ = mfem::superlu::DOFACT;
+
   /**
    * @brief The owner of the SuperLU matrix for the gradient, stored
    * as a member variable for lifetime purposes
@@ -191,21 +489,27 @@ private:
    * SuperLU matrix type which we store in this object. This enables compatibility
    * with HypreParMatrix when used as an input.
    */
-  mfem::SuperLUSolver superlu_solver_;
+  mutable mfem::SuperLUSolver superlu_solver_;
 };
 
 #ifdef MFEM_USE_STRUMPACK
 /**
  * @brief A wrapper class for using the MFEM Strumpack solver with a HypreParMatrix
  */
-class StrumpackSolver : public mfem::Solver {
+class StrumpackSolver : public DirectSolver {
 public:
   /**
    * @brief Constructs a wrapper over an mfem::STRUMPACKSolver
    * @param[in] comm The MPI communicator used by the vectors and matrices in the solve
    * @param[in] print_level The verbosity level for the mfem::STRUMPACKSolver
+   * @param[in] max_factorization_reuse The number of operators which may be solved with the factorization of an
+   * earlier operator, before refactoring
+   * @param[in] relative_tol The relative tolerance of the iterative refinement with an earlier factorization
+   * @param[in] absolute_tol The absolute tolerance of the iterative refinement with an earlier factorization
    */
-  StrumpackSolver(int print_level, MPI_Comm comm) : strumpack_solver_(comm)
+  StrumpackSolver(int print_level, MPI_Comm comm, int max_factorization_reuse = 0, double relative_tol = 1.0e-8,
+                  double absolute_tol = 1.0e-12)
+      : DirectSolver(comm, max_factorization_reuse, relative_tol, absolute_tol), strumpack_solver_(comm)
   {
     strumpack_solver_.SetKrylovSolver(strumpack::KrylovSolver::DIRECT);
     strumpack_solver_.SetReorderingStrategy(strumpack::ReorderingStrategy::METIS);
@@ -216,21 +520,15 @@ public:
     }
   }
 
-  /**
-   * @brief Factor and solve the linear system y = Op^{-1} x using Strumpack
-   *
-   * @param input The input RHS vector
-   * @param output The output solution vector
-   */
-  void Mult(const mfem::Vector& input, mfem::Vector& output) const;
+protected:
+  /// @brief Factor @a matrix with Strumpack, reusing the symbolic factorization if the sparsity pattern is unchanged
+  void factor(const mfem::HypreParMatrix& matrix, bool same_pattern) const override;
 
-  /**
-   * @brief Set the underlying matrix operator to use in the solution algorithm
-   *
-   * @param op The matrix operator to factorize with Strumpack
-   * @pre This operator must be an assembled HypreParMatrix for compatibility with Strumpack
-   */
-  void SetOperator(const mfem::Operator& op);
+  /// @brief Solve with the Strumpack factorization
+  void solve(const mfem::Vector& input, mfem::Vector& output) const override;
+
+  /// @brief The name of the underlying solver, for error messages
+  std::string name() const override { return "Strumpack"; }
 
 private:
   /**
@@ -244,7 +542,7 @@ private:
    * Strumpack matrix type which we store in this object. This enables compatibility
    * with HypreParMatrix when used as an input.
    */
-  mfem::STRUMPACKSolver strumpack_solver_;
+  mutable mfem::STRUMPACKSolver strumpack_solver_;
 };
 
 #endif
@@ -283,6 +581,484 @@ std::pair<std::unique_ptr<mfem::Solver>, std::unique_ptr<mfem::Solver>> buildLin
 std::unique_ptr<mfem::Solver> buildPreconditioner(Preconditioner preconditioner, int print_level = 0,
                                                   [[maybe_unused]] MPI_Comm comm = MPI_COMM_WORLD);
 
+/**
+ * @brief Compute the rigid body modes of a vector-valued H1 space from its nodal coordinates
+ *
+ * The first `dim` modes are the unit translations, followed by the infinitesimal rotations
+ * (one in 2D, three in 3D).
+ *
+ * @param space The vector-valued finite element space (e.g. a displacement field)
+ * @return The rigid body modes, as true dof vectors
+ */
+std::vector<std::unique_ptr<mfem::HypreParVector>> rigidBodyModes(mfem::ParFiniteElementSpace& space);
+
+/**
+ * @brief A BoomerAMG preconditioner that can use the rigid body modes of an elasticity problem as a near-nullspace
+ *
+ * This uses nodal coarsening, where the displacement components of each node are coarsened together, and hypre's
+ * "global matrix" (GM) interpolation to augment the systems interpolation with the rotational modes, which the
+ * systems interpolation cannot represent on its own.
+ *
+ * hypre's nodal coarsening requires the components of each node to be interleaved (byVDIM), so operators in the
+ * byNODES ordering used by serac are permuted to byVDIM before they are passed to hypre, and the vectors of each
+ * application are permuted accordingly. Unlike mfem::HypreBoomerAMG::SetElasticityOptions, this does not enable the
+ * interpolation refinement that segfaults in some hypre versions.
+ */
+class BoomerAMG : public mfem::HypreBoomerAMG {
+public:
+  /**
+   * @brief Use the rigid body modes of @a space as the near-nullspace of subsequent operators
+   *
+   * @param space The displacement space of the elasticity problem
+   * @note The options only take effect with the next call to SetOperator
+   */
+  void setElasticityNearNullspace(mfem::ParFiniteElementSpace& space);
+
+  /**
+   * @brief Set the operator, re-applying the near-nullspace options
+   *
+   * @note mfem::HypreBoomerAMG recreates the underlying hypre object whenever the operator changes,
+   * which discards the systems and interpolation vector options.
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief The permutation P from the ordering of hypre's hierarchy to the ordering of the operator, if they differ
+   *
+   * The finest level of the hierarchy is P^T A P, where A is the operator.
+   *
+   * @return The permutation, or nullptr if the hierarchy uses the ordering of the operator
+   */
+  const mfem::HypreParMatrix* permutation() const { return permutation_.get(); }
+
+  using mfem::HypreBoomerAMG::Mult;
+
+  /**
+   * @brief Apply the preconditioner, recording the size of the multigrid hierarchy the first time it is
+   * applied to a new operator (which is when hypre builds the hierarchy)
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief The size (in bytes) of the coarse-level operators and the interpolation operators on this rank
+   *
+   * @note hypre only builds the hierarchy in the first application of the preconditioner to a new operator
+   */
+  std::size_t hierarchyBytes() const;
+
+private:
+  /// @brief pass the systems options and interpolation vectors to hypre
+  void applyNearNullspace();
+
+  /// @brief the number of displacement components
+  int components_ = 0;
+
+  /// @brief the rotational rigid body modes, in the ordering of hypre's hierarchy
+  std::vector<std::unique_ptr<mfem::HypreParVector>> modes_;
+
+  /// @brief the local block of the permutation from byVDIM to byNODES, for byNODES spaces
+  std::unique_ptr<mfem::SparseMatrix> local_permutation_;
+
+  /// @brief the partitioning of the rows of the permutation
+  mfem::Array<HYPRE_BigInt> permutation_offsets_;
+
+  /// @brief the permutation from byVDIM to byNODES, for byNODES spaces
+  std::unique_ptr<mfem::HypreParMatrix> permutation_;
+
+  /// @brief the operator in the byVDIM ordering, for byNODES spaces
+  std::unique_ptr<mfem::HypreParMatrix> permuted_operator_;
+
+  /// @brief the right hand side and solution of an application in the byVDIM ordering, for byNODES spaces
+  mutable mfem::Vector permuted_b_, permuted_x_;
+
+  /// @brief the same vectors in the form expected by hypre, which keeps references to (but does not copy) them
+  std::vector<HYPRE_ParVector> hypre_modes_;
+
+  /// @brief whether an operator has been set
+  bool hierarchy_built_ = false;
+
+  /// @brief whether the near-nullspace changed after the operator was set, which then has to be set again
+  bool needs_operator_ = false;
+
+  /// @brief whether the hierarchy of the current operator has been measured yet
+  mutable bool hierarchy_measured_ = false;
+
+  /// @brief records the size of the hierarchy for `serac::memoryReport()`
+  mutable TrackedAllocation memory_;
+};
+
+/**
+ * @brief A low-order-refined (LOR) preconditioner for high-order H1 operators
+ *
+ * The high-order (p > 1) mesh is refined into a p = 1 mesh whose vertices are the (Gauss-Lobatto) nodes of the
+ * high-order space, so the two spaces share their true dofs. A model of the operator is discretized on the refined
+ * mesh with mfem::ParLORDiscretization, and BoomerAMG is run on the result. The low-order operator is spectrally
+ * equivalent to the high-order one, independently of the order, and is much sparser.
+ *
+ * The model is a diffusion and mass operator for scalar spaces, and an isotropic elasticity and mass operator for
+ * vector-valued (displacement) spaces, whose coefficients are constant on each element of the high-order mesh. When
+ * the element matrices of the operator are given to setSpace, the coefficients of each element are fitted to its
+ * element matrix (in the least-squares sense) by every SetOperator, so the low-order operator follows the material
+ * tangent of the operator: its heterogeneity, the ratio of the Lame parameters, the mass (1/dt) shift of transient
+ * Jacobians, and the stiffening or softening of nonlinear materials. Operators that are not assembled can be
+ * preconditioned as well. Without the element matrices, the model has unit (diffusion or Lame) coefficients and no
+ * mass, and is only reassembled when the essential dofs change.
+ *
+ * @note The tangent isn't evaluated on the refined mesh itself, because the material state (and parameters) of the
+ * physics modules live at the quadrature points of the high-order mesh. The variation of the tangent within an
+ * element, and any anisotropy, are lost in the fit.
+ */
+class LORPreconditioner : public mfem::Solver {
+public:
+  /**
+   * @brief Construct a new LOR preconditioner
+   *
+   * @param print_level The print level of the BoomerAMG solver used on the low-order operator
+   */
+  explicit LORPreconditioner(int print_level = 0);
+
+  /// @brief Destroy the preconditioner
+  ~LORPreconditioner() override;
+
+  /**
+   * @brief Set the high-order space of subsequent operators, and build its low-order refined discretization
+   *
+   * @param space The (H1, Gauss-Lobatto) space of the rows and columns of the operator
+   * @param essential_dofs Returns the essential true dofs of the current operator, whose rows and columns of the
+   * low-order operator are eliminated. If empty, no dofs are eliminated.
+   * @param element_matrices Visits the element matrices of the current operator, which the coefficients of the
+   * model are fitted to. If empty, the model has unit coefficients.
+   *
+   * @note This must be called before the first call to SetOperator. Vector-valued spaces are treated as
+   * displacements, and the rigid body modes of @a space are used as the near-nullspace of the AMG solver.
+   */
+  void setSpace(mfem::ParFiniteElementSpace& space, std::function<const mfem::Array<int>&()> essential_dofs = {},
+                ElementMatrixSource element_matrices = {});
+
+  /**
+   * @brief Set a new operator, fitting the model to its element matrices and reassembling the low-order operator
+   * (and its AMG hierarchy)
+   *
+   * Without element matrices, the low-order operator is only reassembled if the essential dofs changed.
+   *
+   * @param op The high-order operator, which doesn't have to be assembled
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Apply one AMG cycle of the low-order operator
+   *
+   * @param b The input vector
+   * @param x The output vector
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief The low-order operator that the AMG solver is built from
+   */
+  const mfem::HypreParMatrix& lowOrderOperator() const;
+
+  /**
+   * @brief The values of a coefficient of the model on each element of the high-order mesh
+   *
+   * The coefficients are (diffusion, mass) for scalar spaces, and (lambda, mu, mass) for vector-valued spaces.
+   */
+  const mfem::Vector& modelCoefficient(int i) const;
+
+private:
+  /// @brief a coefficient that is constant on each element of the high-order mesh, and on its refinements
+  class ElementCoefficient;
+
+  /// @brief fit the coefficients of the model to the element matrices of the current operator
+  void fitModel();
+
+  /// @brief the AMG solver of the low-order operator
+  BoomerAMG amg_;
+
+  /// @brief the coefficients of the model operator
+  std::vector<std::unique_ptr<ElementCoefficient>> coefficients_;
+
+  /// @brief the model of the operator, on the high-order space
+  std::unique_ptr<mfem::ParBilinearForm> model_;
+
+  /// @brief visits the element matrices of the current operator
+  ElementMatrixSource element_matrices_;
+
+  /// @brief the element of the high-order mesh with the given (sorted) local dofs
+  std::map<std::vector<int>, int> elements_;
+
+  /// @brief the element of the high-order mesh that each element of the refined mesh belongs to
+  mfem::Array<int> parents_;
+
+  /// @brief the low-order refined space, and the discretization of the model on it
+  std::unique_ptr<mfem::ParLORDiscretization> lor_;
+
+  /// @brief returns the essential true dofs of the current operator
+  std::function<const mfem::Array<int>&()> essential_dofs_;
+
+  /// @brief the essential true dofs eliminated from the low-order operator
+  mfem::Array<int> eliminated_dofs_;
+
+  /// @brief whether the low-order operator has been assembled
+  bool assembled_ = false;
+
+  /// @brief records the size of the low-order operator for `serac::memoryReport()`
+  TrackedAllocation memory_;
+};
+
+/**
+ * @brief A p-multigrid preconditioner for high-order H1 operators
+ *
+ * The levels are the spaces of orders p, p - 1, ..., 1 on the same mesh. The finest level is the (possibly
+ * matrix-free) operator passed to SetOperator. The operators of the coarse levels are Galerkin products P^T A P,
+ * formed element by element from the element matrices of the finest level (i.e. from the derivatives stored at its
+ * quadrature points), so the high-order operator is never assembled. The levels above p = 1 are applied element by
+ * element, and are smoothed with Chebyshev polynomials of their Jacobi-scaled operators, whose diagonals are summed
+ * from the element matrices. Only the p = 1 operator is assembled, for BoomerAMG.
+ *
+ * @note The Galerkin products are used rather than re-discretizations of the residual at each order, because the
+ * material state (and parameters) of the physics modules live at the quadrature points of the high-order mesh.
+ */
+class PMultigridPreconditioner : public mfem::Solver {
+public:
+  /**
+   * @brief Construct a new p-multigrid preconditioner
+   *
+   * @param print_level The print level of the BoomerAMG solver used on the coarsest level
+   * @param smoother_order The order of the Chebyshev polynomial smoothers
+   */
+  explicit PMultigridPreconditioner(int print_level = 0, int smoother_order = 2);
+
+  /// @brief Destroy the preconditioner (defined where its element operators are complete types)
+  ~PMultigridPreconditioner() override;
+
+  /**
+   * @brief Set the high-order space of subsequent operators, and build the interpolations between its orders
+   *
+   * @param space The (H1) space of the rows and columns of the operator
+   * @param essential_dofs Returns the essential true dofs of the current operator. If empty, there are none.
+   * @param element_matrices Visits the element matrices of the current operator, on the local dofs of @a space
+   *
+   * @note This must be called before the first call to SetOperator. Vector-valued spaces are treated as
+   * displacements, and the rigid body modes of the p = 1 space are used as the near-nullspace of the AMG solver.
+   */
+  void setSpace(mfem::ParFiniteElementSpace& space, std::function<const mfem::Array<int>&()> essential_dofs,
+                ElementMatrixSource element_matrices);
+
+  /**
+   * @brief Build the coarse operators, smoothers and AMG hierarchy of a new operator
+   *
+   * @param op The high-order operator, which doesn't have to be assembled. Its element matrices are the ones
+   * visited by the source given to setSpace, and its essential rows are the identity.
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Keep the coarse levels and AMG hierarchy, and only give the finest level (and its smoother) a new operator
+   *
+   * This is how the preconditioner is reused for a later Jacobian with the same essential dofs, as the finest level
+   * refers to its operator, which is usually replaced by the next linearization.
+   *
+   * @param op The new high-order operator
+   */
+  void setFinestOperator(const mfem::Operator& op);
+
+  /**
+   * @brief Apply one V-cycle
+   *
+   * @param b The input vector
+   * @param x The output vector
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief The number of levels (i.e. the order of the finest level)
+   */
+  int numLevels() const { return static_cast<int>(levels_.size()); }
+
+  /**
+   * @brief The operator of a level, where level 0 is the p = 1 level
+   */
+  const mfem::Operator& levelOperator(int level) const;
+
+  /**
+   * @brief The assembled operator of the p = 1 level, that the AMG solver is built from
+   */
+  const mfem::HypreParMatrix& coarsestOperator() const;
+
+  /**
+   * @brief The interpolation from the true dofs of a level to the next finer one
+   */
+  const mfem::HypreParMatrix& prolongation(int level) const;
+
+private:
+  /// @brief a Galerkin operator of a coarse level, applied element by element
+  class ElementOperator;
+
+  /// @brief the space, operators, smoothers and work vectors of one order
+  struct Level {
+    /// @brief the collection of the space (null on the finest level)
+    std::unique_ptr<mfem::H1_FECollection> collection;
+
+    /// @brief the space of this level (owned, except on the finest level)
+    std::unique_ptr<mfem::ParFiniteElementSpace> owned_space;
+
+    /// @brief the space of this level
+    mfem::ParFiniteElementSpace* space = nullptr;
+
+    /// @brief the interpolation from the local dofs of the next coarser level (null on the coarsest level)
+    std::unique_ptr<mfem::SparseMatrix> interpolation;
+
+    /// @brief the interpolation from the true dofs of the next coarser level (null on the coarsest level)
+    std::unique_ptr<mfem::HypreParMatrix> prolongation;
+
+    /// @brief the element matrices of the Galerkin operator of this level
+    std::unique_ptr<ElementOperator> element_operator;
+
+    /// @brief the element operator, with the identity on the essential rows (levels between p = 1 and the finest)
+    std::unique_ptr<mfem::ConstrainedOperator> constrained_operator;
+
+    /// @brief the assembled operator, with the essential rows and columns eliminated (p = 1 level only)
+    std::unique_ptr<mfem::HypreParMatrix> assembled_operator;
+
+    /// @brief the operator of this level
+    const mfem::Operator* op = nullptr;
+
+    /// @brief the essential true dofs of this level
+    mfem::Array<int> essential_dofs;
+
+    /// @brief the diagonal of the operator
+    mfem::Vector diagonal;
+
+    /// @brief the Chebyshev smoother (null on the coarsest level)
+    std::unique_ptr<mfem::OperatorChebyshevSmoother> smoother;
+
+    /// @brief the right hand side, solution and residual of this level in a cycle
+    mutable mfem::Vector rhs, solution, residual;
+  };
+
+  /// @brief form the element matrices and essential dofs of the coarse levels from those of the finest level
+  void coarsen();
+
+  /// @brief apply a V-cycle, starting from the given level
+  void cycle(std::size_t level, const mfem::Vector& b, mfem::Vector& x) const;
+
+  /// @brief the order of the Chebyshev smoothers
+  int smoother_order_;
+
+  /// @brief the levels, from the p = 1 level to the finest
+  std::vector<Level> levels_;
+
+  /// @brief returns the essential true dofs of the current operator
+  std::function<const mfem::Array<int>&()> essential_dofs_;
+
+  /// @brief visits the element matrices of the current operator
+  ElementMatrixSource element_matrices_;
+
+  /// @brief the AMG solver of the coarsest level
+  BoomerAMG amg_;
+
+  /// @brief records the size of the element matrices and the p = 1 operator for `serac::memoryReport()`
+  TrackedAllocation memory_;
+};
+
+  /// @brief apply a V-cycle, starting from the given level
+  void cycle(std::size_t level, const mfem::Vector& b, mfem::Vector& x) const;
+
+  /// @brief the order of the Chebyshev smoothers
+  int smoother_order_;
+
+  /// @brief the levels, from the p = 1 level to the finest
+  std::vector<Level> levels_;
+
+  /// @brief the constrained dofs of the smoothers (none, as they are already eliminated from the operators)
+  mfem::Array<int> no_essential_dofs_;
+
+  /// @brief the AMG solver of the coarsest level
+  BoomerAMG amg_;
+
+  /// @brief records the size of the coarse operators for `serac::memoryReport()`
+  TrackedAllocation memory_;
+};
+
+/**
+ * @brief A block lower-triangular preconditioner for saddle-point systems, e.g. Lagrange multiplier contact
+ *
+ * For a block operator
+ *
+ *   | K  B^T |
+ *   | B  D   |
+ *
+ * (where D has ones on the diagonal of the inactive constraints, and is zero elsewhere), the displacement block K
+ * is solved with BoomerAMG, and the Schur complement S = D - B K^{-1} B^T is approximated by D - B diag(K)^{-1} B^T.
+ * The approximate Schur complement is negative definite on the active constraints, so BoomerAMG is run on
+ * D + B diag(K)^{-1} B^T, and the sign of the active constraints is flipped.
+ *
+ * Operators that aren't block operators (e.g. when all of the contact interactions are enforced with penalties)
+ * are solved with the BoomerAMG solver of the displacement block.
+ */
+class BlockSchurPreconditioner : public mfem::Solver {
+public:
+  /**
+   * @brief Construct a new block Schur complement preconditioner
+   *
+   * @param print_level The print level of the BoomerAMG solvers
+   */
+  explicit BlockSchurPreconditioner(int print_level = 0);
+
+  /**
+   * @brief Use the rigid body modes of @a space as the near-nullspace of the displacement block
+   *
+   * @param space The displacement space of the elasticity problem
+   */
+  void setElasticityNearNullspace(mfem::ParFiniteElementSpace& space);
+
+  /**
+   * @brief Build the AMG hierarchies of the displacement block and the approximate Schur complement
+   *
+   * @param op A 2x2 mfem::BlockOperator with HypreParMatrix blocks, or a HypreParMatrix
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Apply the preconditioner
+   *
+   * @param b The input vector
+   * @param x The output vector
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief The approximate Schur complement D + B diag(K)^{-1} B^T (null if the operator is not a block operator)
+   */
+  const mfem::HypreParMatrix* schurComplement() const { return schur_.get(); }
+
+private:
+  /// @brief the AMG solver of the displacement block
+  BoomerAMG displacement_amg_;
+
+  /// @brief the AMG solver of the approximate Schur complement
+  BoomerAMG schur_amg_;
+
+  /// @brief the constraint block B (null if the operator is not a block operator)
+  const mfem::HypreParMatrix* constraint_ = nullptr;
+
+  /// @brief the (sign-flipped) approximate Schur complement
+  std::unique_ptr<mfem::HypreParMatrix> schur_;
+
+  /// @brief -1 for the active constraints, and 1 for the inactive ones
+  mfem::Vector signs_;
+
+  /// @brief the offsets of the blocks of the operator
+  mfem::Array<int> offsets_;
+
+  /// @brief the residual of the constraint equations
+  mutable mfem::Vector constraint_residual_;
+
+  /// @brief records the size of the approximate Schur complement for `serac::memoryReport()`
+  TrackedAllocation memory_;
+};
+
 #ifdef MFEM_USE_AMGX
 /**
  * @brief Build an AMGX preconditioner
@@ -0,0 +1,155 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/fixed_point_accelerator.hpp"
+
+#include <cmath>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac {
+
+FixedPointAccelerator::FixedPointAccelerator(CouplingScheme scheme, int anderson_depth, MPI_Comm comm)
+    : scheme_(scheme), anderson_depth_(anderson_depth), comm_(comm)
+{
+  SLIC_ERROR_ROOT_IF(scheme_ == CouplingScheme::Anderson && anderson_depth_ < 1,
+                     "Anderson acceleration requires a depth of at least 1");
+}
+
+void FixedPointAccelerator::setBlocks(const mfem::Array<int>& offsets)
+{
+  SLIC_ERROR_ROOT_IF(offsets.Size() < 2 || offsets[0] != 0, "The block offsets must start at 0");
+  offsets.Copy(block_offsets_);
+  reset();
+}
+
+void FixedPointAccelerator::reset()
+{
+  updates_    = 0;
+  relaxation_ = 1.0;
+  residual_differences_.clear();
+  image_differences_.clear();
+}
+
+double FixedPointAccelerator::dot(const mfem::Vector& a, const mfem::Vector& b) const
+{
+  if (block_scales_.empty()) {
+    return mfem::InnerProduct(comm_, a, b);
+  }
+
+  double local = 0.0;
+  for (std::size_t block = 0; block < block_scales_.size(); block++) {
+    const int    begin  = block_offsets_[static_cast<int>(block)];
+    const int    end    = block_offsets_[static_cast<int>(block) + 1];
+    const double scale2 = block_scales_[block] * block_scales_[block];
+    for (int i = begin; i < end; i++) {
+      local += scale2 * a[i] * b[i];
+    }
+  }
+
+  double global = 0.0;
+  MPI_Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, comm_);
+  return global;
+}
+
+void FixedPointAccelerator::computeBlockScales(const mfem::Vector& r)
+{
+  block_scales_.clear();
+  if (block_offsets_.Size() == 0) {
+    return;
+  }
+  SLIC_ERROR_ROOT_IF(block_offsets_.Last() != r.Size(), "The block offsets don't match the size of the iterates");
+
+  const int           blocks = block_offsets_.Size() - 1;
+  std::vector<double> norms(static_cast<std::size_t>(blocks), 0.0);
+  for (int block = 0; block < blocks; block++) {
+    for (int i = block_offsets_[block]; i < block_offsets_[block + 1]; i++) {
+      norms[static_cast<std::size_t>(block)] += r[i] * r[i];
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, norms.data(), blocks, MPI_DOUBLE, MPI_SUM, comm_);
+
+  // a block without a residual (e.g. a field that isn't coupled yet) keeps its own scale
+  for (double norm_squared : norms) {
+    block_scales_.push_back(norm_squared > 0.0 ? 1.0 / std::sqrt(norm_squared) : 1.0);
+  }
+}
+
+void FixedPointAccelerator::update(mfem::Vector& x, const mfem::Vector& g)
+{
+  SLIC_ERROR_ROOT_IF(x.Size() != g.Size(), "The iterate and its image must have the same size");
+
+  mfem::Vector r(g);
+  r -= x;
+
+  if (updates_ == 0) {
+    computeBlockScales(r);
+  }
+
+  if (updates_ > 0 && scheme_ == CouplingScheme::Aitken) {
+    mfem::Vector dr(r);
+    dr -= previous_residual_;
+
+    const double dr_squared = dot(dr, dr);
+    if (dr_squared > 0.0) {
+      relaxation_ = -relaxation_ * dot(previous_residual_, dr) / dr_squared;
+    }
+    x.Add(relaxation_, r);
+  } else if (updates_ > 0 && scheme_ == CouplingScheme::Anderson) {
+    andersonUpdate(x, r, g);
+  } else {
+    x = g;
+  }
+
+  previous_residual_ = r;
+  previous_image_    = g;
+  updates_++;
+}
+
+void FixedPointAccelerator::andersonUpdate(mfem::Vector& x, const mfem::Vector& r, const mfem::Vector& g)
+{
+  residual_differences_.emplace_back(r);
+  residual_differences_.back() -= previous_residual_;
+  image_differences_.emplace_back(g);
+  image_differences_.back() -= previous_image_;
+  if (static_cast<int>(residual_differences_.size()) > anderson_depth_) {
+    residual_differences_.pop_front();
+    image_differences_.pop_front();
+  }
+
+  // solve the least squares problem min |r - dR g| through its normal equations, which are
+  // small (depth x depth) and only need inner products of the distributed vectors
+  const int         m = static_cast<int>(residual_differences_.size());
+  mfem::DenseMatrix normal_matrix(m);
+  mfem::Vector      rhs(m);
+  for (int i = 0; i < m; i++) {
+    const auto& dr_i = residual_differences_[static_cast<std::size_t>(i)];
+    for (int j = 0; j <= i; j++) {
+      normal_matrix(i, j) = normal_matrix(j, i) = dot(dr_i, residual_differences_[static_cast<std::size_t>(j)]);
+    }
+    rhs(i) = dot(dr_i, r);
+  }
+
+  // a little regularization keeps the normal equations solvable when the differences are (nearly) dependent
+  const double regularization = 1.0e-12 * normal_matrix.Trace() / m;
+  for (int i = 0; i < m; i++) {
+    normal_matrix(i, i) += regularization;
+  }
+
+  mfem::Vector gamma(m);
+  gamma = 0.0;
+  if (normal_matrix.Trace() > 0.0) {
+    mfem::DenseMatrixInverse inverse(normal_matrix);
+    inverse.Mult(rhs, gamma);
+  }
+
+  x = g;
+  for (int i = 0; i < m; i++) {
+    x.Add(-gamma(i), image_differences_[static_cast<std::size_t>(i)]);
+  }
+}
+
+}  // namespace serac
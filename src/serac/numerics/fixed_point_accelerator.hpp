@@ -0,0 +1,122 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file fixed_point_accelerator.hpp
+ *
+ * @brief Relaxation and acceleration of fixed-point iterations, e.g. for iterated multiphysics coupling
+ */
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/solver_config.hpp"
+
+namespace serac {
+
+/**
+ * @brief Computes the iterates of a fixed-point iteration x = G(x), with optional relaxation or acceleration
+ *
+ * Given the current iterate x_k and its image G(x_k), with residual r_k = G(x_k) - x_k, the next iterate is
+ *
+ *   - FixedPoint: x_{k+1} = G(x_k)
+ *   - Aitken: x_{k+1} = x_k + w_k r_k, where w_k = -w_{k-1} (r_{k-1}, r_k - r_{k-1}) / |r_k - r_{k-1}|^2
+ *   - Anderson: x_{k+1} = G(x_k) - sum_i g_i (G(x_{i+1}) - G(x_i)), where the coefficients g_i minimize
+ *     |r_k - sum_i g_i (r_{i+1} - r_i)| over the most recent iterates
+ *
+ * The first iterate of every sequence is x_1 = G(x_0). As every later Anderson iterate is an affine combination of
+ * images, and every later Aitken iterate is an affine combination of x_k and G(x_k), constraints satisfied by all of
+ * the images (e.g. essential boundary conditions) are satisfied by the iterates as well.
+ *
+ * When the iterates concatenate several fields (see setBlocks), each block is scaled by the inverse of the norm of
+ * its first residual in the sequence in the inner products, so a field with larger values (e.g. the temperature,
+ * next to the displacement) doesn't determine the relaxation factor or the least-squares fit on its own.
+ */
+class FixedPointAccelerator {
+public:
+  /**
+   * @brief Construct a new fixed-point accelerator
+   *
+   * @param scheme How the next iterate is computed (CouplingScheme::OneWay is treated as FixedPoint)
+   * @param anderson_depth The number of previous iterates used by Anderson acceleration
+   * @param comm The MPI communicator the iterates are distributed over
+   */
+  FixedPointAccelerator(CouplingScheme scheme, int anderson_depth, MPI_Comm comm);
+
+  /**
+   * @brief Set the fields the iterates are made of, which are scaled separately in the inner products
+   *
+   * @param offsets The offsets of the blocks of the iterates (as for an mfem::BlockVector)
+   */
+  void setBlocks(const mfem::Array<int>& offsets);
+
+  /**
+   * @brief Discard the previous iterates, to start a new sequence
+   */
+  void reset();
+
+  /**
+   * @brief Compute the next iterate
+   *
+   * @param[in,out] x The current iterate x_k on input, and the next iterate x_{k+1} on output
+   * @param[in] g The image G(x_k) of the current iterate
+   */
+  void update(mfem::Vector& x, const mfem::Vector& g);
+
+  /**
+   * @brief The Aitken relaxation factor used by the most recent update
+   */
+  double relaxation() const { return relaxation_; }
+
+private:
+  /// @brief The (block-scaled) inner product of two distributed vectors
+  double dot(const mfem::Vector& a, const mfem::Vector& b) const;
+
+  /// @brief Scale each block by the inverse of its norm in the first residual @a r of the sequence
+  void computeBlockScales(const mfem::Vector& r);
+
+  /// @brief Compute the next Anderson iterate, given the current residual and image
+  void andersonUpdate(mfem::Vector& x, const mfem::Vector& r, const mfem::Vector& g);
+
+  /// The scheme used to compute the next iterate
+  CouplingScheme scheme_;
+
+  /// The number of previous iterates used by Anderson acceleration
+  int anderson_depth_;
+
+  /// The MPI communicator the iterates are distributed over
+  MPI_Comm comm_;
+
+  /// The offsets of the blocks of the iterates
+  mfem::Array<int> block_offsets_;
+
+  /// The scale of each block in the inner products, for the current sequence
+  std::vector<double> block_scales_;
+
+  /// The number of updates since the sequence was started
+  int updates_ = 0;
+
+  /// The Aitken relaxation factor of the most recent update
+  double relaxation_ = 1.0;
+
+  /// The residual of the previous iterate
+  mfem::Vector previous_residual_;
+
+  /// The image of the previous iterate
+  mfem::Vector previous_image_;
+
+  /// Differences of consecutive residuals, oldest first
+  std::deque<mfem::Vector> residual_differences_;
+
+  /// Differences of consecutive images, oldest first
+  std::deque<mfem::Vector> image_differences_;
+};
+
+}  // namespace serac
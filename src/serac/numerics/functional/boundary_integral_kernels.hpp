@@ -6,10 +6,14 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include "serac/serac_config.hpp"
+#include "serac/infrastructure/accelerator.hpp"
 #include "serac/numerics/functional/quadrature_data.hpp"
 #include "serac/numerics/functional/differentiate_wrt.hpp"
+#include "serac/numerics/functional/element_costs.hpp"
 
 namespace serac {
 
@@ -109,6 +113,15 @@ auto get_derivative_type(lambda qf)
                zero{}};
 };
 
+template <int i, int j, int dim, typename... trials, typename lambda>
+auto get_combined_derivative_type(lambda qf)
+{
+  using qf_arguments = serac::tuple<typename QFunctionArgument<trials, serac::Dimension<dim>>::type...>;
+  return tuple{
+      get_gradient(apply_qf(qf, double{}, tensor<double, dim + 1>{}, make_dual_wrt_both<i, j>(qf_arguments{}))),
+      zero{}};
+};
+
 template <typename lambda, int n, typename... T>
 SERAC_HOST_DEVICE auto batch_apply_qf(lambda qf, double t, const tensor<double, 2, n>& positions,
                                       const tensor<double, 1, 2, n>& jacobians, const T&... inputs)
@@ -156,12 +169,18 @@ SERAC_HOST_DEVICE auto batch_apply_qf(lambda qf, double t, const tensor<double,
 }
 
 /// @trial_elements the element type for each trial space
-template <uint32_t differentiation_index, int Q, mfem::Geometry::Type geom, typename test_element,
-          typename trial_element_type, typename lambda_type, typename derivative_type, int... indices>
+/// @note when `secondary_index` is specified, the stored derivatives are those of the linear combination
+/// d/d(argument `differentiation_index`) + secondary_scale * d/d(argument `secondary_index`)
+/// @note when `element_costs` is not null, the time spent on each boundary element (in seconds) is added to
+/// `element_costs[e]`, see `ElementCostTimer`
+template <uint32_t differentiation_index, int Q, mfem::Geometry::Type geom,
+          uint32_t secondary_index = NO_DIFFERENTIATION, typename test_element, typename trial_element_type,
+          typename lambda_type, typename derivative_type, int... indices>
 void evaluation_kernel_impl(trial_element_type trial_elements, test_element, double t,
                             const std::vector<const double*>& inputs, double* outputs, const double* positions,
                             const double* jacobians, lambda_type qf, [[maybe_unused]] derivative_type* qf_derivatives,
-                            const int* elements, uint32_t num_elements, camp::int_seq<int, indices...>)
+                            const int* elements, uint32_t num_elements, camp::int_seq<int, indices...>,
+                            [[maybe_unused]] double secondary_scale = 1.0, double* element_costs = nullptr)
 {
   // mfem provides this information as opaque arrays of doubles,
   // so we reinterpret the pointer with
@@ -177,15 +196,24 @@ void evaluation_kernel_impl(trial_element_type trial_elements, test_element, dou
   [[maybe_unused]] tuple u = {
       reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
 
+  ElementCostTimer timer(element_costs);
+
   // for each element in the domain
   for (uint32_t e = 0; e < num_elements; e++) {
+    timer.start(e);
+
     // load the jacobians and positions for each quadrature point in this element
     auto J_e = J[e];
     auto x_e = x[e];
 
     // batch-calculate values / derivatives of each trial space, at each quadrature point
-    [[maybe_unused]] tuple qf_inputs = {promote_each_to_dual_when<indices == differentiation_index>(
-        get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule))...};
+    [[maybe_unused]] tuple qf_inputs = {
+        promote_each_to_dual_when<indices == differentiation_index || indices == secondary_index>(
+            get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule))...};
+
+    if constexpr (secondary_index != NO_DIFFERENTIATION) {
+      scale_gradient(get<secondary_index>(qf_inputs), secondary_scale);
+    }
 
     // (batch) evalute the q-function at each quadrature point
     auto qf_outputs = batch_apply_qf(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
@@ -201,6 +229,8 @@ void evaluation_kernel_impl(trial_element_type trial_elements, test_element, dou
 
     // (batch) integrate the material response against the test-space basis functions
     test_element::integrate(get_value(qf_outputs), rule, &r[elements[e]]);
+
+    timer.stop(e, num_elements);
   }
 }
 
@@ -327,13 +357,43 @@ void element_gradient_kernel(ExecArrayView<double, 3, ExecutionSpace::CPU> dK, d
 template <uint32_t wrt, int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type,
           typename derivative_type>
 auto evaluation_kernel(signature s, lambda_type qf, const double* positions, const double* jacobians,
-                       std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements)
+                       std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements,
+                       std::shared_ptr<std::vector<double>> element_costs = nullptr)
 {
   auto trial_elements = trial_elements_tuple<geom>(s);
   auto test_element   = get_test_element<geom>(s);
   return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool /* update state */) {
+    double* costs = (element_costs && !element_costs->empty()) ? element_costs->data() : nullptr;
     evaluation_kernel_impl<wrt, Q, geom>(trial_elements, test_element, time, inputs, outputs, positions, jacobians, qf,
-                                         qf_derivatives.get(), elements, num_elements, s.index_seq);
+                                         qf_derivatives.get(), elements, num_elements, s.index_seq, 1.0, costs);
+  };
+}
+
+/**
+ * @brief create a kernel that evaluates the integral and stores the derivatives of the q-function with respect to
+ * the linear combination d/d(argument wrt) + scale * d/d(argument secondary), where scale is given at runtime
+ *
+ * @note the storage for the derivatives is only allocated the first time the kernel is called
+ */
+template <uint32_t wrt, uint32_t secondary, int Q, mfem::Geometry::Type geom, typename signature,
+          typename lambda_type, typename derivative_type>
+auto combined_evaluation_kernel(signature s, lambda_type qf, const double* positions, const double* jacobians,
+                                std::shared_ptr<std::shared_ptr<derivative_type[]>> qf_derivatives,
+                                const int* elements, uint32_t num_elements,
+                                std::shared_ptr<std::vector<double>> element_costs = nullptr)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool /* update state */,
+             double scale) {
+    if (!*qf_derivatives) {
+      *qf_derivatives = accelerator::make_shared_array<ExecutionSpace::CPU, derivative_type>(
+          num_elements * uint32_t(num_quadrature_points(geom, Q)));
+    }
+    double* costs = (element_costs && !element_costs->empty()) ? element_costs->data() : nullptr;
+    evaluation_kernel_impl<wrt, Q, geom, secondary>(trial_elements, test_element, time, inputs, outputs, positions,
+                                                    jacobians, qf, qf_derivatives->get(), elements, num_elements,
+                                                    s.index_seq, scale, costs);
   };
 }
 
@@ -359,6 +419,34 @@ std::function<void(ExecArrayView<double, 3, ExecutionSpace::CPU>)> element_gradi
   };
 }
 
+/// @brief create a jacobian-vector product kernel for derivatives computed by combined_evaluation_kernel
+template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
+std::function<void(const double*, double*)> combined_jacobian_vector_product_kernel(
+    signature, std::shared_ptr<std::shared_ptr<derivative_type[]>> qf_derivatives, const int* elements,
+    uint32_t num_elements)
+{
+  return [=](const double* du, double* dr) {
+    using test_space  = typename signature::return_type;
+    using trial_space = typename std::tuple_element<wrt, typename signature::parameter_types>::type;
+    action_of_gradient_kernel<Q, geom, test_space, trial_space>(du, dr, qf_derivatives->get(), elements,
+                                                                 num_elements);
+  };
+}
+
+/// @brief create an element gradient kernel for derivatives computed by combined_evaluation_kernel
+template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
+std::function<void(ExecArrayView<double, 3, ExecutionSpace::CPU>)> combined_element_gradient_kernel(
+    signature, std::shared_ptr<std::shared_ptr<derivative_type[]>> qf_derivatives, const int* elements,
+    uint32_t num_elements)
+{
+  return [=](ExecArrayView<double, 3, ExecutionSpace::CPU> K_elem) {
+    using test_space  = typename signature::return_type;
+    using trial_space = typename std::tuple_element<wrt, typename signature::parameter_types>::type;
+    element_gradient_kernel<geom, test_space, trial_space, Q>(K_elem, qf_derivatives->get(), elements,
+                                                              num_elements);
+  };
+}
+
 }  // namespace boundary_integral
 
 }  // namespace serac
@@ -41,4 +41,31 @@ struct differentiate_wrt_this {
  */
 inline auto differentiate_wrt(const mfem::Vector& v) { return differentiate_wrt_this{v}; }
 
+/**
+ * @brief this type exists solely as a way to signal to `serac::Functional` that the derivative
+ * being computed by `serac::Functional::operator()` should also include a scaled contribution from this argument
+ */
+struct differentiate_wrt_scaled_this {
+  const mfem::Vector& ref;    ///< the actual data wrapped by this type
+  double              scale;  ///< the coefficient of the derivative w.r.t. this argument
+
+  /// @brief implicitly convert back to `mfem::Vector` to extract the actual data
+  operator const mfem::Vector&() const { return ref; }
+};
+
+/**
+ * @brief this function is intended to only be used in combination with
+ *   `serac::Functional::operator()`, as a way for the user to express that the derivative should be taken
+ *   w.r.t. a linear combination of two consecutive arguments of the same type
+ *
+ * For example:
+ * @code{.cpp}
+ *     mfem::Vector u = ...;
+ *     mfem::Vector a = ...;
+ *     // df_da_plus_c0_df_du := df/da + c0 * df/du
+ *     auto [value, df_da_plus_c0_df_du] = my_functional(t, differentiate_wrt(u, c0), differentiate_wrt(a));
+ * @endcode
+ */
+inline auto differentiate_wrt(const mfem::Vector& v, double scale) { return differentiate_wrt_scaled_this{v, scale}; }
+
 }  // namespace serac
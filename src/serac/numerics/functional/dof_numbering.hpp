@@ -8,6 +8,7 @@
 #include "mfem.hpp"
 
 #include "serac/infrastructure/accelerator.hpp"
+#include "serac/infrastructure/memory.hpp"
 
 #include "serac/numerics/functional/integral.hpp"
 #include "serac/numerics/functional/element_restriction.hpp"
@@ -342,6 +343,12 @@ struct GradientAssemblyLookupTables {
     }
 
     row_ptr.back() = static_cast<int>(nnz);
+
+    // each entry of nz_LUT is a separately allocated node: the key, value and a pointer to the next node
+    memory = TrackedAllocation(MemoryCategory::SparseMatrix,
+                               sizeof(int) * (row_ptr.size() + col_ind.size()) +
+                                   nz_LUT.size() * (sizeof(Entry) + sizeof(uint32_t) + sizeof(void*)) +
+                                   nz_LUT.bucket_count() * sizeof(void*));
   }
 
   /**
@@ -368,6 +375,9 @@ struct GradientAssemblyLookupTables {
    * corresponding to the (i,j) entry
    */
   std::unordered_map<Entry, uint32_t, Entry::Hasher> nz_LUT;
+
+  /// @brief records the (approximate) size of the lookup tables for `serac::memoryReport()`
+  TrackedAllocation memory;
 };
 
 }  // namespace serac
@@ -475,15 +475,19 @@ Domain EntireDomain(const mfem::Mesh& mesh)
     switch (geom) {
       case mfem::Geometry::TRIANGLE:
         output.tri_ids_.push_back(tri_id++);
+        output.mfem_tri_ids_.push_back(i);
         break;
       case mfem::Geometry::SQUARE:
         output.quad_ids_.push_back(quad_id++);
+        output.mfem_quad_ids_.push_back(i);
         break;
       case mfem::Geometry::TETRAHEDRON:
         output.tet_ids_.push_back(tet_id++);
+        output.mfem_tet_ids_.push_back(i);
         break;
       case mfem::Geometry::CUBE:
         output.hex_ids_.push_back(hex_id++);
+        output.mfem_hex_ids_.push_back(i);
         break;
       default:
         SLIC_ERROR("unsupported element type");
@@ -511,12 +515,15 @@ Domain EntireBoundary(const mfem::Mesh& mesh)
     switch (geom) {
       case mfem::Geometry::SEGMENT:
         output.edge_ids_.push_back(edge_id++);
+        output.mfem_edge_ids_.push_back(f);
         break;
       case mfem::Geometry::TRIANGLE:
         output.tri_ids_.push_back(tri_id++);
+        output.mfem_tri_ids_.push_back(f);
         break;
       case mfem::Geometry::SQUARE:
         output.quad_ids_.push_back(quad_id++);
+        output.mfem_quad_ids_.push_back(f);
         break;
       default:
         SLIC_ERROR("unsupported element type");
@@ -551,24 +558,34 @@ Domain set_operation(set_op op, const Domain& a, const Domain& b)
   assert(&a.mesh_ == &b.mesh_);
   assert(a.dim_ == b.dim_);
 
-  Domain output{a.mesh_, a.dim_};
+  assert(a.type_ == b.type_);
+
+  Domain output{a.mesh_, a.dim_, a.type_};
+
+  // note: the mfem ids increase along with the other ids, so applying
+  // the same operation to both lists keeps them consistent
 
   if (output.dim_ == 0) {
     output.vertex_ids_ = set_operation(op, a.vertex_ids_, b.vertex_ids_);
   }
 
   if (output.dim_ == 1) {
-    output.edge_ids_ = set_operation(op, a.edge_ids_, b.edge_ids_);
+    output.edge_ids_      = set_operation(op, a.edge_ids_, b.edge_ids_);
+    output.mfem_edge_ids_ = set_operation(op, a.mfem_edge_ids_, b.mfem_edge_ids_);
   }
 
   if (output.dim_ == 2) {
-    output.tri_ids_  = set_operation(op, a.tri_ids_, b.tri_ids_);
-    output.quad_ids_ = set_operation(op, a.quad_ids_, b.quad_ids_);
+    output.tri_ids_       = set_operation(op, a.tri_ids_, b.tri_ids_);
+    output.quad_ids_      = set_operation(op, a.quad_ids_, b.quad_ids_);
+    output.mfem_tri_ids_  = set_operation(op, a.mfem_tri_ids_, b.mfem_tri_ids_);
+    output.mfem_quad_ids_ = set_operation(op, a.mfem_quad_ids_, b.mfem_quad_ids_);
   }
 
   if (output.dim_ == 3) {
-    output.tet_ids_ = set_operation(op, a.tet_ids_, b.tet_ids_);
-    output.hex_ids_ = set_operation(op, a.hex_ids_, b.hex_ids_);
+    output.tet_ids_      = set_operation(op, a.tet_ids_, b.tet_ids_);
+    output.hex_ids_      = set_operation(op, a.hex_ids_, b.hex_ids_);
+    output.mfem_tet_ids_ = set_operation(op, a.mfem_tet_ids_, b.mfem_tet_ids_);
+    output.mfem_hex_ids_ = set_operation(op, a.mfem_hex_ids_, b.mfem_hex_ids_);
   }
 
   return output;
@@ -130,6 +130,18 @@ struct Domain {
     exit(1);
   }
 
+  /// @brief get the mfem element (or boundary element) numbers of the elements with the given geometry
+  const std::vector<int>& get_mfem_ids(mfem::Geometry::Type geom) const
+  {
+    if (geom == mfem::Geometry::SEGMENT) return mfem_edge_ids_;
+    if (geom == mfem::Geometry::TRIANGLE) return mfem_tri_ids_;
+    if (geom == mfem::Geometry::SQUARE) return mfem_quad_ids_;
+    if (geom == mfem::Geometry::TETRAHEDRON) return mfem_tet_ids_;
+    if (geom == mfem::Geometry::CUBE) return mfem_hex_ids_;
+
+    exit(1);
+  }
+
   /// @brief get mfem degree of freedom list for a given FiniteElementSpace
   mfem::Array<int> dof_list(mfem::FiniteElementSpace* fes) const;
 };
@@ -10,10 +10,14 @@
 #include "serac/numerics/functional/quadrature_data.hpp"
 #include "serac/numerics/functional/function_signature.hpp"
 #include "serac/numerics/functional/differentiate_wrt.hpp"
+#include "serac/numerics/functional/element_costs.hpp"
 #include "RAJA/RAJA.hpp"
 
 #include <array>
 #include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace serac {
 
@@ -102,25 +106,82 @@ auto get_derivative_type(const lambda& qf, qpt_data_type qpt_data)
                                make_dual_wrt<i>(qf_arguments{})));
 };
 
-template <typename lambda, int dim, int n, typename... T>
-SERAC_HOST_DEVICE auto batch_apply_qf_no_qdata(const lambda& qf, double t, const tensor<double, dim, n>& x,
-                                               const tensor<double, dim, dim, n>& J, const T&... inputs)
+template <int i, int j, int dim, typename... trials, typename lambda, typename qpt_data_type>
+auto get_combined_derivative_type(const lambda& qf, qpt_data_type qpt_data)
 {
-  using position_t  = serac::tuple<tensor<double, dim>, tensor<double, dim, dim>>;
-  using return_type = decltype(qf(double{}, position_t{}, T{}[0]...));
-  tensor<return_type, n> outputs{};
+  using qf_arguments = serac::tuple<typename QFunctionArgument<trials, serac::Dimension<dim>>::type...>;
+  return get_gradient(apply_qf(qf, double{}, serac::tuple<tensor<double, dim>, tensor<double, dim, dim>>{}, qpt_data,
+                               make_dual_wrt_both<i, j>(qf_arguments{})));
+};
+
+/// @cond
+template <typename, typename lambda, typename... arg_types>
+struct has_batch_evaluation_impl : std::false_type {};
+
+template <typename lambda, typename... arg_types>
+struct has_batch_evaluation_impl<std::void_t<decltype(std::declval<const lambda&>().batch(std::declval<arg_types>()...))>,
+                                 lambda, arg_types...> : std::true_type {};
+/// @endcond
+
+/**
+ * @brief trait for detecting q-functions that opt in to being evaluated on all of an element's
+ * quadrature points in a single call, through a member function of the form
+ *
+ *   auto batch(double t, const tensor< position_type, n > & x, [tensor< qdata_type, n > & qdata,] const tensor< T, n >
+ * & inputs...) const;
+ *
+ * that returns a tensor< output_type, n >, where output_type is the type that the pointwise operator() would return.
+ * This lets material models be written in terms of loops over quadrature points that the compiler
+ * can vectorize, rather than being called once per quadrature point.
+ *
+ * @note batched q-functions must still provide the pointwise operator(), which is used to deduce
+ * the output and derivative types of the q-function
+ */
+template <typename lambda, typename... arg_types>
+inline constexpr bool has_batch_evaluation_v = has_batch_evaluation_impl<void, lambda, arg_types...>::value;
+
+/**
+ * @brief gather the positions and jacobians of each quadrature point in an element into the layout
+ * expected by q-functions: a contiguous (x_q, dx_dxi_q) pair for each quadrature point
+ *
+ * @param x the positions of each quadrature point, stored with the quadrature point index last
+ * @param J the jacobians of each quadrature point, stored with the quadrature point index last
+ */
+template <int dim, int n>
+SERAC_HOST_DEVICE auto gather_positions(const tensor<double, dim, n>& x, const tensor<double, dim, dim, n>& J)
+{
+  using position_t = serac::tuple<tensor<double, dim>, tensor<double, dim, dim>>;
+  tensor<position_t, n> positions{};
   for (int i = 0; i < n; i++) {
-    tensor<double, dim>      x_q;
-    tensor<double, dim, dim> J_q;
+    auto& [x_q, J_q] = positions[i];
     for (int j = 0; j < dim; j++) {
       for (int k = 0; k < dim; k++) {
         J_q[j][k] = J(k, j, i);
       }
       x_q[j] = x(j, i);
     }
-    outputs[i] = qf(t, serac::tuple{x_q, J_q}, inputs[i]...);
   }
-  return outputs;
+  return positions;
+}
+
+template <typename lambda, int dim, int n, typename... T>
+SERAC_HOST_DEVICE auto batch_apply_qf_no_qdata(const lambda& qf, double t, const tensor<double, dim, n>& x,
+                                               const tensor<double, dim, dim, n>& J, const T&... inputs)
+{
+  using position_t  = serac::tuple<tensor<double, dim>, tensor<double, dim, dim>>;
+  using return_type = decltype(qf(double{}, position_t{}, T{}[0]...));
+
+  auto positions = gather_positions(x, J);
+
+  if constexpr (has_batch_evaluation_v<lambda, double, const tensor<position_t, n>&, const T&...>) {
+    return tensor<return_type, n>(qf.batch(t, positions, inputs...));
+  } else {
+    tensor<return_type, n> outputs{};
+    for (int i = 0; i < n; i++) {
+      outputs[i] = qf(t, positions[i], inputs[i]...);
+    }
+    return outputs;
+  }
 }
 
 template <typename lambda, int dim, int n, typename qpt_data_type, typename... T>
@@ -130,34 +191,55 @@ SERAC_HOST_DEVICE auto batch_apply_qf(const lambda& qf, double t, const tensor<d
 {
   using position_t  = serac::tuple<tensor<double, dim>, tensor<double, dim, dim>>;
   using return_type = decltype(qf(double{}, position_t{}, qpt_data[0], T{}[0]...));
-  tensor<return_type, n> outputs{};
-  for (int i = 0; i < n; i++) {
-    tensor<double, dim>      x_q;
-    tensor<double, dim, dim> J_q;
-    for (int j = 0; j < dim; j++) {
-      for (int k = 0; k < dim; k++) {
-        J_q[j][k] = J(k, j, i);
-      }
-      x_q[j] = x(j, i);
+
+  auto positions = gather_positions(x, J);
+
+  if constexpr (has_batch_evaluation_v<lambda, double, const tensor<position_t, n>&, tensor<qpt_data_type, n>&,
+                                       const T&...>) {
+    tensor<qpt_data_type, n> qdata;
+    for (int i = 0; i < n; i++) {
+      qdata[i] = qpt_data[i];
     }
-    auto qdata = qpt_data[i];
-    outputs[i] = qf(t, serac::tuple{x_q, J_q}, qdata, inputs[i]...);
+    tensor<return_type, n> outputs(qf.batch(t, positions, qdata, inputs...));
     if (update_state) {
-      qpt_data[i] = qdata;
+      for (int i = 0; i < n; i++) {
+        qpt_data[i] = qdata[i];
+      }
+    }
+    return outputs;
+  } else {
+    tensor<return_type, n> outputs{};
+    for (int i = 0; i < n; i++) {
+      auto qdata = qpt_data[i];
+      outputs[i] = qf(t, positions[i], qdata, inputs[i]...);
+      if (update_state) {
+        qpt_data[i] = qdata;
+      }
     }
+    return outputs;
   }
-  return outputs;
 }
 
-template <uint32_t differentiation_index, int Q, mfem::Geometry::Type geom, typename test_element,
-          typename trial_element_tuple, typename lambda_type, typename state_type, typename derivative_type,
-          int... indices>
+/**
+ * @brief evaluate an integral over elements of a single geometry type, optionally storing the q-function derivatives
+ *
+ * When `secondary_index` is specified, the stored derivatives are those of the linear combination
+ * d/d(argument `differentiation_index`) + secondary_scale * d/d(argument `secondary_index`), computed in a single
+ * pass by seeding both arguments (which must be of the same type) with dual numbers.
+ *
+ * When `element_costs` is not null, the time spent on each element (in seconds) is added to `element_costs[e]`,
+ * see `ElementCostTimer`.
+ */
+template <uint32_t differentiation_index, int Q, mfem::Geometry::Type geom,
+          uint32_t secondary_index = NO_DIFFERENTIATION, typename test_element, typename trial_element_tuple,
+          typename lambda_type, typename state_type, typename derivative_type, int... indices>
 void evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, double t,
                             const std::vector<const double*>& inputs, double* outputs, const double* positions,
                             const double* jacobians, lambda_type qf,
                             [[maybe_unused]] axom::ArrayView<state_type, 2> qf_state,
                             [[maybe_unused]] derivative_type* qf_derivatives, const int* elements,
-                            uint32_t num_elements, bool update_state, camp::int_seq<int, indices...>)
+                            uint32_t num_elements, bool update_state, camp::int_seq<int, indices...>,
+                            [[maybe_unused]] double secondary_scale = 1.0, double* element_costs = nullptr)
 {
   // mfem provides this information as opaque arrays of doubles,
   // so we reinterpret the pointer with
@@ -171,16 +253,25 @@ void evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, do
   [[maybe_unused]] tuple u = {
       reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
 
+  ElementCostTimer timer(element_costs);
+
   // for each element in the domain
   for (uint32_t e = 0; e < num_elements; ++e) {
+    timer.start(e);
+
     // load the jacobians and positions for each quadrature point in this element
     auto J_e = J[e];
     auto x_e = x[e];
 
     //[[maybe_unused]] static constexpr trial_element_tuple trial_element_tuple{};
     // batch-calculate values / derivatives of each trial space, at each quadrature point
-    [[maybe_unused]] tuple qf_inputs = {promote_each_to_dual_when<indices == differentiation_index>(
-        get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule))...};
+    [[maybe_unused]] tuple qf_inputs = {
+        promote_each_to_dual_when<indices == differentiation_index || indices == secondary_index>(
+            get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule))...};
+
+    if constexpr (secondary_index != NO_DIFFERENTIATION) {
+      scale_gradient(get<secondary_index>(qf_inputs), secondary_scale);
+    }
 
     // use J_e to transform values / derivatives on the parent element
     // to the to the corresponding values / derivatives on the physical element
@@ -214,6 +305,8 @@ void evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, do
 
     // (batch) integrate the material response against the test-space basis functions
     test_element::integrate(get_value(qf_outputs), rule, &r[elements[e]]);
+
+    timer.stop(e, num_elements);
   }
 
   return;
@@ -364,14 +457,45 @@ template <uint32_t wrt, int Q, mfem::Geometry::Type geom, typename signature, ty
           typename derivative_type>
 auto evaluation_kernel(signature s, const lambda_type& qf, const double* positions, const double* jacobians,
                        std::shared_ptr<QuadratureData<state_type>> qf_state,
-                       std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements)
+                       std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements,
+                       std::shared_ptr<std::vector<double>> element_costs = nullptr)
 {
   auto trial_elements = trial_elements_tuple<geom>(s);
   auto test_element   = get_test_element<geom>(s);
   return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool update_state) {
+    double* costs = (element_costs && !element_costs->empty()) ? element_costs->data() : nullptr;
     domain_integral::evaluation_kernel_impl<wrt, Q, geom>(
         trial_elements, test_element, time, inputs, outputs, positions, jacobians, qf, (*qf_state)[geom],
-        qf_derivatives.get(), elements, num_elements, update_state, s.index_seq);
+        qf_derivatives.get(), elements, num_elements, update_state, s.index_seq, 1.0, costs);
+  };
+}
+
+/**
+ * @brief create a kernel that evaluates the integral and stores the derivatives of the q-function with respect to
+ * the linear combination d/d(argument wrt) + scale * d/d(argument secondary), where scale is given at runtime
+ *
+ * @note the storage for the derivatives is only allocated the first time the kernel is called
+ */
+template <uint32_t wrt, uint32_t secondary, int Q, mfem::Geometry::Type geom, typename signature,
+          typename lambda_type, typename state_type, typename derivative_type>
+auto combined_evaluation_kernel(signature s, const lambda_type& qf, const double* positions, const double* jacobians,
+                                std::shared_ptr<QuadratureData<state_type>>         qf_state,
+                                std::shared_ptr<std::shared_ptr<derivative_type[]>> qf_derivatives,
+                                const int* elements, uint32_t num_elements,
+                                std::shared_ptr<std::vector<double>> element_costs = nullptr)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool update_state,
+             double scale) {
+    if (!*qf_derivatives) {
+      *qf_derivatives = accelerator::make_shared_array<ExecutionSpace::CPU, derivative_type>(
+          num_elements * uint32_t(num_quadrature_points(geom, Q)));
+    }
+    double* costs = (element_costs && !element_costs->empty()) ? element_costs->data() : nullptr;
+    domain_integral::evaluation_kernel_impl<wrt, Q, geom, secondary>(
+        trial_elements, test_element, time, inputs, outputs, positions, jacobians, qf, (*qf_state)[geom],
+        qf_derivatives->get(), elements, num_elements, update_state, s.index_seq, scale, costs);
   };
 }
 
@@ -397,6 +521,34 @@ std::function<void(ExecArrayView<double, 3, ExecutionSpace::CPU>)> element_gradi
   };
 }
 
+/// @brief create a jacobian-vector product kernel for derivatives computed by combined_evaluation_kernel
+template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
+std::function<void(const double*, double*)> combined_jacobian_vector_product_kernel(
+    signature, std::shared_ptr<std::shared_ptr<derivative_type[]>> qf_derivatives, const int* elements,
+    uint32_t num_elements)
+{
+  return [=](const double* du, double* dr) {
+    using test_space  = typename signature::return_type;
+    using trial_space = typename std::tuple_element<wrt, typename signature::parameter_types>::type;
+    action_of_gradient_kernel<Q, geom, test_space, trial_space>(du, dr, qf_derivatives->get(), elements,
+                                                                 num_elements);
+  };
+}
+
+/// @brief create an element gradient kernel for derivatives computed by combined_evaluation_kernel
+template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
+std::function<void(ExecArrayView<double, 3, ExecutionSpace::CPU>)> combined_element_gradient_kernel(
+    signature, std::shared_ptr<std::shared_ptr<derivative_type[]>> qf_derivatives, const int* elements,
+    uint32_t num_elements)
+{
+  return [=](ExecArrayView<double, 3, ExecutionSpace::CPU> K_elem) {
+    using test_space  = typename signature::return_type;
+    using trial_space = typename std::tuple_element<wrt, typename signature::parameter_types>::type;
+    element_gradient_kernel<geom, test_space, trial_space, Q>(K_elem, qf_derivatives->get(), elements,
+                                                              num_elements);
+  };
+}
+
 }  // namespace domain_integral
 
 }  // namespace serac
@@ -0,0 +1,71 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file element_costs.hpp
+ *
+ * @brief a low-overhead timer used by the integral kernels to measure per-element evaluation costs
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace serac {
+
+/**
+ * @brief measures the wall clock time spent evaluating blocks of consecutive elements, and
+ * distributes the time of each block evenly over its elements
+ *
+ * Reading the clock costs about as much as evaluating a cheap (e.g. linear) element, so it is
+ * only read once per block. Consecutive elements are usually close to each other in the mesh,
+ * so the block averages still resolve the spatial variation of the cost.
+ */
+class ElementCostTimer {
+public:
+  /// @brief the number of consecutive elements that are timed together
+  static constexpr uint32_t block_size = 64;
+
+  /**
+   * @brief create a timer that adds the measured costs to `costs[e]`
+   * @param costs the per-element costs, or nullptr to disable the measurement
+   */
+  explicit ElementCostTimer(double* costs) : costs_(costs) {}
+
+  /// @brief call before evaluating element `e`
+  void start(uint32_t e)
+  {
+    if (costs_ && e % block_size == 0) {
+      block_begin_ = e;
+      start_       = std::chrono::steady_clock::now();
+    }
+  }
+
+  /// @brief call after evaluating element `e` of `num_elements`
+  void stop(uint32_t e, uint32_t num_elements)
+  {
+    if (costs_ && ((e + 1) % block_size == 0 || e + 1 == num_elements)) {
+      double elapsed     = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+      double per_element = elapsed / double(e + 1 - block_begin_);
+      for (uint32_t i = block_begin_; i <= e; i++) {
+        costs_[i] += per_element;
+      }
+    }
+  }
+
+private:
+  /// @brief the per-element costs (not owned)
+  double* costs_;
+
+  /// @brief the first element of the block being timed
+  uint32_t block_begin_ = 0;
+
+  /// @brief when the evaluation of the block being timed started
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace serac
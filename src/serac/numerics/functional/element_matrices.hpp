@@ -0,0 +1,32 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file element_matrices.hpp
+ *
+ * @brief a type-erased view of the (unassembled) element matrices of an operator
+ */
+
+#pragma once
+
+#include <functional>
+
+#include "mfem.hpp"
+
+namespace serac {
+
+/**
+ * @brief called once per element matrix, with the local (L-vector) dofs of its rows and columns
+ *
+ * The arrays and the matrix are only valid for the duration of the call.
+ */
+using ElementMatrixVisitor =
+    std::function<void(const mfem::Array<int>& rows, const mfem::Array<int>& columns, const mfem::DenseMatrix& matrix)>;
+
+/// @brief calls the visitor with each element matrix of an operator
+using ElementMatrixSource = std::function<void(const ElementMatrixVisitor&)>;
+
+}  // namespace serac
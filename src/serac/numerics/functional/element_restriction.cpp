@@ -401,6 +401,8 @@ ElementRestriction::ElementRestriction(const mfem::FiniteElementSpace* fes, mfem
   num_elements   = uint64_t(dof_info.shape()[0]);
   nodes_per_elem = uint64_t(dof_info.shape()[1]);
   esize          = num_elements * nodes_per_elem * components;
+
+  memory = TrackedAllocation(MemoryCategory::ElementRestriction, sizeof(DoF) * num_elements * nodes_per_elem);
 }
 
 ElementRestriction::ElementRestriction(const mfem::FiniteElementSpace* fes, mfem::Geometry::Type face_geom,
@@ -416,6 +418,8 @@ ElementRestriction::ElementRestriction(const mfem::FiniteElementSpace* fes, mfem
   num_elements   = uint64_t(dof_info.shape()[0]);
   nodes_per_elem = uint64_t(dof_info.shape()[1]);
   esize          = num_elements * nodes_per_elem * components;
+
+  memory = TrackedAllocation(MemoryCategory::ElementRestriction, sizeof(DoF) * num_elements * nodes_per_elem);
 }
 
 uint64_t ElementRestriction::ESize() const { return esize; }
@@ -521,16 +525,35 @@ mfem::Array<int> BlockElementRestriction::bOffsets() const
   return offsets;
 };
 
+uint64_t BlockElementRestriction::NumElements() const
+{
+  uint64_t num_elements = 0;
+  for (const auto& [geom, restriction] : restrictions) {
+    num_elements += restriction.num_elements;
+  }
+  return num_elements;
+}
+
+uint64_t BlockElementRestriction::BytesMoved() const
+{
+  uint64_t bytes = 0;
+  for (const auto& [geom, restriction] : restrictions) {
+    uint64_t nodes = restriction.num_elements * restriction.nodes_per_elem;
+    bytes += nodes * (sizeof(DoF) + 2 * restriction.components * sizeof(double));
+  }
+  return bytes;
+}
+
 void BlockElementRestriction::Gather(const mfem::Vector& L_vector, mfem::BlockVector& E_block_vector) const
 {
-  for (auto [geom, restriction] : restrictions) {
+  for (const auto& [geom, restriction] : restrictions) {
     restriction.Gather(L_vector, E_block_vector.GetBlock(geom));
   }
 }
 
 void BlockElementRestriction::ScatterAdd(const mfem::BlockVector& E_block_vector, mfem::Vector& L_vector) const
 {
-  for (auto [geom, restriction] : restrictions) {
+  for (const auto& [geom, restriction] : restrictions) {
     restriction.ScatterAdd(E_block_vector.GetBlock(geom), L_vector);
   }
 }
@@ -5,6 +5,7 @@
 #include "mfem.hpp"
 #include "axom/core.hpp"
 #include "geometry.hpp"
+#include "serac/infrastructure/memory.hpp"
 
 inline bool isH1(const mfem::FiniteElementSpace& fes)
 {
@@ -199,6 +200,9 @@ struct ElementRestriction {
 
   /// whether the underlying dofs are arranged "byNodes" or "byVDim"
   mfem::Ordering::Type ordering;
+
+  /// records the size of `dof_info` for `serac::memoryReport()`
+  TrackedAllocation memory;
 };
 
 /**
@@ -225,6 +229,15 @@ struct BlockElementRestriction {
   /// block offsets used when constructing mfem::HypreParVectors
   mfem::Array<int> bOffsets() const;
 
+  /// the number of elements (of every geometry) this restriction operator acts on
+  uint64_t NumElements() const;
+
+  /**
+   * @brief an estimate of the number of bytes read and written by Gather() or ScatterAdd(): one "E-vector"
+   * value, one "L-vector" value and the dof information of its node, for each entry of the "E-vector"
+   */
+  uint64_t BytesMoved() const;
+
   /// "L->E" in mfem parlance, each element gathers the values that belong to it, and stores them in the "E-vector"
   void Gather(const mfem::Vector& L_vector, mfem::BlockVector& E_block_vector) const;
 
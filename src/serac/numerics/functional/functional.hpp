@@ -15,6 +15,7 @@
 #include "mfem.hpp"
 
 #include "serac/infrastructure/logger.hpp"
+#include "serac/infrastructure/profiling.hpp"
 #include "serac/numerics/functional/tensor.hpp"
 #include "serac/numerics/functional/quadrature.hpp"
 #include "serac/numerics/functional/finite_element.hpp"
@@ -23,6 +24,8 @@
 #include "serac/numerics/functional/differentiate_wrt.hpp"
 
 #include "serac/numerics/functional/element_restriction.hpp"
+#include "serac/numerics/functional/element_matrices.hpp"
+#include "serac/numerics/functional/setup_cache.hpp"
 
 #include "serac/numerics/functional/domain.hpp"
 
@@ -58,6 +61,25 @@ constexpr uint32_t index_of_differentiation()
   return NO_DIFFERENTIATION;
 }
 
+/**
+ * @brief given a list of types, this function returns the index that corresponds to the type
+ * `differentiate_wrt_scaled_this`, or NO_DIFFERENTIATION if there is no such type
+ *
+ * @tparam T a list of types, containing at most 1 `differentiate_wrt_scaled_this`
+ */
+template <typename... T>
+constexpr uint32_t index_of_scaled_differentiation()
+{
+  constexpr uint32_t n          = sizeof...(T);
+  bool               matching[] = {std::is_same_v<T, differentiate_wrt_scaled_this>...};
+  for (uint32_t i = 0; i < n; i++) {
+    if (matching[i]) {
+      return i;
+    }
+  }
+  return NO_DIFFERENTIATION;
+}
+
 /**
  * @brief Compile-time alias for index of differentiation
  */
@@ -140,6 +162,19 @@ generateParFiniteElementSpace(mfem::ParMesh* mesh)
   return std::pair(std::move(fes), std::move(fec));
 }
 
+namespace detail {
+
+/**
+ * @brief an estimate of the number of bytes read and written when applying a prolongation operator
+ * (or its transpose): the T-vector, the L-vector and one (value, column index) pair per row of the operator
+ */
+inline double prolongation_bytes(const mfem::Operator& P)
+{
+  return sizeof(double) * P.Width() + (2 * sizeof(double) + sizeof(int)) * P.Height();
+}
+
+}  // namespace detail
+
 /// @cond
 template <typename T, ExecutionSpace exec = serac::default_execution_space>
 class Functional;
@@ -232,27 +267,19 @@ public:
 
       // L->E
       for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
-        if (type == Domain::Type::Elements) {
-          G_trial_[type][i] = BlockElementRestriction(trial_fes[i]);
-        } else {
-          G_trial_[type][i] = BlockElementRestriction(trial_fes[i], FaceType::BOUNDARY);
-        }
+        G_trial_[type][i] = sharedBlockElementRestriction(trial_fes[i], type);
 
         // note: we have to use "Update" here, as mfem::BlockVector's
         // copy assignment ctor (operator=) doesn't let you make changes
         // to the block size
-        input_E_[type][i].Update(G_trial_[type][i].bOffsets(), mem_type);
+        input_E_[type][i].Update(G_trial_[type][i]->bOffsets(), mem_type);
       }
     }
 
     for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
-      if (type == Domain::Type::Elements) {
-        G_test_[type] = BlockElementRestriction(test_fes);
-      } else {
-        G_test_[type] = BlockElementRestriction(test_fes, FaceType::BOUNDARY);
-      }
+      G_test_[type] = sharedBlockElementRestriction(test_fes, type);
 
-      output_E_[type].Update(G_test_[type].bOffsets(), mem_type);
+      output_E_[type].Update(G_test_[type]->bOffsets(), mem_type);
     }
 
     P_test_ = test_space_->GetProlongationMatrix();
@@ -402,7 +429,9 @@ public:
    */
   void ActionOfGradient(const mfem::Vector& input_T, mfem::Vector& output_T, uint32_t which) const
   {
-    P_trial_[which]->Mult(input_T, input_L_[which]);
+    CALI_CXX_MARK_SCOPE("Functional::ActionOfGradient");
+
+    prolongate(which, input_T);
 
     output_L_ = 0.0;
 
@@ -414,18 +443,18 @@ public:
       auto type = integral.domain_.type_;
 
       if (!already_computed[type]) {
-        G_trial_[type][which].Gather(input_L_[which], input_E_[type][which]);
+        gather(type, which);
         already_computed[type] = true;
       }
 
       integral.GradientMult(input_E_[type][which], output_E_[type], which);
 
       // scatter-add to compute residuals on the local processor
-      G_test_[type].ScatterAdd(output_E_[type], output_L_);
+      scatter_add(type);
     }
 
     // scatter-add to compute global residuals
-    P_test_->MultTranspose(output_L_, output_T);
+    prolongate_transpose(output_T);
   }
 
   /**
@@ -443,11 +472,117 @@ public:
   template <uint32_t wrt, typename... T>
   typename operator_paren_return<wrt>::type operator()(DifferentiateWRT<wrt>, double t, const T&... args)
   {
+    return evaluate<wrt>(NO_DIFFERENTIATION, 0.0, t, args...);
+  }
+
+  /**
+   * @brief this function lets the user evaluate the serac::Functional with the given trial space values
+   *
+   * note: it accepts exactly `num_trial_spaces` arguments of type mfem::Vector. Additionally, one of those
+   * arguments may be wrapped by `differentiate_wrt(arg)`, to request the derivative w.r.t. that argument, and
+   * the argument immediately before it may be wrapped by `differentiate_wrt(arg, scale)`, to request the
+   * derivative w.r.t. the linear combination d/d(arg i) + scale * d/d(arg i-1) instead. The combined
+   * derivative is computed in a single pass over the elements, and assembles into a single sparse matrix.
+   *
+   * @code{.cpp}
+   * // J := df/da + c0 * df/du
+   * auto [r, J] = f(t, differentiate_wrt(u, c0), differentiate_wrt(a));
+   * @endcode
+   *
+   * @tparam T the types of the arguments passed in
+   * @param t the time
+   * @param args the trial space dofs used to carry out the calculation
+   */
+  template <typename... T>
+  auto operator()(double t, const T&... args)
+  {
+    constexpr int num_differentiated_arguments = (std::is_same_v<T, differentiate_wrt_this> + ...);
+    constexpr int num_scaled_arguments         = (std::is_same_v<T, differentiate_wrt_scaled_this> + ...);
+    static_assert(num_differentiated_arguments <= 1,
+                  "Error: Functional::operator() can only differentiate w.r.t. 1 argument a time");
+    static_assert(num_scaled_arguments <= 1,
+                  "Error: Functional::operator() can only differentiate w.r.t. 1 additional (scaled) argument");
+    static_assert(sizeof...(T) == num_trial_spaces,
+                  "Error: Functional::operator() must take exactly as many arguments as trial spaces");
+
+    [[maybe_unused]] constexpr uint32_t i = index_of_differentiation<T...>();
+    [[maybe_unused]] constexpr uint32_t j = index_of_scaled_differentiation<T...>();
+
+    if constexpr (j == NO_DIFFERENTIATION) {
+      return (*this)(DifferentiateWRT<i>{}, t, args...);
+    } else {
+      static_assert(i != NO_DIFFERENTIATION && j + 1 == i,
+                    "Error: the scaled argument of a combined derivative must immediately precede the "
+                    "argument being differentiated");
+
+      double scale = 0.0;
+      (
+          [&scale](const auto& arg) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, differentiate_wrt_scaled_this>) {
+              scale = arg.scale;
+            }
+          }(args),
+          ...);
+
+      return evaluate<i>(j, scale, t, args...);
+    }
+  }
+
+  /**
+   * @brief A flag to update the quadrature data for this operator following the computation
+   *
+   * Typically this is set to false during nonlinear solution iterations and is set to true for the
+   * final pass once equilibrium is found.
+   *
+   * @param update_flag A flag to update the related quadrature data
+   */
+  void updateQdata(bool update_flag) { update_qdata_ = update_flag; }
+
+  /**
+   * @brief start (or stop) measuring the wall clock time spent evaluating each element of the domain integrals
+   *
+   * Enabling the measurement resets any previously measured costs. The measured costs can be used
+   * to rebalance the mesh partition, see `StateManager::rebalance`.
+   *
+   * @param enable whether or not to measure the per-element costs
+   */
+  void enableElementCosts(bool enable = true)
+  {
+    for (auto& integral : integrals_) {
+      integral.enableElementCosts(enable);
+    }
+  }
+
+  /**
+   * @brief the time (in seconds) spent evaluating each (local) element since `enableElementCosts` was called,
+   * summed over all the domain integrals of this Functional
+   */
+  mfem::Vector elementCosts() const
+  {
+    mfem::Vector costs(test_space_->GetMesh()->GetNE());
+    costs = 0.0;
+    for (auto& integral : integrals_) {
+      integral.accumulateElementCosts(costs);
+    }
+    return costs;
+  }
+
+private:
+  /**
+   * @brief evaluate the Functional, optionally differentiating w.r.t. argument `wrt`, or w.r.t.
+   * the linear combination d/d(arg wrt) + secondary_scale * d/d(arg secondary)
+   */
+  template <uint32_t wrt, typename... T>
+  typename operator_paren_return<wrt>::type evaluate(uint32_t secondary, double secondary_scale, double t,
+                                                      const T&... args)
+  {
+    CALI_CXX_MARK_SCOPE("Functional::evaluate");
+
     const mfem::Vector* input_T[] = {&static_cast<const mfem::Vector&>(args)...};
 
     // get the values for each local processor
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
-      P_trial_[i]->Mult(*input_T[i], input_L_[i]);
+      prolongate(i, *input_T[i]);
     }
 
     output_L_ = 0.0;
@@ -461,19 +596,19 @@ public:
 
       for (auto i : integral.active_trial_spaces_) {
         if (!already_computed[type][i]) {
-          G_trial_[type][i].Gather(input_L_[i], input_E_[type][i]);
+          gather(type, i);
           already_computed[type][i] = true;
         }
       }
 
-      integral.Mult(t, input_E_[type], output_E_[type], wrt, update_qdata_);
+      integral.Mult(t, input_E_[type], output_E_[type], wrt, update_qdata_, secondary, secondary_scale);
 
       // scatter-add to compute residuals on the local processor
-      G_test_[type].ScatterAdd(output_E_[type], output_L_);
+      scatter_add(type);
     }
 
     // scatter-add to compute global residuals
-    P_test_->MultTranspose(output_L_, output_T_);
+    prolongate_transpose(output_T_);
 
     if constexpr (wrt != NO_DIFFERENTIATION) {
       // if the user has indicated they'd like to evaluate and differentiate w.r.t.
@@ -494,32 +629,38 @@ public:
     }
   }
 
-  /// @overload
-  template <typename... T>
-  auto operator()(double t, const T&... args)
+  /// @brief "T->L": compute the values of trial space `i` on this processor, from the T-vector @a input_T
+  void prolongate(uint32_t i, const mfem::Vector& input_T) const
   {
-    constexpr int num_differentiated_arguments = (std::is_same_v<T, differentiate_wrt_this> + ...);
-    static_assert(num_differentiated_arguments <= 1,
-                  "Error: Functional::operator() can only differentiate w.r.t. 1 argument a time");
-    static_assert(sizeof...(T) == num_trial_spaces,
-                  "Error: Functional::operator() must take exactly as many arguments as trial spaces");
+    profiling::KernelRegion region("serac::Functional::prolongation", detail::prolongation_bytes(*P_trial_[i]));
+    P_trial_[i]->Mult(input_T, input_L_[i]);
+  }
 
-    [[maybe_unused]] constexpr uint32_t i = index_of_differentiation<T...>();
+  /// @brief "L->E": gather the values of trial space `i` on each element of the given domain type
+  void gather(Domain::Type type, uint32_t i) const
+  {
+    const BlockElementRestriction& G = *G_trial_[type][i];
+    profiling::KernelRegion region("serac::Functional::gather", double(G.BytesMoved()), double(G.NumElements()));
+    G.Gather(input_L_[i], input_E_[type][i]);
+  }
 
-    return (*this)(DifferentiateWRT<i>{}, t, args...);
+  /// @brief "E->L": add the element residuals of the given domain type to the residual on this processor
+  void scatter_add(Domain::Type type) const
+  {
+    const BlockElementRestriction& G = *G_test_[type];
+    profiling::KernelRegion region("serac::Functional::scatter_add", double(G.BytesMoved()),
+                                   double(G.NumElements()));
+    G.ScatterAdd(output_E_[type], output_L_);
   }
 
-  /**
-   * @brief A flag to update the quadrature data for this operator following the computation
-   *
-   * Typically this is set to false during nonlinear solution iterations and is set to true for the
-   * final pass once equilibrium is found.
-   *
-   * @param update_flag A flag to update the related quadrature data
-   */
-  void updateQdata(bool update_flag) { update_qdata_ = update_flag; }
+  /// @brief "L->T": sum the residuals of shared degrees of freedom, and store the result in @a output_T
+  void prolongate_transpose(mfem::Vector& output_T) const
+  {
+    profiling::KernelRegion region("serac::Functional::prolongation_transpose",
+                                   detail::prolongation_bytes(*P_test_));
+    P_test_->MultTranspose(output_L_, output_T);
+  }
 
-private:
   /// @brief flag for denoting when a residual evaluation should update the material state buffers
   bool update_qdata_;
 
@@ -537,7 +678,7 @@ private:
     Gradient(Functional<test(trials...), exec>& f, uint32_t which = 0)
         : mfem::Operator(f.test_space_->GetTrueVSize(), f.trial_space_[which]->GetTrueVSize()),
           form_(f),
-          lookup_tables(f.G_test_[Domain::Type::Elements], f.G_trial_[Domain::Type::Elements][which]),
+          lookup_tables(*f.G_test_[Domain::Type::Elements], *f.G_trial_[Domain::Type::Elements][which]),
           which_argument(which),
           test_space_(f.test_space_),
           trial_space_(f.trial_space_[which]),
@@ -562,31 +703,24 @@ private:
       return df_;
     }
 
-    /// @brief assemble element matrices and form an mfem::HypreParMatrix
-    std::unique_ptr<mfem::HypreParMatrix> assemble()
-    {
-      // the CSR graph (sparsity pattern) is reusable, so we cache
-      // that and ask mfem to not free that memory in ~SparseMatrix()
-      constexpr bool sparse_matrix_frees_graph_ptrs = false;
+    /// @brief the element matrices of each element geometry, for each type of domain (elements, boundary elements)
+    using ElementGradients = std::array<std::map<mfem::Geometry::Type, ExecArray<double, 3, exec>>, Domain::num_types>;
 
-      // the CSR values are NOT reusable, so we pass ownership of
-      // them to the mfem::SparseMatrix, to be freed in ~SparseMatrix()
-      constexpr bool sparse_matrix_frees_values_ptr = true;
-
-      constexpr bool col_ind_is_sorted = true;
-
-      double* values = new double[lookup_tables.nnz]{};
+    /// @brief compute the element matrices, without assembling them into a sparse matrix
+    ElementGradients elementGradients()
+    {
+      CALI_CXX_MARK_SCOPE("Gradient::elementGradients");
 
-      std::map<mfem::Geometry::Type, ExecArray<double, 3, exec>> element_gradients[Domain::num_types];
+      ElementGradients element_gradients;
 
       for (auto& integral : form_.integrals_) {
         auto& K_elem             = element_gradients[integral.domain_.type_];
-        auto& test_restrictions  = form_.G_test_[integral.domain_.type_].restrictions;
-        auto& trial_restrictions = form_.G_trial_[integral.domain_.type_][which_argument].restrictions;
+        auto& test_restrictions  = form_.G_test_[integral.domain_.type_]->restrictions;
+        auto& trial_restrictions = form_.G_trial_[integral.domain_.type_][which_argument]->restrictions;
 
         if (K_elem.empty()) {
           for (auto& [geom, test_restriction] : test_restrictions) {
-            auto& trial_restriction = trial_restrictions[geom];
+            auto& trial_restriction = trial_restrictions.at(geom);
 
             K_elem[geom] = ExecArray<double, 3, exec>(test_restriction.num_elements,
                                                       trial_restriction.nodes_per_elem * trial_restriction.components,
@@ -599,19 +733,102 @@ private:
         integral.ComputeElementGradients(K_elem, which_argument);
       }
 
+      return element_gradients;
+    }
+
+    /**
+     * @brief compute the element matrices (of the elements and boundary elements), and visit each one without
+     * assembling them, e.g. to build the coarse levels of a p-multigrid preconditioner
+     */
+    void forEachElementMatrix(const ElementMatrixVisitor& visit)
+    {
+      CALI_CXX_MARK_SCOPE("Gradient::forEachElementMatrix");
+
+      ElementGradients element_gradients = elementGradients();
+
+      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+        auto& K_elem = element_gradients[type];
+        if (K_elem.empty()) {
+          continue;
+        }
+
+        auto& test_restrictions  = form_.G_test_[type]->restrictions;
+        auto& trial_restrictions = form_.G_trial_[type][which_argument]->restrictions;
+
+        for (auto& [geom, elem_matrices] : K_elem) {
+          const auto& test_restriction  = test_restrictions.at(geom);
+          const auto& trial_restriction = trial_restrictions.at(geom);
+
+          std::vector<DoF> test_vdofs(test_restriction.nodes_per_elem * test_restriction.components);
+          std::vector<DoF> trial_vdofs(trial_restriction.nodes_per_elem * trial_restriction.components);
+
+          mfem::Array<int>  rows(int(test_vdofs.size()));
+          mfem::Array<int>  columns(int(trial_vdofs.size()));
+          mfem::DenseMatrix matrix(rows.Size(), columns.Size());
+
+          for (axom::IndexType e = 0; e < elem_matrices.shape()[0]; e++) {
+            test_restriction.GetElementVDofs(e, test_vdofs);
+            trial_restriction.GetElementVDofs(e, trial_vdofs);
+
+            for (uint32_t j = 0; j < uint32_t(rows.Size()); j++) {
+              rows[int(j)] = int(test_vdofs[j].index());
+            }
+
+            for (uint32_t i = 0; i < uint32_t(columns.Size()); i++) {
+              columns[int(i)] = int(trial_vdofs[i].index());
+
+              // the element matrix kernel is transposed (see assemble())
+              for (uint32_t j = 0; j < uint32_t(rows.Size()); j++) {
+                matrix(int(j), int(i)) = test_vdofs[j].sign() * trial_vdofs[i].sign() * elem_matrices(e, i, j);
+              }
+            }
+
+            visit(rows, columns, matrix);
+          }
+        }
+      }
+    }
+
+    /// @brief assemble element matrices and form an mfem::HypreParMatrix
+    std::unique_ptr<mfem::HypreParMatrix> assemble()
+    {
+      CALI_CXX_MARK_SCOPE("Gradient::assemble");
+
+      // the CSR graph (sparsity pattern) is reusable, so we cache
+      // that and ask mfem to not free that memory in ~SparseMatrix()
+      constexpr bool sparse_matrix_frees_graph_ptrs = false;
+
+      // the CSR values are NOT reusable, so we pass ownership of
+      // them to the mfem::SparseMatrix, to be freed in ~SparseMatrix()
+      constexpr bool sparse_matrix_frees_values_ptr = true;
+
+      constexpr bool col_ind_is_sorted = true;
+
+      double* values = new double[lookup_tables.nnz]{};
+
+      ElementGradients element_gradients = elementGradients();
+
       for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
         auto& K_elem             = element_gradients[type];
-        auto& test_restrictions  = form_.G_test_[type].restrictions;
-        auto& trial_restrictions = form_.G_trial_[type][which_argument].restrictions;
+        auto& test_restrictions  = form_.G_test_[type]->restrictions;
+        auto& trial_restrictions = form_.G_trial_[type][which_argument]->restrictions;
 
         if (!K_elem.empty()) {
           for (auto [geom, elem_matrices] : K_elem) {
-            std::vector<DoF> test_vdofs(test_restrictions[geom].nodes_per_elem * test_restrictions[geom].components);
-            std::vector<DoF> trial_vdofs(trial_restrictions[geom].nodes_per_elem * trial_restrictions[geom].components);
+            const auto& test_restriction  = test_restrictions.at(geom);
+            const auto& trial_restriction = trial_restrictions.at(geom);
+
+            // reads each element matrix entry, and updates the corresponding nonzero entry
+            profiling::KernelRegion region("serac::Functional::Gradient::scatter",
+                                           3.0 * sizeof(double) * double(elem_matrices.size()),
+                                           double(elem_matrices.shape()[0]));
+
+            std::vector<DoF> test_vdofs(test_restriction.nodes_per_elem * test_restriction.components);
+            std::vector<DoF> trial_vdofs(trial_restriction.nodes_per_elem * trial_restriction.components);
 
             for (axom::IndexType e = 0; e < elem_matrices.shape()[0]; e++) {
-              test_restrictions[geom].GetElementVDofs(e, test_vdofs);
-              trial_restrictions[geom].GetElementVDofs(e, trial_vdofs);
+              test_restriction.GetElementVDofs(e, test_vdofs);
+              trial_restriction.GetElementVDofs(e, trial_vdofs);
 
               for (uint32_t i = 0; i < uint32_t(elem_matrices.shape()[1]); i++) {
                 int col = int(trial_vdofs[i].index());
@@ -651,10 +868,14 @@ private:
 
       auto* P = trial_space_->Dof_TrueDof_Matrix();
 
+      CALI_MARK_BEGIN("Gradient::RAP");
       std::unique_ptr<mfem::HypreParMatrix> K(mfem::RAP(R, A, P));
+      CALI_MARK_END("Gradient::RAP");
 
       delete A;
 
+      matrix_memory_ = TrackedAllocation(MemoryCategory::SparseMatrix, memoryFootprint(*K));
+
       return K;
     };
 
@@ -677,6 +898,13 @@ private:
      */
     std::vector<int> col_ind_copy_;
 
+    /**
+     * @brief records the size of the most recently assembled matrix for `serac::memoryReport()`
+     * @note the matrix itself is owned by the caller of `assemble()`, so this assumes that it is kept
+     * until the next assembly
+     */
+    TrackedAllocation matrix_memory_;
+
     /**
      * @brief this member variable tells us which argument the associated Functional this gradient
      *  corresponds to:
@@ -714,7 +942,7 @@ private:
   /// @brief The input set of local DOF values (i.e., on the current rank)
   mutable mfem::Vector input_L_[num_trial_spaces];
 
-  BlockElementRestriction G_trial_[Domain::num_types][num_trial_spaces];
+  std::shared_ptr<const BlockElementRestriction> G_trial_[Domain::num_types][num_trial_spaces];
 
   mutable std::vector<mfem::BlockVector> input_E_[Domain::num_types];
 
@@ -722,7 +950,7 @@ private:
 
   mutable mfem::BlockVector output_E_[Domain::num_types];
 
-  BlockElementRestriction G_test_[Domain::num_types];
+  std::shared_ptr<const BlockElementRestriction> G_test_[Domain::num_types];
 
   /// @brief The output set of local DOF values (i.e., on the current rank)
   mutable mfem::Vector output_L_;
@@ -99,16 +99,12 @@ public:
       input_L_[i].SetSize(P_trial_[i]->Height(), mfem::Device::GetMemoryType());
 
       for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
-        if (type == Domain::Type::Elements) {
-          G_trial_[type][i] = BlockElementRestriction(trial_fes[i]);
-        } else {
-          G_trial_[type][i] = BlockElementRestriction(trial_fes[i], FaceType::BOUNDARY);
-        }
+        G_trial_[type][i] = sharedBlockElementRestriction(trial_fes[i], type);
 
         // note: we have to use "Update" here, as mfem::BlockVector's
         // copy assignment ctor (operator=) doesn't let you make changes
         // to the block size
-        input_E_[type][i].Update(G_trial_[type][i].bOffsets(), mem_type);
+        input_E_[type][i].Update(G_trial_[type][i]->bOffsets(), mem_type);
       }
     }
 
@@ -281,7 +277,9 @@ public:
    */
   double ActionOfGradient(const mfem::Vector& input_T, uint32_t which) const
   {
-    P_trial_[which]->Mult(input_T, input_L_[which]);
+    CALI_CXX_MARK_SCOPE("Functional::ActionOfGradient");
+
+    prolongate(which, input_T);
 
     output_L_ = 0.0;
 
@@ -293,7 +291,7 @@ public:
       auto type = integral.domain_.type_;
 
       if (!already_computed[type]) {
-        G_trial_[type][which].Gather(input_L_[which], input_E_[type][which]);
+        gather(type, which);
         already_computed[type] = true;
       }
 
@@ -322,11 +320,13 @@ public:
   template <uint32_t wrt, typename... T>
   typename operator_paren_return<wrt>::type operator()(DifferentiateWRT<wrt>, double t, const T&... args)
   {
+    CALI_CXX_MARK_SCOPE("Functional::evaluate");
+
     const mfem::Vector* input_T[] = {&static_cast<const mfem::Vector&>(args)...};
 
     // get the values for each local processor
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
-      P_trial_[i]->Mult(*input_T[i], input_L_[i]);
+      prolongate(i, *input_T[i]);
     }
 
     output_L_ = 0.0;
@@ -340,7 +340,7 @@ public:
 
       for (auto i : integral.active_trial_spaces_) {
         if (!already_computed[type][i]) {
-          G_trial_[type][i].Gather(input_L_[i], input_E_[type][i]);
+          gather(type, i);
           already_computed[type][i] = true;
         }
       }
@@ -392,6 +392,21 @@ public:
   }
 
 private:
+  /// @brief "T->L": compute the values of trial space `i` on this processor, from the T-vector @a input_T
+  void prolongate(uint32_t i, const mfem::Vector& input_T) const
+  {
+    profiling::KernelRegion region("serac::Functional::prolongation", detail::prolongation_bytes(*P_trial_[i]));
+    P_trial_[i]->Mult(input_T, input_L_[i]);
+  }
+
+  /// @brief "L->E": gather the values of trial space `i` on each element of the given domain type
+  void gather(Domain::Type type, uint32_t i) const
+  {
+    const BlockElementRestriction& G = *G_trial_[type][i];
+    profiling::KernelRegion region("serac::Functional::gather", double(G.BytesMoved()), double(G.NumElements()));
+    G.Gather(input_L_[i], input_E_[type][i]);
+  }
+
   /**
    * @brief Indicates whether to obtain values or gradients from a calculation
    */
@@ -431,7 +446,7 @@ private:
 
       for (auto& integral : form_.integrals_) {
         auto& K_elem             = element_gradients[integral.domain_.type_];
-        auto& trial_restrictions = form_.G_trial_[integral.domain_.type_][which_argument].restrictions;
+        auto& trial_restrictions = form_.G_trial_[integral.domain_.type_][which_argument]->restrictions;
 
         if (K_elem.empty()) {
           for (auto& [geom, trial_restriction] : trial_restrictions) {
@@ -447,14 +462,15 @@ private:
 
       for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
         auto& K_elem             = element_gradients[type];
-        auto& trial_restrictions = form_.G_trial_[type][which_argument].restrictions;
+        auto& trial_restrictions = form_.G_trial_[type][which_argument]->restrictions;
 
         if (!K_elem.empty()) {
           for (auto [geom, elem_matrices] : K_elem) {
-            std::vector<DoF> trial_vdofs(trial_restrictions[geom].nodes_per_elem * trial_restrictions[geom].components);
+            const auto&      trial_restriction = trial_restrictions.at(geom);
+            std::vector<DoF> trial_vdofs(trial_restriction.nodes_per_elem * trial_restriction.components);
 
             for (axom::IndexType e = 0; e < elem_matrices.shape()[0]; e++) {
-              trial_restrictions[geom].GetElementVDofs(e, trial_vdofs);
+              trial_restriction.GetElementVDofs(e, trial_vdofs);
 
               // note: elem_matrices.shape()[1] is 1 for a QoI
               for (axom::IndexType i = 0; i < elem_matrices.shape()[1]; i++) {
@@ -503,7 +519,7 @@ private:
   /// @brief The input set of local DOF values (i.e., on the current rank)
   mutable mfem::Vector input_L_[num_trial_spaces];
 
-  BlockElementRestriction G_trial_[Domain::num_types][num_trial_spaces];
+  std::shared_ptr<const BlockElementRestriction> G_trial_[Domain::num_types][num_trial_spaces];
 
   mutable std::vector<mfem::BlockVector> input_E_[Domain::num_types];
 
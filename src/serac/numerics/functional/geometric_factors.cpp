@@ -85,6 +85,9 @@ GeometricFactors::GeometricFactors(const Domain& d, int q, mfem::Geometry::Type
   X = mfem::Vector(int(num_elements) * qpts_per_elem * spatial_dim);
   J = mfem::Vector(int(num_elements) * qpts_per_elem * spatial_dim * geometry_dim);
 
+  memory = TrackedAllocation(MemoryCategory::GeometricFactors,
+                             sizeof(double) * std::size_t(X.Size() + J.Size()) + sizeof(int) * num_elements);
+
 #define DISPATCH_KERNEL(GEOM, P, Q)                                                                           \
   if (g == mfem::Geometry::GEOM && p == P && q == Q) {                                                        \
     compute_geometric_factors<Q, mfem::Geometry::GEOM, H1<P, dimension_of(mfem::Geometry::GEOM)> >(X, J, X_e, \
@@ -162,6 +165,9 @@ GeometricFactors::GeometricFactors(const Domain& d, int q, mfem::Geometry::Type
   X = mfem::Vector(int(num_elements) * qpts_per_elem * spatial_dim);
   J = mfem::Vector(int(num_elements) * qpts_per_elem * spatial_dim * geometry_dim);
 
+  memory = TrackedAllocation(MemoryCategory::GeometricFactors,
+                             sizeof(double) * std::size_t(X.Size() + J.Size()) + sizeof(int) * num_elements);
+
 #define DISPATCH_KERNEL(GEOM, P, Q)                                                                               \
   if (g == mfem::Geometry::GEOM && p == P && q == Q) {                                                            \
     compute_geometric_factors<Q, mfem::Geometry::GEOM, H1<P, dimension_of(mfem::Geometry::GEOM) + 1> >(X, J, X_e, \
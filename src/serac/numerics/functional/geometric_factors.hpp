@@ -3,6 +3,7 @@
 #include "serac/numerics/functional/element_restriction.hpp"  // for FaceType
 #include "serac/numerics/functional/finite_element.hpp"       // for Geometry
 #include "serac/numerics/functional/domain.hpp"
+#include "serac/infrastructure/memory.hpp"
 
 #include "mfem.hpp"
 
@@ -62,6 +63,9 @@ struct GeometricFactors {
 
   /// the number of elements in the domain
   std::size_t num_elements;
+
+  /// records the size of `X`, `J` and `elements` for `serac::memoryReport()`
+  TrackedAllocation memory;
 };
 
 }  // namespace serac
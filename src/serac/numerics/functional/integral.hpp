@@ -8,11 +8,18 @@
 
 #include <array>
 #include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
 
 #include "mfem.hpp"
 
 #include "serac/infrastructure/accelerator.hpp"
+#include "serac/infrastructure/memory.hpp"
+#include "serac/infrastructure/profiling.hpp"
 #include "serac/numerics/functional/geometric_factors.hpp"
+#include "serac/numerics/functional/setup_cache.hpp"
 #include "serac/numerics/functional/function_signature.hpp"
 #include "serac/numerics/functional/domain_integral_kernels.hpp"
 #include "serac/numerics/functional/boundary_integral_kernels.hpp"
@@ -41,6 +48,10 @@ struct Integral {
     evaluation_with_AD_.resize(num_trial_spaces);
     jvp_.resize(num_trial_spaces);
     element_gradient_.resize(num_trial_spaces);
+    combined_evaluation_.resize(num_trial_spaces);
+    combined_jvp_.resize(num_trial_spaces);
+    combined_element_gradient_.resize(num_trial_spaces);
+    derivative_bytes_.resize(num_trial_spaces);
 
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
       functional_to_integral_index_[active_trial_spaces_[i]] = i;
@@ -61,22 +72,49 @@ struct Integral {
    * @param update_state whether or not to store the updated state values computed in the q-function. For plasticity and
    * other path-dependent materials, this flag should only be set to `true` once a solution to the nonlinear system has
    * been found.
+   * @param secondary_index if specified (must be differentiation_index - 1), the stored derivatives are those of
+   * the linear combination d/d(differentiation_index) + secondary_scale * d/d(secondary_index)
+   * @param secondary_scale the coefficient of the secondary derivative term
    */
   void Mult(double t, const std::vector<mfem::BlockVector>& input_E, mfem::BlockVector& output_E,
-            uint32_t differentiation_index, bool update_state) const
+            uint32_t differentiation_index, bool update_state, uint32_t secondary_index = NO_DIFFERENTIATION,
+            double secondary_scale = 0.0) const
   {
+    CALI_CXX_MARK_SCOPE("Integral::Mult");
+
     output_E = 0.0;
 
     bool with_AD =
         (functional_to_integral_index_.count(differentiation_index) > 0 && differentiation_index != NO_DIFFERENTIATION);
-    auto& kernels =
-        (with_AD) ? evaluation_with_AD_[functional_to_integral_index_.at(differentiation_index)] : evaluation_;
-    for (auto& [geometry, func] : kernels) {
-      std::vector<const double*> inputs(active_trial_spaces_.size());
-      for (std::size_t i = 0; i < active_trial_spaces_.size(); i++) {
-        inputs[i] = input_E[uint32_t(active_trial_spaces_[i])].GetBlock(geometry).Read();
+    bool with_secondary_AD =
+        (functional_to_integral_index_.count(secondary_index) > 0 && secondary_index != NO_DIFFERENTIATION);
+
+    // keep track of where the derivative w.r.t. differentiation_index is stored,
+    // for use in GradientMult() and ComputeElementGradients()
+    derivative_sources_.erase(differentiation_index);
+    if (with_secondary_AD && secondary_index != differentiation_index) {
+      uint32_t j = functional_to_integral_index_.at(secondary_index);
+      if (with_AD) {
+        uint32_t i = functional_to_integral_index_.at(differentiation_index);
+        SLIC_ERROR_IF(combined_evaluation_[i].empty() && !evaluation_with_AD_[i].empty(),
+                      "Combined differentiation is only supported for consecutive arguments of the same type");
+        derivative_sources_[differentiation_index] = {i, true, 1.0};
+        call_kernels(combined_evaluation_[i], &derivative_bytes_[i], t, input_E, output_E, update_state,
+                     secondary_scale);
+      } else {
+        // this integral only depends on the secondary argument, so the combined
+        // derivative is just a scaled derivative w.r.t. the secondary argument
+        derivative_sources_[differentiation_index] = {j, false, secondary_scale};
+        call_kernels(evaluation_with_AD_[j], &derivative_bytes_[j], t, input_E, output_E, update_state);
       }
-      func(t, inputs, output_E.GetBlock(geometry).ReadWrite(), update_state);
+      return;
+    }
+
+    if (with_AD) {
+      uint32_t i = functional_to_integral_index_.at(differentiation_index);
+      call_kernels(evaluation_with_AD_[i], &derivative_bytes_[i], t, input_E, output_E, update_state);
+    } else {
+      call_kernels(evaluation_, nullptr, t, input_E, output_E, update_state);
     }
   }
 
@@ -92,13 +130,26 @@ struct Integral {
    */
   void GradientMult(const mfem::BlockVector& input_E, mfem::BlockVector& output_E, uint32_t differentiation_index) const
   {
+    CALI_CXX_MARK_SCOPE("Integral::GradientMult");
+
     output_E = 0.0;
 
     // if this integral actually depends on the specified variable
-    if (functional_to_integral_index_.count(differentiation_index) > 0) {
-      for (auto& [geometry, func] : jvp_[functional_to_integral_index_.at(differentiation_index)]) {
+    if (auto source = derivative_source(differentiation_index)) {
+      auto& kernels = (source->combined) ? combined_jvp_[source->index] : jvp_[source->index];
+      for (auto& [geometry, func] : kernels) {
+        // reads the input and the stored q-function derivatives, and updates the output
+        double bytes = sizeof(double) * (input_E.GetBlock(geometry).Size() + 2.0 * output_E.GetBlock(geometry).Size()) +
+                       double(derivative_bytes_[source->index].at(geometry));
+        profiling::KernelRegion geometry_region(region_name(geometry, "action"), bytes, num_elements(geometry),
+                                                num_qpts(geometry));
+
         func(input_E.GetBlock(geometry).Read(), output_E.GetBlock(geometry).ReadWrite());
       }
+
+      if (source->scale != 1.0) {
+        output_E *= source->scale;
+      }
     }
   }
 
@@ -113,9 +164,74 @@ struct Integral {
                                uint32_t differentiation_index) const
   {
     // if this integral actually depends on the specified variable
-    if (functional_to_integral_index_.count(differentiation_index) > 0) {
-      for (auto& [geometry, func] : element_gradient_[functional_to_integral_index_.at(differentiation_index)]) {
-        func(view(K_e[geometry]));
+    if (auto source = derivative_source(differentiation_index)) {
+      CALI_CXX_MARK_SCOPE("Integral::ComputeElementGradients");
+
+      auto& kernels = (source->combined) ? combined_element_gradient_[source->index] : element_gradient_[source->index];
+      for (auto& [geometry, func] : kernels) {
+        // reads the stored q-function derivatives, and updates the element matrices
+        double bytes = 2.0 * sizeof(double) * double(K_e[geometry].size()) +
+                       double(derivative_bytes_[source->index].at(geometry));
+        profiling::KernelRegion geometry_region(region_name(geometry, "element_gradients"), bytes,
+                                                num_elements(geometry), num_qpts(geometry));
+
+        if (source->scale == 1.0) {
+          func(view(K_e[geometry]));
+        } else if (source->scale != 0.0) {
+          // the element gradient kernels accumulate into K_e, so the scaled
+          // contributions are computed separately and then added in
+          auto&                                     K = K_e[geometry];
+          ExecArray<double, 3, ExecutionSpace::CPU> K_scaled(K.shape()[0], K.shape()[1], K.shape()[2]);
+          detail::zero_out(K_scaled);
+          func(view(K_scaled));
+          for (axom::IndexType k = 0; k < K.size(); k++) {
+            K.data()[k] += source->scale * K_scaled.data()[k];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief start (or stop) measuring the time spent evaluating each element of this integral
+   *
+   * @param enable whether or not to measure the per-element costs. Enabling the measurement also resets
+   * any previously accumulated costs to zero.
+   *
+   * @note only the evaluation of the integrand (with or without derivatives) is measured, not the
+   * action of its gradient
+   */
+  void enableElementCosts(bool enable)
+  {
+    for (auto& [geometry, costs] : element_costs_) {
+      if (enable) {
+        costs->assign(domain_.get(geometry).size(), 0.0);
+      } else {
+        costs->clear();
+        costs->shrink_to_fit();
+      }
+    }
+  }
+
+  /**
+   * @brief add the time (in seconds) spent evaluating each element since the measurement was enabled
+   *
+   * @param costs the per-element costs, indexed by the mfem element number. The cost of a boundary element
+   * is attributed to the element that it bounds.
+   */
+  void accumulateElementCosts(mfem::Vector& costs) const
+  {
+    for (auto& [geometry, element_costs] : element_costs_) {
+      const std::vector<int>& mfem_ids = domain_.get_mfem_ids(geometry);
+      SLIC_ERROR_IF(!element_costs->empty() && mfem_ids.size() != element_costs->size(),
+                    "the domain of integration does not record the mfem ids of its elements");
+      for (std::size_t e = 0; e < element_costs->size(); e++) {
+        int elem = mfem_ids[e];
+        if (domain_.type_ == Domain::Type::BoundaryElements) {
+          int unused;
+          domain_.mesh_.GetFaceElements(elem, &elem, &unused);
+        }
+        costs[elem] += (*element_costs)[e];
       }
     }
   }
@@ -144,6 +260,60 @@ struct Integral {
   /// @brief kernels for calculation of element jacobians
   std::vector<std::map<mfem::Geometry::Type, grad_func> > element_gradient_;
 
+  /// @brief signature of integral evaluation kernel that differentiates w.r.t. a linear combination of two arguments
+  using combined_eval_func = std::function<void(double, const std::vector<const double*>&, double*, bool, double)>;
+
+  /**
+   * @brief kernels for integral evaluation + derivative w.r.t. a linear combination of the specified argument
+   * and the one before it, d/d(arg i) + scale * d/d(arg i-1), over each type of element. These are only
+   * generated when arguments i and i-1 are of the same type (e.g. a state and its time derivative).
+   */
+  std::vector<std::map<mfem::Geometry::Type, combined_eval_func> > combined_evaluation_;
+
+  /// @brief kernels for jacobian-vector products with derivatives computed by combined_evaluation_
+  std::vector<std::map<mfem::Geometry::Type, jacobian_vector_product_func> > combined_jvp_;
+
+  /// @brief kernels for calculation of element jacobians with derivatives computed by combined_evaluation_
+  std::vector<std::map<mfem::Geometry::Type, grad_func> > combined_element_gradient_;
+
+  /// @brief a description of which kernels hold the derivative w.r.t. a given trial space
+  struct DerivativeSource {
+    uint32_t index;     ///< the (Integral) index of the trial space whose kernels hold the derivatives
+    bool     combined;  ///< whether the derivatives are held by the combined kernels
+    double   scale;     ///< a factor to apply to the outputs of those kernels
+  };
+
+  /**
+   * @brief derivatives w.r.t. a (Functional) trial space that were most recently computed as part of a linear
+   * combination. Trial spaces not listed here use the usual derivative kernels.
+   */
+  mutable std::map<uint32_t, DerivativeSource> derivative_sources_;
+
+  /**
+   * @brief the time spent evaluating each element of each geometry (empty unless enabled with
+   * `enableElementCosts`), shared with the evaluation kernels
+   */
+  std::map<mfem::Geometry::Type, std::shared_ptr<std::vector<double> > > element_costs_;
+
+  /// @brief the number of quadrature points per element, for each element geometry
+  std::map<mfem::Geometry::Type, uint32_t> qpts_per_element_;
+
+  /**
+   * @brief the size (in bytes) of the q-function derivatives stored w.r.t. each trial space, for each element
+   * geometry. These are written by the evaluation kernels that differentiate w.r.t. that trial space, and read
+   * by the jacobian-vector product and element gradient kernels.
+   *
+   * @note the derivatives w.r.t. a linear combination of two trial spaces (see `combined_evaluation_`) have
+   * the same size as the derivatives w.r.t. the first of them
+   */
+  std::vector<std::map<mfem::Geometry::Type, std::size_t> > derivative_bytes_;
+
+  /**
+   * @brief records the size of the stored q-function derivatives for `serac::memoryReport()`. Like the
+   * derivatives themselves, these are shared between copies of an Integral.
+   */
+  std::vector<std::shared_ptr<TrackedAllocation> > derivative_memory_;
+
   /// @brief a list of the trial spaces that take part in this integrand
   std::vector<uint32_t> active_trial_spaces_;
 
@@ -164,7 +334,76 @@ struct Integral {
   std::map<uint32_t, uint32_t> functional_to_integral_index_;
 
   /// @brief the spatial positions and jacobians (dx_dxi) for each element type and quadrature point
-  std::map<mfem::Geometry::Type, GeometricFactors> geometric_factors_;
+  ///
+  /// @note these are obtained from `sharedGeometricFactors()`, so Integrals over the same elements share them
+  std::map<mfem::Geometry::Type, std::shared_ptr<const GeometricFactors> > geometric_factors_;
+
+private:
+  /// @brief find the kernels holding the derivative w.r.t. the specified (Functional) trial space, if any
+  std::optional<DerivativeSource> derivative_source(uint32_t differentiation_index) const
+  {
+    if (auto it = derivative_sources_.find(differentiation_index); it != derivative_sources_.end()) {
+      return it->second;
+    }
+    if (functional_to_integral_index_.count(differentiation_index) > 0) {
+      return DerivativeSource{functional_to_integral_index_.at(differentiation_index), false, 1.0};
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @brief the name of the profiling region of one stage of the kernels for a given geometry,
+   * e.g. "serac::domain::Square::action" or "serac::boundary::Segment::evaluation"
+   */
+  std::string region_name(mfem::Geometry::Type geometry, const char* stage) const
+  {
+    const char* integral_type = (domain_.type_ == Domain::Type::BoundaryElements) ? "boundary" : "domain";
+    return profiling::concat("serac::", integral_type, "::", mfem::Geometry::Name[geometry], "::", stage);
+  }
+
+  /// @brief the number of elements of a given geometry in the domain of integration
+  double num_elements(mfem::Geometry::Type geometry) const
+  {
+    return double(geometric_factors_.at(geometry)->num_elements);
+  }
+
+  /// @brief the number of quadrature points on the elements of a given geometry in the domain of integration
+  double num_qpts(mfem::Geometry::Type geometry) const
+  {
+    return num_elements(geometry) * qpts_per_element_.at(geometry);
+  }
+
+  /**
+   * @brief call an evaluation kernel for each element geometry
+   *
+   * @param derivative_bytes the size of the q-function derivatives written by the kernels, for each element
+   * geometry, or nullptr if the kernels don't compute derivatives
+   */
+  template <typename kernel_map, typename... extra_args>
+  void call_kernels(const kernel_map& kernels, const std::map<mfem::Geometry::Type, std::size_t>* derivative_bytes,
+                    double t, const std::vector<mfem::BlockVector>& input_E, mfem::BlockVector& output_E,
+                    bool update_state, extra_args... args) const
+  {
+    for (auto& [geometry, func] : kernels) {
+      std::vector<const double*> inputs(active_trial_spaces_.size());
+
+      // reads the inputs and geometric factors, updates the output, and (optionally) writes the derivatives
+      const GeometricFactors& gf = *geometric_factors_.at(geometry);
+      double bytes = sizeof(double) * (gf.X.Size() + gf.J.Size() + 2.0 * output_E.GetBlock(geometry).Size());
+      for (std::size_t i = 0; i < active_trial_spaces_.size(); i++) {
+        const mfem::Vector& input = input_E[uint32_t(active_trial_spaces_[i])].GetBlock(geometry);
+        inputs[i]                 = input.Read();
+        bytes += sizeof(double) * input.Size();
+      }
+      if (derivative_bytes) {
+        bytes += double(derivative_bytes->at(geometry));
+      }
+
+      const char*             stage = derivative_bytes ? "evaluation_with_derivatives" : "evaluation";
+      profiling::KernelRegion region(region_name(geometry, stage), bytes, num_elements(geometry), num_qpts(geometry));
+      func(t, inputs, output_E.GetBlock(geometry).ReadWrite(), update_state, args...);
+    }
+  }
 };
 
 /**
@@ -186,8 +425,8 @@ template <mfem::Geometry::Type geom, int Q, typename test, typename... trials, t
 void generate_kernels(FunctionSignature<test(trials...)> s, Integral& integral, const lambda_type& qf,
                       std::shared_ptr<QuadratureData<qpt_data_type> > qdata)
 {
-  integral.geometric_factors_[geom] = GeometricFactors(integral.domain_, Q, geom);
-  GeometricFactors& gf              = integral.geometric_factors_[geom];
+  integral.geometric_factors_[geom] = sharedGeometricFactors(integral.domain_, Q, geom);
+  const GeometricFactors& gf        = *integral.geometric_factors_[geom];
   if (gf.num_elements == 0) return;
 
   const double*  positions        = gf.X.Read();
@@ -196,9 +435,14 @@ void generate_kernels(FunctionSignature<test(trials...)> s, Integral& integral,
   const uint32_t num_elements     = uint32_t(gf.num_elements);
   const uint32_t qpts_per_element = num_quadrature_points(geom, Q);
 
+  auto element_costs            = std::make_shared<std::vector<double> >();
+  integral.element_costs_[geom] = element_costs;
+
+  integral.qpts_per_element_[geom] = qpts_per_element;
+
   std::shared_ptr<zero> dummy_derivatives;
   integral.evaluation_[geom] = domain_integral::evaluation_kernel<NO_DIFFERENTIATION, Q, geom>(
-      s, qf, positions, jacobians, qdata, dummy_derivatives, elements, num_elements);
+      s, qf, positions, jacobians, qdata, dummy_derivatives, elements, num_elements, element_costs);
 
   constexpr std::size_t                 num_args = s.num_args;
   [[maybe_unused]] static constexpr int dim      = dimension_of(geom);
@@ -210,14 +454,39 @@ void generate_kernels(FunctionSignature<test(trials...)> s, Integral& integral,
     // that of the DomainIntegral that allocated it.
     using derivative_type = decltype(domain_integral::get_derivative_type<index, dim, trials...>(qf, qpt_data_type{}));
     auto ptr = accelerator::make_shared_array<ExecutionSpace::CPU, derivative_type>(num_elements * qpts_per_element);
+    integral.derivative_bytes_[index][geom] = sizeof(derivative_type) * num_elements * qpts_per_element;
+    integral.derivative_memory_.push_back(std::make_shared<TrackedAllocation>(
+        MemoryCategory::QFunctionDerivatives, integral.derivative_bytes_[index][geom]));
 
     integral.evaluation_with_AD_[index][geom] = domain_integral::evaluation_kernel<index, Q, geom>(
-        s, qf, positions, jacobians, qdata, ptr, elements, num_elements);
+        s, qf, positions, jacobians, qdata, ptr, elements, num_elements, element_costs);
 
     integral.jvp_[index][geom] =
         domain_integral::jacobian_vector_product_kernel<index, Q, geom>(s, ptr, elements, num_elements);
     integral.element_gradient_[index][geom] =
         domain_integral::element_gradient_kernel<index, Q, geom>(s, ptr, elements, num_elements);
+
+    // consecutive arguments of the same type (e.g. a state and its time derivative) can also be differentiated
+    // w.r.t. a linear combination of the two, d/d(arg i) + c * d/d(arg i-1), in a single pass
+    if constexpr (index > 0) {
+      constexpr uint32_t secondary = index - 1;
+      if constexpr (std::is_same_v<std::tuple_element_t<index, std::tuple<trials...>>,
+                                   std::tuple_element_t<secondary, std::tuple<trials...>>>) {
+        using combined_derivative_type = decltype(domain_integral::get_combined_derivative_type<index, secondary, dim,
+                                                                                                 trials...>(
+            qf, qpt_data_type{}));
+        auto combined_ptr = std::make_shared<std::shared_ptr<combined_derivative_type[]>>();
+
+        integral.combined_evaluation_[index][geom] =
+            domain_integral::combined_evaluation_kernel<index, secondary, Q, geom>(
+                s, qf, positions, jacobians, qdata, combined_ptr, elements, num_elements, element_costs);
+        integral.combined_jvp_[index][geom] = domain_integral::combined_jacobian_vector_product_kernel<index, Q, geom>(
+            s, combined_ptr, elements, num_elements);
+        integral.combined_element_gradient_[index][geom] =
+            domain_integral::combined_element_gradient_kernel<index, Q, geom>(s, combined_ptr, elements,
+                                                                              num_elements);
+      }
+    }
   });
 }
 
@@ -275,8 +544,8 @@ Integral MakeDomainIntegral(const Domain& domain, const lambda_type& qf,
 template <mfem::Geometry::Type geom, int Q, typename test, typename... trials, typename lambda_type>
 void generate_bdr_kernels(FunctionSignature<test(trials...)> s, Integral& integral, const lambda_type& qf)
 {
-  integral.geometric_factors_[geom] = GeometricFactors(integral.domain_, Q, geom, FaceType::BOUNDARY);
-  GeometricFactors& gf              = integral.geometric_factors_[geom];
+  integral.geometric_factors_[geom] = sharedGeometricFactors(integral.domain_, Q, geom);
+  const GeometricFactors& gf        = *integral.geometric_factors_[geom];
   if (gf.num_elements == 0) return;
 
   const double*  positions        = gf.X.Read();
@@ -285,9 +554,14 @@ void generate_bdr_kernels(FunctionSignature<test(trials...)> s, Integral& integr
   const uint32_t qpts_per_element = num_quadrature_points(geom, Q);
   const int*     elements         = &gf.elements[0];
 
+  auto element_costs            = std::make_shared<std::vector<double> >();
+  integral.element_costs_[geom] = element_costs;
+
+  integral.qpts_per_element_[geom] = qpts_per_element;
+
   std::shared_ptr<zero> dummy_derivatives;
   integral.evaluation_[geom] = boundary_integral::evaluation_kernel<NO_DIFFERENTIATION, Q, geom>(
-      s, qf, positions, jacobians, dummy_derivatives, elements, num_elements);
+      s, qf, positions, jacobians, dummy_derivatives, elements, num_elements, element_costs);
 
   constexpr std::size_t                 num_args = s.num_args;
   [[maybe_unused]] static constexpr int dim      = dimension_of(geom);
@@ -299,14 +573,38 @@ void generate_bdr_kernels(FunctionSignature<test(trials...)> s, Integral& integr
     // that of the boundaryIntegral that allocated it.
     using derivative_type = decltype(boundary_integral::get_derivative_type<index, dim, trials...>(qf));
     auto ptr = accelerator::make_shared_array<ExecutionSpace::CPU, derivative_type>(num_elements * qpts_per_element);
+    integral.derivative_bytes_[index][geom] = sizeof(derivative_type) * num_elements * qpts_per_element;
+    integral.derivative_memory_.push_back(std::make_shared<TrackedAllocation>(
+        MemoryCategory::QFunctionDerivatives, integral.derivative_bytes_[index][geom]));
 
-    integral.evaluation_with_AD_[index][geom] =
-        boundary_integral::evaluation_kernel<index, Q, geom>(s, qf, positions, jacobians, ptr, elements, num_elements);
+    integral.evaluation_with_AD_[index][geom] = boundary_integral::evaluation_kernel<index, Q, geom>(
+        s, qf, positions, jacobians, ptr, elements, num_elements, element_costs);
 
     integral.jvp_[index][geom] =
         boundary_integral::jacobian_vector_product_kernel<index, Q, geom>(s, ptr, elements, num_elements);
     integral.element_gradient_[index][geom] =
         boundary_integral::element_gradient_kernel<index, Q, geom>(s, ptr, elements, num_elements);
+
+    // see generate_kernels()
+    if constexpr (index > 0) {
+      constexpr uint32_t secondary = index - 1;
+      if constexpr (std::is_same_v<std::tuple_element_t<index, std::tuple<trials...>>,
+                                   std::tuple_element_t<secondary, std::tuple<trials...>>>) {
+        using combined_derivative_type =
+            decltype(boundary_integral::get_combined_derivative_type<index, secondary, dim, trials...>(qf));
+        auto combined_ptr = std::make_shared<std::shared_ptr<combined_derivative_type[]>>();
+
+        integral.combined_evaluation_[index][geom] =
+            boundary_integral::combined_evaluation_kernel<index, secondary, Q, geom>(
+                s, qf, positions, jacobians, combined_ptr, elements, num_elements, element_costs);
+        integral.combined_jvp_[index][geom] =
+            boundary_integral::combined_jacobian_vector_product_kernel<index, Q, geom>(s, combined_ptr, elements,
+                                                                                       num_elements);
+        integral.combined_element_gradient_[index][geom] =
+            boundary_integral::combined_element_gradient_kernel<index, Q, geom>(s, combined_ptr, elements,
+                                                                                num_elements);
+      }
+    }
   });
 }
 
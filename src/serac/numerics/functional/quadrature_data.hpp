@@ -19,6 +19,7 @@
 #include "serac/serac_config.hpp"
 
 #include "serac/infrastructure/accelerator.hpp"
+#include "serac/infrastructure/memory.hpp"
 
 namespace serac {
 
@@ -131,6 +132,8 @@ struct QuadratureData {
         data[geom].fill(value);
       }
     }
+
+    updateMemoryRecord();
   }
 
   /**
@@ -139,8 +142,21 @@ struct QuadratureData {
    */
   axom::ArrayView<T, 2> operator[](mfem::Geometry::Type geom) { return axom::ArrayView<T, 2>(data.at(geom)); }
 
+  /// @brief record the current size of `data` for `serac::memoryReport()`, after it is resized
+  void updateMemoryRecord()
+  {
+    std::size_t bytes = 0;
+    for (auto& [geom, values] : data) {
+      bytes += sizeof(T) * static_cast<std::size_t>(values.size());
+    }
+    memory = TrackedAllocation(MemoryCategory::QuadratureData, bytes);
+  }
+
   /// @brief a 3D array indexed by (which geometry, which element, which quadrature point)
   std::map<mfem::Geometry::Type, axom::Array<T, 2> > data;
+
+  /// @brief records the size of `data` for `serac::memoryReport()`
+  TrackedAllocation memory;
 };
 
 /// @cond
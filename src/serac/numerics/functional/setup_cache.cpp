@@ -0,0 +1,108 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/functional/setup_cache.hpp"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace serac {
+
+namespace {
+
+/// (finite element space, its update sequence number, domain type)
+using RestrictionKey = std::tuple<const mfem::FiniteElementSpace*, long, Domain::Type>;
+
+/// (mesh, its update sequence number, mesh nodes, domain type, element geometry, q, element ids)
+using GeometricFactorsKey =
+    std::tuple<const mfem::Mesh*, long, const mfem::GridFunction*, Domain::Type, mfem::Geometry::Type, int,
+               std::vector<int> >;
+
+std::map<RestrictionKey, std::weak_ptr<const BlockElementRestriction> >& restriction_cache()
+{
+  static std::map<RestrictionKey, std::weak_ptr<const BlockElementRestriction> > cache;
+  return cache;
+}
+
+std::map<GeometricFactorsKey, std::weak_ptr<const GeometricFactors> >& geometric_factors_cache()
+{
+  static std::map<GeometricFactorsKey, std::weak_ptr<const GeometricFactors> > cache;
+  return cache;
+}
+
+/// @brief drop the entries whose data has already been released by all of its owners
+template <typename map_type>
+void remove_expired(map_type& cache)
+{
+  for (auto it = cache.begin(); it != cache.end();) {
+    if (it->second.expired()) {
+      it = cache.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<const BlockElementRestriction> sharedBlockElementRestriction(const mfem::FiniteElementSpace* fes,
+                                                                             Domain::Type                   type)
+{
+  auto& cache = restriction_cache();
+
+  RestrictionKey key{fes, fes->GetSequence(), type};
+  if (auto it = cache.find(key); it != cache.end()) {
+    if (auto existing = it->second.lock()) {
+      return existing;
+    }
+  }
+
+  remove_expired(cache);
+
+  std::shared_ptr<const BlockElementRestriction> restriction;
+  if (type == Domain::Type::Elements) {
+    restriction = std::make_shared<const BlockElementRestriction>(fes);
+  } else {
+    restriction = std::make_shared<const BlockElementRestriction>(fes, FaceType::BOUNDARY);
+  }
+
+  cache[key] = restriction;
+  return restriction;
+}
+
+std::shared_ptr<const GeometricFactors> sharedGeometricFactors(const Domain& domain, int q, mfem::Geometry::Type geom)
+{
+  auto& cache = geometric_factors_cache();
+
+  const mfem::Mesh&   mesh = domain.mesh_;
+  GeometricFactorsKey key{&mesh, mesh.GetSequence(), mesh.GetNodes(), domain.type_, geom, q, domain.get(geom)};
+  if (auto it = cache.find(key); it != cache.end()) {
+    if (auto existing = it->second.lock()) {
+      return existing;
+    }
+  }
+
+  remove_expired(cache);
+
+  std::shared_ptr<const GeometricFactors> gf;
+  if (domain.type_ == Domain::Type::Elements) {
+    gf = std::make_shared<const GeometricFactors>(domain, q, geom);
+  } else {
+    gf = std::make_shared<const GeometricFactors>(domain, q, geom, FaceType::BOUNDARY);
+  }
+
+  cache[key] = gf;
+  return gf;
+}
+
+void clearSetupCache()
+{
+  restriction_cache().clear();
+  geometric_factors_cache().clear();
+}
+
+}  // namespace serac
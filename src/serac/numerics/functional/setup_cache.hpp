@@ -0,0 +1,71 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file setup_cache.hpp
+ *
+ * @brief mesh-level caches for the setup data (element restrictions and geometric factors)
+ * that every `Functional` and `Integral` on a given mesh would otherwise compute independently
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/functional/domain.hpp"
+#include "serac/numerics/functional/element_restriction.hpp"
+#include "serac/numerics/functional/geometric_factors.hpp"
+
+namespace serac {
+
+/**
+ * @brief get the (possibly shared) BlockElementRestriction for a finite element space
+ *
+ * Functionals defined on the same finite element space (e.g. the residual, its QoIs, and any
+ * other Functional that takes the same field as an argument) receive the same object, rather
+ * than each building their own copy of the dof tables.
+ *
+ * @param fes the finite element space
+ * @param type whether the restriction is for the domain elements or the boundary elements
+ *
+ * @note The cache holds only weak references, so the restriction is released as soon as the last
+ * Functional using it is destroyed.
+ */
+std::shared_ptr<const BlockElementRestriction> sharedBlockElementRestriction(const mfem::FiniteElementSpace* fes,
+                                                                             Domain::Type                   type);
+
+/**
+ * @brief get the (possibly shared) positions and jacobians of the quadrature points of a domain
+ *
+ * Entries are keyed by the mesh, the element geometry, the number of quadrature points and the
+ * list of elements in the domain, so separately constructed `Domain`s that contain the same elements
+ * share their geometric factors.
+ *
+ * @param domain the domain of integration
+ * @param q a parameter controlling the number of quadrature points per element
+ * @param geom which kind of element geometry to select
+ *
+ * @note The cache holds only weak references, so the data is released as soon as the last
+ * Integral using it is destroyed.
+ *
+ * @note The geometric factors are evaluated from the mesh nodes when the entry is created. If the
+ * nodal coordinates are modified in place while Integrals built on the old coordinates are still alive,
+ * call `clearSetupCache()` before constructing new Functionals.
+ */
+std::shared_ptr<const GeometricFactors> sharedGeometricFactors(const Domain& domain, int q,
+                                                               mfem::Geometry::Type geom);
+
+/**
+ * @brief forget all cached setup data
+ *
+ * Objects already handed out remain valid (they are kept alive by their owners), but subsequent
+ * requests will compute new entries.
+ */
+void clearSetupCache();
+
+}  // namespace serac
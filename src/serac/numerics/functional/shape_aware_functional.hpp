@@ -46,6 +46,9 @@ public:
   {
   }
 
+  /// @brief Construct an uninitialized Shape Correction object (e.g. to be assigned later, in a batch)
+  ShapeCorrection() = default;
+
   /**
    * @brief Modify the trial argument using the correct physical to reference to shape-adjusted transformation for the
    * underlying trial function space
@@ -139,6 +142,37 @@ private:
   inv_JT_type inv_JT_;
 };
 
+/**
+ * @brief Shift a quadrature point's position (and its isoparametric derivatives) by a shape displacement
+ *
+ * @tparam position_type The position input argument type
+ * @tparam shape_type The shape displacement input argument type
+ *
+ * @param position The input position (value and isoparametric derivatives)
+ * @param shape The input shape displacement (value and gradient)
+ *
+ * @return The position of the quadrature point in the shape-displaced domain, and its isoparametric derivatives
+ */
+template <typename position_type, typename shape_type>
+SERAC_HOST_DEVICE auto shift_position(const position_type& position, const shape_type& shape)
+{
+  return serac::tuple{get<VALUE>(position) + get<VALUE>(shape),
+
+                      // x := X + u,
+                      // so, dx/dxi = dX/dxi + du/dxi
+                      //            = dX/dxi + du/dX * dX/dxi
+                      get<DERIVATIVE>(position) + get<DERIVATIVE>(shape) * get<DERIVATIVE>(position)};
+}
+
+/// @brief the type of a position shifted by a shape displacement
+template <typename position_type, typename shape_type>
+using shifted_position_t = decltype(shift_position(std::declval<position_type>(), std::declval<shape_type>()));
+
+/// @brief the type of a trial argument from @a space_type after the shape correction
+template <int dim, typename shape_type, typename space_type, typename trial_type>
+using shape_corrected_t = decltype(std::declval<const ShapeCorrection<dim, shape_type>&>().modify_trial_argument(
+    space_type{}, std::declval<const trial_type&>()));
+
 /**
  * @brief Compute the boundary area correction term for boundary integrals with a shape displacement field
  *
@@ -206,12 +240,7 @@ SERAC_HOST_DEVICE auto apply_shape_aware_qf_helper(const lambda& qf, double t, c
   static_assert(tuple_size<trial_types>::value == tuple_size<space_types>::value,
                 "Argument and finite element space tuples are not the same size.");
 
-  auto x = serac::tuple{get<VALUE>(position) + get<VALUE>(shape),
-
-                        // x := X + u,
-                        // so, dx/dxi = dX/dxi + du/dxi
-                        //            = dX/dxi + du/dX * dX/dxi
-                        get<DERIVATIVE>(position) + get<DERIVATIVE>(shape) * get<DERIVATIVE>(position)};
+  auto x = shift_position(position, shape);
 
   return qf(t, x, correction.modify_trial_argument(serac::get<i>(space_tuple), serac::get<i>(arg_tuple))...);
 }
@@ -254,16 +283,144 @@ SERAC_HOST_DEVICE auto apply_shape_aware_qf_helper_with_state(const lambda& qf,
   static_assert(tuple_size<trial_types>::value == tuple_size<space_types>::value,
                 "Argument and finite element space tuples are not the same size.");
 
-  auto x = serac::tuple{get<VALUE>(position) + get<VALUE>(shape),
-
-                        // x := X + u,
-                        // so, dx/dxi = dX/dxi + du/dxi
-                        //            = dX/dxi + du/dX * dX/dxi
-                        get<DERIVATIVE>(position) + get<DERIVATIVE>(shape) * get<DERIVATIVE>(position)};
+  auto x = shift_position(position, shape);
 
   return qf(t, x, state, correction.modify_trial_argument(serac::get<i>(space_tuple), serac::get<i>(arg_tuple))...);
 }
 
+/**
+ * @brief Apply the shape correction to a trial argument at each quadrature point of an element
+ *
+ * @param corrections The shape correction at each quadrature point
+ * @param space The finite element space of the trial argument
+ * @param arg The trial argument (value and gradient) at each quadrature point
+ */
+template <int dim, typename shape_type, typename space_type, typename trial_type, int n>
+SERAC_HOST_DEVICE auto batch_modify_trial_argument(const tensor<ShapeCorrection<dim, shape_type>, n>& corrections,
+                                                   space_type space, const tensor<trial_type, n>& arg)
+{
+  tensor<shape_corrected_t<dim, shape_type, space_type, trial_type>, n> modified{};
+  for (int q = 0; q < n; q++) {
+    modified[q] = corrections[q].modify_trial_argument(space, arg[q]);
+  }
+  return modified;
+}
+
+/**
+ * @brief The q-function of a ShapeAwareFunctional domain integral without state variables, which evaluates the
+ * user's integrand on the shape-displaced domain
+ *
+ * If the integrand provides a batched evaluation (see domain_integral::has_batch_evaluation_v), so does this.
+ *
+ * @tparam dim The dimension of the element
+ * @tparam lambda The type of the user's integrand
+ * @tparam test_space The test function finite element space
+ * @tparam space_types The finite element spaces of the integrand's trial arguments
+ */
+template <int dim, typename lambda, typename test_space, typename... space_types>
+struct ShapeAwareIntegrand {
+  /// @brief the user's integrand, written in terms of the shape-displaced domain
+  lambda integrand;
+
+  /// @brief evaluate the integrand at a single quadrature point
+  template <typename position_type, typename shape_type, typename... T>
+  SERAC_HOST_DEVICE auto operator()(double time, position_type x, shape_type shape_val, T... qfunc_args) const
+  {
+    auto qfunc_tuple = make_tuple(qfunc_args...);
+
+    ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
+
+    auto unmodified_qf_return =
+        apply_shape_aware_qf_helper(integrand, time, x, shape_val, tuple<space_types...>{}, qfunc_tuple,
+                                    shape_correction, std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
+    return shape_correction.modify_shape_aware_qf_return(test_space{}, unmodified_qf_return);
+  }
+
+  /// @brief evaluate the integrand at all of the quadrature points of an element, through its batched evaluation
+  template <typename position_type, typename shape_type, int n, typename... T,
+            typename = std::enable_if_t<domain_integral::has_batch_evaluation_v<
+                lambda, double, const tensor<shifted_position_t<position_type, shape_type>, n>&,
+                const tensor<shape_corrected_t<dim, shape_type, space_types, T>, n>&...>>>
+  SERAC_HOST_DEVICE auto batch(double time, const tensor<position_type, n>& x, const tensor<shape_type, n>& shape_val,
+                               const tensor<T, n>&... qfunc_args) const
+  {
+    tensor<ShapeCorrection<dim, shape_type>, n>              corrections{};
+    tensor<shifted_position_t<position_type, shape_type>, n> shifted_x{};
+    for (int q = 0; q < n; q++) {
+      corrections[q] = ShapeCorrection<dim, shape_type>(Dimension<dim>{}, shape_val[q]);
+      shifted_x[q]   = shift_position(x[q], shape_val[q]);
+    }
+
+    auto unmodified_qf_returns =
+        integrand.batch(time, shifted_x, batch_modify_trial_argument(corrections, space_types{}, qfunc_args)...);
+
+    using return_type = decltype(corrections[0].modify_shape_aware_qf_return(test_space{}, unmodified_qf_returns[0]));
+    tensor<return_type, n> outputs{};
+    for (int q = 0; q < n; q++) {
+      outputs[q] = corrections[q].modify_shape_aware_qf_return(test_space{}, unmodified_qf_returns[q]);
+    }
+    return outputs;
+  }
+};
+
+/**
+ * @brief The q-function of a ShapeAwareFunctional domain integral with state variables, which evaluates the
+ * user's integrand on the shape-displaced domain
+ *
+ * If the integrand provides a batched evaluation (see domain_integral::has_batch_evaluation_v), so does this.
+ *
+ * @tparam dim The dimension of the element
+ * @tparam lambda The type of the user's integrand
+ * @tparam test_space The test function finite element space
+ * @tparam space_types The finite element spaces of the integrand's trial arguments
+ */
+template <int dim, typename lambda, typename test_space, typename... space_types>
+struct ShapeAwareIntegrandWithState {
+  /// @brief the user's integrand, written in terms of the shape-displaced domain
+  lambda integrand;
+
+  /// @brief evaluate the integrand at a single quadrature point
+  template <typename position_type, typename state_type, typename shape_type, typename... T>
+  SERAC_HOST_DEVICE auto operator()(double time, position_type x, state_type& state, shape_type shape_val,
+                                    T... qfunc_args) const
+  {
+    auto qfunc_tuple = make_tuple(qfunc_args...);
+
+    ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
+
+    auto unmodified_qf_return = apply_shape_aware_qf_helper_with_state(
+        integrand, time, x, state, shape_val, tuple<space_types...>{}, qfunc_tuple, shape_correction,
+        std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
+    return shape_correction.modify_shape_aware_qf_return(test_space{}, unmodified_qf_return);
+  }
+
+  /// @brief evaluate the integrand at all of the quadrature points of an element, through its batched evaluation
+  template <typename position_type, typename state_type, typename shape_type, int n, typename... T,
+            typename = std::enable_if_t<domain_integral::has_batch_evaluation_v<
+                lambda, double, const tensor<shifted_position_t<position_type, shape_type>, n>&,
+                tensor<state_type, n>&, const tensor<shape_corrected_t<dim, shape_type, space_types, T>, n>&...>>>
+  SERAC_HOST_DEVICE auto batch(double time, const tensor<position_type, n>& x, tensor<state_type, n>& states,
+                               const tensor<shape_type, n>& shape_val, const tensor<T, n>&... qfunc_args) const
+  {
+    tensor<ShapeCorrection<dim, shape_type>, n>              corrections{};
+    tensor<shifted_position_t<position_type, shape_type>, n> shifted_x{};
+    for (int q = 0; q < n; q++) {
+      corrections[q] = ShapeCorrection<dim, shape_type>(Dimension<dim>{}, shape_val[q]);
+      shifted_x[q]   = shift_position(x[q], shape_val[q]);
+    }
+
+    auto unmodified_qf_returns = integrand.batch(
+        time, shifted_x, states, batch_modify_trial_argument(corrections, space_types{}, qfunc_args)...);
+
+    using return_type = decltype(corrections[0].modify_shape_aware_qf_return(test_space{}, unmodified_qf_returns[0]));
+    tensor<return_type, n> outputs{};
+    for (int q = 0; q < n; q++) {
+      outputs[q] = corrections[q].modify_shape_aware_qf_return(test_space{}, unmodified_qf_returns[q]);
+    }
+    return outputs;
+  }
+};
+
 }  // namespace detail
 
 /// @cond
@@ -379,32 +536,14 @@ public:
     if constexpr (std::is_same_v<qpt_data_type, Nothing>) {
       functional_->AddDomainIntegral(
           Dimension<dim>{}, DependsOn<0, (args + 1)...>{},
-          [integrand](double time, auto x, auto shape_val, auto... qfunc_args) {
-            auto qfunc_tuple               = make_tuple(qfunc_args...);
-            auto reduced_trial_space_tuple = make_tuple(get<args>(trial_spaces)...);
-
-            detail::ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
-
-            auto unmodified_qf_return = detail::apply_shape_aware_qf_helper(
-                integrand, time, x, shape_val, reduced_trial_space_tuple, qfunc_tuple, shape_correction,
-                std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
-            return shape_correction.modify_shape_aware_qf_return(test_space, unmodified_qf_return);
-          },
+          detail::ShapeAwareIntegrand<dim, lambda, test, std::decay_t<decltype(get<args>(trial_spaces))>...>{
+              integrand},
           domain, qdata);
     } else {
       functional_->AddDomainIntegral(
           Dimension<dim>{}, DependsOn<0, (args + 1)...>{},
-          [integrand](double time, auto x, auto& state, auto shape_val, auto... qfunc_args) {
-            auto qfunc_tuple               = make_tuple(qfunc_args...);
-            auto reduced_trial_space_tuple = make_tuple(get<args>(trial_spaces)...);
-
-            detail::ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
-
-            auto unmodified_qf_return = detail::apply_shape_aware_qf_helper_with_state(
-                integrand, time, x, state, shape_val, reduced_trial_space_tuple, qfunc_tuple, shape_correction,
-                std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
-            return shape_correction.modify_shape_aware_qf_return(test_space, unmodified_qf_return);
-          },
+          detail::ShapeAwareIntegrandWithState<dim, lambda, test,
+                                               std::decay_t<decltype(get<args>(trial_spaces))>...>{integrand},
           domain, qdata);
     }
   }
@@ -486,6 +625,16 @@ public:
    */
   void updateQdata(bool update_flag) { functional_->updateQdata(update_flag); }
 
+  /**
+   * @brief start (or stop) measuring the time spent evaluating each element
+   *
+   * @param enable whether or not to measure the per-element costs
+   */
+  void enableElementCosts(bool enable = true) { functional_->enableElementCosts(enable); }
+
+  /// @brief the time (in seconds) spent evaluating each (local) element since the measurement was enabled
+  mfem::Vector elementCosts() const { return functional_->elementCosts(); }
+
 private:
   /// @brief The underlying pure Functional object
   std::unique_ptr<Functional<test(shape, trials...), exec>> functional_;
@@ -0,0 +1,131 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <fstream>
+#include <iostream>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils_base.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/numerics/functional/tensor.hpp"
+#include <gtest/gtest.h>
+
+using namespace serac;
+
+int num_procs, myid;
+
+std::unique_ptr<mfem::ParMesh> mesh2D;
+std::unique_ptr<mfem::ParMesh> mesh3D;
+
+static constexpr double a = 1.7;
+static constexpr double b = 2.1;
+
+// a toy nonlinear "thermal" q-function, evaluated one quadrature point at a time
+struct pointwise_qfunction {
+  template <typename X, typename T>
+  SERAC_HOST_DEVICE auto operator()(double /*t*/, X position, T temperature) const
+  {
+    auto [x, dx_dxi] = position;
+    auto [u, du_dx]  = temperature;
+    auto source      = a * u * u - (100 * x[0] * x[1]);
+    auto flux        = b * (1.0 + u * u) * du_dx;
+    return serac::tuple{source, flux};
+  }
+};
+
+// the same q-function, but with an additional batched implementation
+// that evaluates all of an element's quadrature points in a single call
+struct batched_qfunction : public pointwise_qfunction {
+  template <typename X, typename T, int n>
+  SERAC_HOST_DEVICE auto batch(double t, const tensor<X, n>& positions, const tensor<T, n>& temperatures) const
+  {
+    using output_type = decltype(pointwise_qfunction::operator()(t, X{}, T{}));
+
+    // deliberately split the calculation up into separate passes over the
+    // quadrature points, to emulate how a vectorized material model is written
+    tensor<decltype(get<0>(T{}) * get<0>(T{})), n> u_squared{};
+    for (int q = 0; q < n; q++) {
+      auto u       = get<0>(temperatures[q]);
+      u_squared[q] = u * u;
+    }
+
+    tensor<output_type, n> outputs{};
+    for (int q = 0; q < n; q++) {
+      auto x             = get<0>(positions[q]);
+      get<0>(outputs[q]) = a * u_squared[q] - (100 * x[0] * x[1]);
+      get<1>(outputs[q]) = b * (1.0 + u_squared[q]) * get<1>(temperatures[q]);
+    }
+    return outputs;
+  }
+};
+
+template <int p, int dim>
+void batched_qfunction_test(mfem::ParMesh& mesh)
+{
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fespace(&mesh, &fec);
+
+  mfem::Vector U(fespace.TrueVSize());
+  U.Randomize();
+
+  using space = H1<p>;
+
+  Functional<space(space)> pointwise(&fespace, {&fespace});
+  pointwise.AddDomainIntegral(Dimension<dim>{}, DependsOn<0>{}, pointwise_qfunction{}, mesh);
+
+  Functional<space(space)> batched(&fespace, {&fespace});
+  batched.AddDomainIntegral(Dimension<dim>{}, DependsOn<0>{}, batched_qfunction{}, mesh);
+
+  double t = 0.0;
+
+  mfem::Vector r1 = pointwise(t, U);
+  mfem::Vector r2 = batched(t, U);
+
+  mfem::Vector diff(r1.Size());
+  subtract(r1, r2, diff);
+  EXPECT_NEAR(0.0, diff.Norml2() / r1.Norml2(), 1.e-14);
+
+  auto [r3, drdU1] = pointwise(t, differentiate_wrt(U));
+  auto [r4, drdU2] = batched(t, differentiate_wrt(U));
+
+  mfem::Vector g1 = drdU1(U);
+  mfem::Vector g2 = drdU2(U);
+
+  subtract(g1, g2, diff);
+  EXPECT_NEAR(0.0, diff.Norml2() / g1.Norml2(), 1.e-14);
+}
+
+TEST(BatchedQFunction, 2DLinear) { batched_qfunction_test<1, 2>(*mesh2D); }
+TEST(BatchedQFunction, 2DQuadratic) { batched_qfunction_test<2, 2>(*mesh2D); }
+TEST(BatchedQFunction, 3DLinear) { batched_qfunction_test<1, 3>(*mesh3D); }
+TEST(BatchedQFunction, 3DQuadratic) { batched_qfunction_test<2, 3>(*mesh3D); }
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_procs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+
+  axom::slic::SimpleLogger logger;
+
+  int serial_refinement   = 1;
+  int parallel_refinement = 0;
+
+  std::string meshfile2D = SERAC_REPO_DIR "/data/meshes/patch2D_quads.mesh";
+  mesh2D = mesh::refineAndDistribute(buildMeshFromFile(meshfile2D), serial_refinement, parallel_refinement);
+
+  std::string meshfile3D = SERAC_REPO_DIR "/data/meshes/patch3D_hexes.mesh";
+  mesh3D = mesh::refineAndDistribute(buildMeshFromFile(meshfile3D), serial_refinement, parallel_refinement);
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
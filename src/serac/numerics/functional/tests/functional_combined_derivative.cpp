@@ -0,0 +1,157 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <fstream>
+#include <iostream>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils_base.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/numerics/functional/tensor.hpp"
+#include <gtest/gtest.h>
+
+using namespace serac;
+
+int num_procs, myid;
+
+std::unique_ptr<mfem::ParMesh> mesh2D;
+std::unique_ptr<mfem::ParMesh> mesh3D;
+
+// a toy nonlinear "transient thermal" q-function, that depends on a temperature and its rate of change
+struct transient_qfunction {
+  template <typename X, typename T, typename R>
+  SERAC_HOST_DEVICE auto operator()(double /*t*/, X /*position*/, T temperature, R temperature_rate) const
+  {
+    auto [u, du_dx]         = temperature;
+    auto [u_dot, du_dot_dx] = temperature_rate;
+    auto source             = (1.0 + u * u) * u_dot + 0.5 * u * u;
+    auto flux               = (2.0 + u) * du_dx + 0.1 * du_dot_dx;
+    return serac::tuple{source, flux};
+  }
+};
+
+// a boundary term that only depends on the temperature
+struct convection_qfunction {
+  template <typename X, typename T>
+  SERAC_HOST_DEVICE auto operator()(double /*t*/, X /*position*/, T temperature) const
+  {
+    return 0.3 * temperature * temperature;
+  }
+};
+
+template <int p, int dim>
+void combined_derivative_test(mfem::ParMesh& mesh)
+{
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fespace(&mesh, &fec);
+
+  mfem::Vector U(fespace.TrueVSize());
+  mfem::Vector U_dot(fespace.TrueVSize());
+  mfem::Vector dU(fespace.TrueVSize());
+  U.Randomize(1);
+  U_dot.Randomize(2);
+  dU.Randomize(3);
+
+  using space = H1<p>;
+
+  Functional<space(space, space)> residual(&fespace, {&fespace, &fespace});
+  residual.AddDomainIntegral(Dimension<dim>{}, DependsOn<0, 1>{}, transient_qfunction{}, mesh);
+  residual.AddBoundaryIntegral(Dimension<dim - 1>{}, DependsOn<0>{}, convection_qfunction{}, mesh);
+
+  double t  = 0.0;
+  double dt = 0.37;
+
+  // J := dR/du_dot + dt * dR/du, in a single pass
+  auto [r_combined, J] = residual(t, differentiate_wrt(U, dt), differentiate_wrt(U_dot));
+
+  mfem::Vector r_copy   = r_combined;
+  mfem::Vector J_dU     = J(dU);
+  auto         J_matrix = assemble(J);
+  mfem::Vector J_dU_mat(dU.Size());
+  J_matrix->Mult(dU, J_dU_mat);
+
+  // the unassembled element matrices (of both the elements and the boundary elements) sum to the same operator
+  mfem::SparseMatrix J_local(fespace.GetVSize());
+  J.forEachElementMatrix(
+      [&J_local](const mfem::Array<int>& rows, const mfem::Array<int>& columns, const mfem::DenseMatrix& matrix) {
+        J_local.AddSubMatrix(rows, columns, matrix);
+      });
+  J_local.Finalize();
+
+  mfem::Vector dU_local(fespace.GetVSize());
+  mfem::Vector J_dU_local(fespace.GetVSize());
+  mfem::Vector J_dU_elem(dU.Size());
+  fespace.GetProlongationMatrix()->Mult(dU, dU_local);
+  J_local.Mult(dU_local, J_dU_local);
+  fespace.GetProlongationMatrix()->MultTranspose(J_dU_local, J_dU_elem);
+
+  // the same quantities, computed from separate derivatives
+  auto [r_K, K] = residual(t, differentiate_wrt(U), U_dot);
+
+  mfem::Vector K_dU     = K(dU);
+  auto         K_matrix = assemble(K);
+
+  auto [r_M, M] = residual(t, U, differentiate_wrt(U_dot));
+
+  mfem::Vector M_dU     = M(dU);
+  auto         M_matrix = assemble(M);
+
+  mfem::Vector expected(dU.Size());
+  add(M_dU, dt, K_dU, expected);
+
+  std::unique_ptr<mfem::HypreParMatrix> expected_matrix(mfem::Add(1.0, *M_matrix, dt, *K_matrix));
+  mfem::Vector                          expected_mat(dU.Size());
+  expected_matrix->Mult(dU, expected_mat);
+
+  mfem::Vector diff(dU.Size());
+
+  // the value of the residual should be unaffected
+  subtract(r_copy, r_M, diff);
+  EXPECT_NEAR(0.0, mfem::ParNormlp(diff, 2, MPI_COMM_WORLD) / mfem::ParNormlp(r_M, 2, MPI_COMM_WORLD), 1.e-14);
+
+  subtract(J_dU, expected, diff);
+  EXPECT_NEAR(0.0, mfem::ParNormlp(diff, 2, MPI_COMM_WORLD) / mfem::ParNormlp(expected, 2, MPI_COMM_WORLD), 1.e-13);
+
+  subtract(J_dU_mat, expected_mat, diff);
+  EXPECT_NEAR(0.0, mfem::ParNormlp(diff, 2, MPI_COMM_WORLD) / mfem::ParNormlp(expected_mat, 2, MPI_COMM_WORLD),
+              1.e-13);
+
+  subtract(J_dU_elem, expected_mat, diff);
+  EXPECT_NEAR(0.0, mfem::ParNormlp(diff, 2, MPI_COMM_WORLD) / mfem::ParNormlp(expected_mat, 2, MPI_COMM_WORLD),
+              1.e-13);
+}
+
+TEST(CombinedDerivative, 2DLinear) { combined_derivative_test<1, 2>(*mesh2D); }
+TEST(CombinedDerivative, 2DQuadratic) { combined_derivative_test<2, 2>(*mesh2D); }
+TEST(CombinedDerivative, 3DLinear) { combined_derivative_test<1, 3>(*mesh3D); }
+TEST(CombinedDerivative, 3DQuadratic) { combined_derivative_test<2, 3>(*mesh3D); }
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_procs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+
+  axom::slic::SimpleLogger logger;
+
+  int serial_refinement   = 1;
+  int parallel_refinement = 0;
+
+  std::string meshfile2D = SERAC_REPO_DIR "/data/meshes/patch2D_quads.mesh";
+  mesh2D = mesh::refineAndDistribute(buildMeshFromFile(meshfile2D), serial_refinement, parallel_refinement);
+
+  std::string meshfile3D = SERAC_REPO_DIR "/data/meshes/patch3D_hexes.mesh";
+  mesh3D = mesh::refineAndDistribute(buildMeshFromFile(meshfile3D), serial_refinement, parallel_refinement);
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "serac/numerics/functional/geometric_factors.hpp"
+#include "serac/numerics/functional/setup_cache.hpp"
 
 using namespace serac;
 
@@ -88,6 +89,61 @@ TEST(geometric_factors, with_3D_domains)
   }
 }
 
+TEST(geometric_factors, shared_between_identical_domains)
+{
+  auto mesh = import_mesh("patch2D_tris_and_quads.mesh");
+
+  auto predicate =
+      std::function([](std::vector<vec2> vertices, int /* attr */) { return average(vertices)[0] < 0.45; });
+
+  // separately constructed domains with the same elements should share their geometric factors
+  Domain d1 = Domain::ofElements(mesh, predicate);
+  Domain d2 = Domain::ofElements(mesh, predicate);
+  Domain d3 = EntireDomain(mesh);
+
+  int q = 2;
+
+  auto gf1 = sharedGeometricFactors(d1, q, mfem::Geometry::SQUARE);
+  auto gf2 = sharedGeometricFactors(d2, q, mfem::Geometry::SQUARE);
+  EXPECT_EQ(gf1.get(), gf2.get());
+
+  // ... but not with a different quadrature rule, or a different set of elements
+  EXPECT_NE(gf1.get(), sharedGeometricFactors(d1, q + 1, mfem::Geometry::SQUARE).get());
+  EXPECT_NE(gf1.get(), sharedGeometricFactors(d3, q, mfem::Geometry::SQUARE).get());
+
+  // the cached values agree with a freshly computed set of geometric factors
+  GeometricFactors gf(d1, q, mfem::Geometry::SQUARE);
+  mfem::Vector     diff(gf.J.Size());
+  subtract(gf.J, gf2->J, diff);
+  EXPECT_EQ(diff.Normlinf(), 0.0);
+
+  // the cache doesn't keep them alive once all of their owners are gone
+  std::weak_ptr<const GeometricFactors> observer = gf1;
+  gf1.reset();
+  gf2.reset();
+  EXPECT_TRUE(observer.expired());
+}
+
+TEST(geometric_factors, shared_element_restrictions)
+{
+  auto mesh = import_mesh("patch2D_tris_and_quads.mesh");
+
+  mfem::H1_FECollection    fec(2, mesh.Dimension());
+  mfem::FiniteElementSpace fes1(&mesh, &fec);
+  mfem::FiniteElementSpace fes2(&mesh, &fec);
+
+  auto G1 = sharedBlockElementRestriction(&fes1, Domain::Type::Elements);
+  auto G2 = sharedBlockElementRestriction(&fes1, Domain::Type::Elements);
+  EXPECT_EQ(G1.get(), G2.get());
+
+  EXPECT_NE(G1.get(), sharedBlockElementRestriction(&fes1, Domain::Type::BoundaryElements).get());
+  EXPECT_NE(G1.get(), sharedBlockElementRestriction(&fes2, Domain::Type::Elements).get());
+  EXPECT_EQ(G1->ESize(), BlockElementRestriction(&fes1).ESize());
+
+  clearSetupCache();
+  EXPECT_NE(G1.get(), sharedBlockElementRestriction(&fes1, Domain::Type::Elements).get());
+}
+
 int main(int argc, char* argv[])
 {
   int num_procs, myid;
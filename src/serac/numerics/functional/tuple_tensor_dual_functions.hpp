@@ -271,6 +271,60 @@ constexpr auto make_dual_wrt(const serac::tuple<T...>& args)
   return make_dual_helper<n>(args, std::make_integer_sequence<int, static_cast<int>(sizeof...(T))>{});
 }
 
+/// @brief layer of indirection required to implement `make_dual_wrt_both`
+template <int n, int m, typename... T, int... i>
+SERAC_HOST_DEVICE constexpr auto make_dual_both_helper(const serac::tuple<T...>& args,
+                                                       std::integer_sequence<int, i...>)
+{
+  // see make_dual_helper for why serac::make_tuple is used here
+  return serac::make_tuple(promote_to_dual_when<i == n || i == m>(serac::get<i>(args))...);
+}
+
+/**
+ * @tparam n the index of the first tuple argument to be made into a dual number
+ * @tparam m the index of the second tuple argument to be made into a dual number
+ * @tparam T the types of the values in the tuple
+ *
+ * @brief take a tuple of values, and promote the `n`th and `m`th ones to one-hot dual numbers. The two
+ * arguments must have the same type, so that their derivatives can be accumulated together.
+ * @param args the values to be promoted
+ */
+template <int n, int m, typename... T>
+constexpr auto make_dual_wrt_both(const serac::tuple<T...>& args)
+{
+  return make_dual_both_helper<n, m>(args, std::make_integer_sequence<int, static_cast<int>(sizeof...(T))>{});
+}
+
+/// @overload
+SERAC_HOST_DEVICE constexpr void scale_gradient(zero& /*x*/, double /*scale*/) {}
+
+/**
+ * @brief multiply the gradient of a dual number by a scalar, leaving its value unchanged
+ *
+ * @tparam gradient_type the type of the gradient of the dual number
+ * @param x the dual number to be modified
+ * @param scale the scaling factor
+ */
+template <typename gradient_type>
+SERAC_HOST_DEVICE constexpr void scale_gradient(dual<gradient_type>& x, double scale)
+{
+  x.gradient = scale * x.gradient;
+}
+
+/// @overload
+template <typename T, int... n>
+SERAC_HOST_DEVICE constexpr void scale_gradient(tensor<T, n...>& x, double scale)
+{
+  for_constexpr<n...>([&](auto... i) { scale_gradient(x(i...), scale); });
+}
+
+/// @overload
+template <typename... T>
+SERAC_HOST_DEVICE constexpr void scale_gradient(serac::tuple<T...>& x, double scale)
+{
+  for_constexpr<sizeof...(T)>([&](auto i) { scale_gradient(serac::get<i>(x), scale); });
+}
+
 /**
  * @brief Extracts all of the values from a tensor of dual numbers
  *
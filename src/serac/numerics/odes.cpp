@@ -6,8 +6,78 @@
 
 #include "serac/numerics/odes.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "serac/infrastructure/logger.hpp"
+
 namespace serac::mfem_ext {
 
+namespace {
+
+/**
+ * @brief Compute the weighted root-mean-square norm of a local error estimate, where each entry is
+ * scaled by (absolute_tol + relative_tol * |x|). Steps with a norm no larger than 1 are acceptable.
+ */
+double weightedErrorNorm(const mfem::Vector& error, const mfem::Vector& x_start, const mfem::Vector& x_end,
+                         const AdaptiveTimesteppingOptions& opts, MPI_Comm comm)
+{
+  double sum_of_squares = 0.0;
+  double n              = error.Size();
+  for (int i = 0; i < error.Size(); i++) {
+    double scaled_error = error[i] / (opts.absolute_tol +
+                                      opts.relative_tol * std::max(std::abs(x_start[i]), std::abs(x_end[i])));
+    sum_of_squares += scaled_error * scaled_error;
+  }
+
+  if (comm != MPI_COMM_NULL) {
+    MPI_Allreduce(MPI_IN_PLACE, &sum_of_squares, 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(MPI_IN_PLACE, &n, 1, MPI_DOUBLE, MPI_SUM, comm);
+  }
+
+  return (n > 0) ? std::sqrt(sum_of_squares / n) : 0.0;
+}
+
+/**
+ * @brief The factor by which to scale the step size, given the weighted norm of a local error
+ * estimate of order (p + 1) in dt
+ */
+double stepScaleFactor(double error_norm, int p, const AdaptiveTimesteppingOptions& opts)
+{
+  if (error_norm == 0.0) {
+    return opts.max_scale;
+  }
+  double scale = opts.safety_factor * std::pow(1.0 / error_norm, 1.0 / (p + 1));
+  return std::clamp(scale, opts.min_scale, opts.max_scale);
+}
+
+/**
+ * @brief The coefficient of the local error estimate of Zienkiewicz and Xie, |beta - 1/6|, for the second order
+ * methods that are Newmark methods with a known beta
+ *
+ * @note LinearAcceleration (beta = 1/6) is excluded, as the estimate vanishes for it, and the generalized-alpha
+ * methods (including mfem's AverageAcceleration) are excluded, as the estimate doesn't apply to them.
+ */
+double newmarkErrorCoefficient(TimestepMethod method)
+{
+  switch (method) {
+    case TimestepMethod::Newmark:
+      return 0.25 - 1.0 / 6.0;
+    case TimestepMethod::FoxGoodwin:
+      return 1.0 / 6.0 - 1.0 / 12.0;
+    case TimestepMethod::CentralDifference:
+      return 1.0 / 6.0;
+    default:
+      SLIC_ERROR_ROOT(
+          "Adaptive timestepping of second order ODEs is only supported for the Newmark, FoxGoodwin and "
+          "CentralDifference methods");
+      return 0.0;
+  }
+}
+
+}  // namespace
+
 SecondOrderODE::SecondOrderODE(int n, State&& state, const EquationSolver& solver, const BoundaryConditionManager& bcs)
     : mfem::SecondOrderTimeDependentOperator(n, 0.0), state_(std::move(state)), solver_(solver), bcs_(bcs), zero_(n)
 {
@@ -117,6 +187,58 @@ void SecondOrderODE::Step(mfem::Vector& x, mfem::Vector& dxdt, double& time, dou
   }
 }
 
+double SecondOrderODE::AdaptiveStep(mfem::Vector& x, mfem::Vector& dxdt, double& time, double& dt)
+{
+  const auto& opts = adaptive_options_;
+  SLIC_ERROR_ROOT_IF(!opts.enabled, "SecondOrderODE::AdaptiveStep() requires adaptive timestepping to be enabled");
+
+  const double error_coefficient = newmarkErrorCoefficient(timestepper_);
+
+  x_start_                 = x;
+  dxdt_start_              = dxdt;
+  d2u_dt2_start_           = state_.d2u_dt2;
+  const double time_start  = time;
+  const auto   constrained = bcs_.allEssentialTrueDofs();
+
+  dt = std::clamp(dt, opts.min_dt, opts.max_dt);
+  for (int attempt = 1;; attempt++) {
+    nonlinear_solves_converged_ = true;
+
+    double step = dt;
+    Step(x, dxdt, time, step);
+
+    double error_norm = std::numeric_limits<double>::infinity();
+    if (nonlinear_solves_converged_) {
+      // e := |beta - 1/6| * dt^2 * (d2u_dt2_{n+1} - d2u_dt2_{n})
+      subtract(error_coefficient * dt * dt, state_.d2u_dt2, d2u_dt2_start_, error_);
+      error_.SetSubVector(constrained, 0.0);
+      error_norm = weightedErrorNorm(error_, x_start_, x, opts, solver_.nonlinearSolver().GetComm());
+    }
+
+    double scale = stepScaleFactor(error_norm, 2, opts);
+    if (error_norm <= 1.0) {
+      return std::clamp(scale * dt, opts.min_dt, opts.max_dt);
+    }
+
+    SLIC_ERROR_ROOT_IF(attempt > opts.max_rejections || dt <= opts.min_dt,
+                       axom::fmt::format("Adaptive timestepping could not find an acceptable step size at time {} "
+                                         "after {} attempts (last attempted dt = {})",
+                                         time_start, attempt, dt));
+
+    // restore the state from the start of the step, and try again with a smaller step
+    x              = x_start_;
+    dxdt           = dxdt_start_;
+    state_.d2u_dt2 = d2u_dt2_start_;
+    time           = time_start;
+    if (second_order_ode_solver_) {
+      second_order_ode_solver_->Init(*this);
+    } else {
+      first_order_system_ode_solver_->Init(*this);
+    }
+    dt = std::max(scale * dt, opts.min_dt);
+  }
+}
+
 void SecondOrderODE::ImplicitSolve(const double dt, const mfem::Vector& u, mfem::Vector& du_dt)
 {
   /* A second order o.d.e can be recast as a first order system
@@ -243,6 +365,7 @@ void SecondOrderODE::Solve(const double time, const double c0, const double c1,
 
   solver_.solve(d2u_dt2);
   SLIC_WARNING_ROOT_IF(!solver_.nonlinearSolver().GetConverged(), "Newton Solver did not converge.");
+  nonlinear_solves_converged_ = nonlinear_solves_converged_ && solver_.nonlinearSolver().GetConverged();
 
   state_.d2u_dt2 = d2u_dt2;
 }
@@ -299,6 +422,85 @@ void FirstOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
   ode_solver_->Init(*this);
 }
 
+double FirstOrderODE::AdaptiveStep(mfem::Vector& x, double& time, double& dt)
+{
+  const auto& opts = adaptive_options_;
+  SLIC_ERROR_ROOT_IF(!opts.enabled, "FirstOrderODE::AdaptiveStep() requires adaptive timestepping to be enabled");
+
+  x_start_                       = x;
+  du_dt_start_                   = state_.du_dt;
+  const double time_start        = time;
+  const double previous_dt_start = state_.previous_dt;
+  const auto   constrained       = bcs_.allEssentialTrueDofs();
+
+  // on the first step, the rate at the start of the step is not known,
+  // so there is nothing to compare the new rate against
+  const bool first_step = (previous_dt_start <= 0.0);
+
+  dt = std::clamp(dt, opts.min_dt, opts.max_dt);
+  for (int attempt = 1;; attempt++) {
+    nonlinear_solves_converged_ = true;
+
+    double step = dt;
+    Step(x, time, step);
+
+    double error_norm = std::numeric_limits<double>::infinity();
+    if (nonlinear_solves_converged_ && first_step) {
+      // there is no rate from a previous step to compare against, so the error is estimated by comparing
+      // the step against two half steps: e := 2 * (x_{half steps} - x_{step}), for a first order method
+      x_step_           = x;
+      du_dt_step_       = state_.du_dt;
+      double step_taken = state_.previous_dt;
+
+      x                  = x_start_;
+      state_.du_dt       = du_dt_start_;
+      state_.previous_dt = previous_dt_start;
+      time               = time_start;
+      ode_solver_->Init(*this);
+      for (int half = 0; half < 2; half++) {
+        double half_step = 0.5 * dt;
+        Step(x, time, half_step);
+      }
+
+      if (nonlinear_solves_converged_) {
+        subtract(2.0, x, x_step_, error_);
+        error_.SetSubVector(constrained, 0.0);
+        error_norm = weightedErrorNorm(error_, x_start_, x_step_, opts, solver_.nonlinearSolver().GetComm());
+      }
+
+      // continue from the (full) step, so that the step that was taken is the one that is reported
+      x                  = x_step_;
+      state_.du_dt       = du_dt_step_;
+      state_.previous_dt = step_taken;
+      time               = time_start + dt;
+      ode_solver_->Init(*this);
+    } else if (nonlinear_solves_converged_) {
+      // e := 0.5 * dt * (du_dt_{n+1} - du_dt_{n})
+      subtract(0.5 * dt, state_.du_dt, du_dt_start_, error_);
+      error_.SetSubVector(constrained, 0.0);
+      error_norm = weightedErrorNorm(error_, x_start_, x, opts, solver_.nonlinearSolver().GetComm());
+    }
+
+    double scale = stepScaleFactor(error_norm, 1, opts);
+    if (error_norm <= 1.0) {
+      return std::clamp(scale * dt, opts.min_dt, opts.max_dt);
+    }
+
+    SLIC_ERROR_ROOT_IF(attempt > opts.max_rejections || dt <= opts.min_dt,
+                       axom::fmt::format("Adaptive timestepping could not find an acceptable step size at time {} "
+                                         "after {} attempts (last attempted dt = {})",
+                                         time_start, attempt, dt));
+
+    // restore the state from the start of the step, and try again with a smaller step
+    x                  = x_start_;
+    state_.du_dt       = du_dt_start_;
+    state_.previous_dt = previous_dt_start;
+    time               = time_start;
+    ode_solver_->Init(*this);
+    dt = std::max(scale * dt, opts.min_dt);
+  }
+}
+
 void FirstOrderODE::Solve(const double time, const double dt, const mfem::Vector& u, mfem::Vector& du_dt) const
 {
   // assign these values to variables with greater scope,
@@ -359,6 +561,7 @@ void FirstOrderODE::Solve(const double time, const double dt, const mfem::Vector
 
   solver_.solve(du_dt);
   SLIC_WARNING_ROOT_IF(!solver_.nonlinearSolver().GetConverged(), "Newton Solver did not converge.");
+  nonlinear_solves_converged_ = nonlinear_solves_converged_ && solver_.nonlinearSolver().GetConverged();
 
   state_.du_dt       = du_dt;
   state_.previous_dt = dt;
@@ -158,6 +158,31 @@ public:
    */
   void Step(mfem::Vector& x, mfem::Vector& dxdt, double& time, double& dt);
 
+  /**
+   * @brief Performs a time step, adjusting its size to keep an estimate of the local error within tolerance
+   *
+   * The local error is estimated from the change in acceleration over the step (Zienkiewicz and Xie, 1991),
+   *   e := |beta - 1/6| * dt^2 * (d2u_dt2_{n+1} - d2u_dt2_{n}),
+   * so only the Newmark methods with a known beta are supported: Newmark (beta = 1/4), FoxGoodwin (beta = 1/12)
+   * and CentralDifference (beta = 0). Steps whose weighted RMS error exceeds 1, or whose nonlinear solves did not
+   * converge, are rejected and retried with a smaller step size.
+   *
+   * @param[inout] x The predicted solution
+   * @param[inout] dxdt The predicted rate
+   * @param[inout] time The current time
+   * @param[inout] dt On input, the size of the first step to attempt. On output, the size of the step that was taken.
+   * @return The suggested size of the next step
+   *
+   * @pre Adaptive timestepping has been enabled with SetAdaptiveOptions()
+   */
+  double AdaptiveStep(mfem::Vector& x, mfem::Vector& dxdt, double& time, double& dt);
+
+  /**
+   * @brief Configures the adaptive timestep size control used by AdaptiveStep()
+   * @param[in] options The adaptive timestepping parameters
+   */
+  void SetAdaptiveOptions(const AdaptiveTimesteppingOptions& options) { adaptive_options_ = options; }
+
   /**
    * @brief Get a reference to the current state
    */
@@ -222,6 +247,28 @@ private:
   mutable mfem::Vector dU_dt_;
   mutable mfem::Vector d2U_dt2_;
 
+  /**
+   * @brief Copies of the state at the start of a step, used to restore it if an adaptive step is rejected
+   */
+  mfem::Vector x_start_;
+  mfem::Vector dxdt_start_;
+  mfem::Vector d2u_dt2_start_;
+
+  /**
+   * @brief Working vector for the local error estimate of an adaptive step
+   */
+  mfem::Vector error_;
+
+  /**
+   * @brief Whether all of the nonlinear solves performed since the start of the current step have converged
+   */
+  mutable bool nonlinear_solves_converged_ = true;
+
+  /**
+   * @brief Parameters for adaptive timestep size control
+   */
+  AdaptiveTimesteppingOptions adaptive_options_;
+
   serac::TimestepMethod timestepper_;
 };
 
@@ -347,6 +394,31 @@ public:
     }
   }
 
+  /**
+   * @brief Performs a time step, adjusting its size to keep an estimate of the local error within tolerance
+   *
+   * The local error is estimated by comparing against the trapezoid rule,
+   *   e := (1 / 2) * dt * (du_dt_{n+1} - du_dt_{n}),
+   * which is the leading error term of backward Euler (and a conservative estimate for higher order methods).
+   * Steps whose weighted RMS error exceeds 1, or whose nonlinear solves did not converge, are rejected and
+   * retried with a smaller step size. On the first step, there is no rate from a previous step to compare against,
+   * so the error is instead estimated by repeating the step as two half steps.
+   *
+   * @param[inout] x The predicted solution
+   * @param[inout] time The current time
+   * @param[inout] dt On input, the size of the first step to attempt. On output, the size of the step that was taken.
+   * @return The suggested size of the next step
+   *
+   * @pre Adaptive timestepping has been enabled with SetAdaptiveOptions()
+   */
+  double AdaptiveStep(mfem::Vector& x, double& time, double& dt);
+
+  /**
+   * @brief Configures the adaptive timestep size control used by AdaptiveStep()
+   * @param[in] options The adaptive timestepping parameters
+   */
+  void SetAdaptiveOptions(const AdaptiveTimesteppingOptions& options) { adaptive_options_ = options; }
+
   /**
    * @brief Query the timestep method for the ode solver
    *
@@ -395,6 +467,33 @@ private:
   mutable mfem::Vector U_plus_;
   mutable mfem::Vector dU_dt_;
 
+  /**
+   * @brief Copies of the state at the start of a step, used to restore it if an adaptive step is rejected
+   */
+  mfem::Vector x_start_;
+  mfem::Vector du_dt_start_;
+
+  /**
+   * @brief Copies of the state at the end of the first step, while it is compared against two half steps
+   */
+  mfem::Vector x_step_;
+  mfem::Vector du_dt_step_;
+
+  /**
+   * @brief Working vector for the local error estimate of an adaptive step
+   */
+  mfem::Vector error_;
+
+  /**
+   * @brief Whether all of the nonlinear solves performed since the start of the current step have converged
+   */
+  mutable bool nonlinear_solves_converged_ = true;
+
+  /**
+   * @brief Parameters for adaptive timestep size control
+   */
+  AdaptiveTimesteppingOptions adaptive_options_;
+
   TimestepMethod timestepper_;
 };
 
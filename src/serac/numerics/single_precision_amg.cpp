@@ -0,0 +1,463 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/single_precision_amg.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "_hypre_parcsr_ls.h"
+
+#include "serac/infrastructure/logger.hpp"
+#include "serac/numerics/equation_solver.hpp"
+
+namespace serac {
+
+namespace {
+
+/// @brief copy a hypre CSR block, converting its values to single precision
+void copyBlock(hypre_CSRMatrix* block, std::vector<int>& I, std::vector<int>& J, std::vector<float>& A)
+{
+  const HYPRE_Int rows = hypre_CSRMatrixNumRows(block);
+  const HYPRE_Int nnz  = hypre_CSRMatrixNumNonzeros(block);
+
+  I.assign(std::size_t(rows) + 1, 0);
+  J.resize(std::size_t(nnz));
+  A.resize(std::size_t(nnz));
+
+  // empty blocks (e.g. the off-diagonal block on a single rank) may not have any arrays
+  if (hypre_CSRMatrixI(block)) {
+    std::copy(hypre_CSRMatrixI(block), hypre_CSRMatrixI(block) + rows + 1, I.begin());
+  }
+  if (nnz > 0) {
+    std::copy(hypre_CSRMatrixJ(block), hypre_CSRMatrixJ(block) + nnz, J.begin());
+    std::transform(hypre_CSRMatrixData(block), hypre_CSRMatrixData(block) + nnz, A.begin(),
+                   [](double value) { return static_cast<float>(value); });
+  }
+}
+
+/// @brief the tag of the messages of the single precision products, which have a communicator of their own
+constexpr int exchange_tag = 0;
+
+}  // namespace
+
+SinglePrecisionParCSR::SinglePrecisionParCSR(hypre_ParCSRMatrix* matrix, MPI_Comm comm)
+    : comm_(comm),
+      rows_(hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matrix))),
+      cols_(hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(matrix))),
+      global_rows_(hypre_ParCSRMatrixGlobalNumRows(matrix)),
+      global_cols_(hypre_ParCSRMatrixGlobalNumCols(matrix)),
+      first_column_(hypre_ParCSRMatrixFirstColDiag(matrix))
+{
+  copyBlock(hypre_ParCSRMatrixDiag(matrix), diag_I_, diag_J_, diag_A_);
+  copyBlock(hypre_ParCSRMatrixOffd(matrix), offd_I_, offd_J_, offd_A_);
+
+  const HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(matrix));
+  if (num_cols_offd > 0) {
+    HYPRE_BigInt* col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+    col_map_offd_.assign(col_map_offd, col_map_offd + num_cols_offd);
+  }
+  offd_values_.resize(std::size_t(num_cols_offd));
+
+  if (!hypre_ParCSRMatrixCommPkg(matrix)) {
+    hypre_MatvecCommPkgCreate(matrix);
+  }
+  hypre_ParCSRCommPkg* pkg = hypre_ParCSRMatrixCommPkg(matrix);
+
+  const HYPRE_Int num_sends = hypre_ParCSRCommPkgNumSends(pkg);
+  send_procs_.assign(hypre_ParCSRCommPkgSendProcs(pkg), hypre_ParCSRCommPkgSendProcs(pkg) + num_sends);
+  send_starts_.assign(hypre_ParCSRCommPkgSendMapStarts(pkg), hypre_ParCSRCommPkgSendMapStarts(pkg) + num_sends + 1);
+  send_elements_.assign(hypre_ParCSRCommPkgSendMapElmts(pkg),
+                        hypre_ParCSRCommPkgSendMapElmts(pkg) + send_starts_[std::size_t(num_sends)]);
+  send_buffer_.resize(send_elements_.size());
+
+  const HYPRE_Int num_recvs = hypre_ParCSRCommPkgNumRecvs(pkg);
+  recv_procs_.assign(hypre_ParCSRCommPkgRecvProcs(pkg), hypre_ParCSRCommPkgRecvProcs(pkg) + num_recvs);
+  recv_starts_.assign(hypre_ParCSRCommPkgRecvVecStarts(pkg), hypre_ParCSRCommPkgRecvVecStarts(pkg) + num_recvs + 1);
+}
+
+void SinglePrecisionParCSR::exchange(const std::vector<float>& x) const
+{
+  for (std::size_t j = 0; j < send_elements_.size(); j++) {
+    send_buffer_[j] = x[std::size_t(send_elements_[j])];
+  }
+
+  std::vector<MPI_Request> requests(recv_procs_.size() + send_procs_.size());
+  for (std::size_t i = 0; i < recv_procs_.size(); i++) {
+    MPI_Irecv(&offd_values_[std::size_t(recv_starts_[i])], recv_starts_[i + 1] - recv_starts_[i], MPI_FLOAT,
+              recv_procs_[i], exchange_tag, comm_, &requests[i]);
+  }
+  for (std::size_t i = 0; i < send_procs_.size(); i++) {
+    MPI_Isend(&send_buffer_[std::size_t(send_starts_[i])], send_starts_[i + 1] - send_starts_[i], MPI_FLOAT,
+              send_procs_[i], exchange_tag, comm_, &requests[recv_procs_.size() + i]);
+  }
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+void SinglePrecisionParCSR::reverseExchange(std::vector<float>& y) const
+{
+  // the communication pattern of exchange(), in reverse
+  std::vector<MPI_Request> requests(recv_procs_.size() + send_procs_.size());
+  for (std::size_t i = 0; i < send_procs_.size(); i++) {
+    MPI_Irecv(&send_buffer_[std::size_t(send_starts_[i])], send_starts_[i + 1] - send_starts_[i], MPI_FLOAT,
+              send_procs_[i], exchange_tag, comm_, &requests[i]);
+  }
+  for (std::size_t i = 0; i < recv_procs_.size(); i++) {
+    MPI_Isend(&offd_values_[std::size_t(recv_starts_[i])], recv_starts_[i + 1] - recv_starts_[i], MPI_FLOAT,
+              recv_procs_[i], exchange_tag, comm_, &requests[send_procs_.size() + i]);
+  }
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+
+  for (std::size_t j = 0; j < send_elements_.size(); j++) {
+    y[std::size_t(send_elements_[j])] += send_buffer_[j];
+  }
+}
+
+void SinglePrecisionParCSR::mult(const std::vector<float>& x, std::vector<float>& y) const
+{
+  exchange(x);
+
+  y.resize(std::size_t(rows_));
+  for (std::size_t i = 0; i < std::size_t(rows_); i++) {
+    float sum = 0.0f;
+    for (int k = diag_I_[i]; k < diag_I_[i + 1]; k++) {
+      sum += diag_A_[std::size_t(k)] * x[std::size_t(diag_J_[std::size_t(k)])];
+    }
+    for (int k = offd_I_[i]; k < offd_I_[i + 1]; k++) {
+      sum += offd_A_[std::size_t(k)] * offd_values_[std::size_t(offd_J_[std::size_t(k)])];
+    }
+    y[i] = sum;
+  }
+}
+
+void SinglePrecisionParCSR::multTranspose(const std::vector<float>& x, std::vector<float>& y) const
+{
+  y.assign(std::size_t(cols_), 0.0f);
+  std::fill(offd_values_.begin(), offd_values_.end(), 0.0f);
+
+  for (std::size_t i = 0; i < std::size_t(rows_); i++) {
+    for (int k = diag_I_[i]; k < diag_I_[i + 1]; k++) {
+      y[std::size_t(diag_J_[std::size_t(k)])] += diag_A_[std::size_t(k)] * x[i];
+    }
+    for (int k = offd_I_[i]; k < offd_I_[i + 1]; k++) {
+      offd_values_[std::size_t(offd_J_[std::size_t(k)])] += offd_A_[std::size_t(k)] * x[i];
+    }
+  }
+
+  reverseExchange(y);
+}
+
+std::vector<float> SinglePrecisionParCSR::l1Diagonal() const
+{
+  std::vector<float> diagonal(std::size_t(rows_), 0.0f);
+  for (std::size_t i = 0; i < std::size_t(rows_); i++) {
+    for (int k = diag_I_[i]; k < diag_I_[i + 1]; k++) {
+      if (std::size_t(diag_J_[std::size_t(k)]) == i) {
+        diagonal[i] += diag_A_[std::size_t(k)];
+      }
+    }
+    for (int k = offd_I_[i]; k < offd_I_[i + 1]; k++) {
+      diagonal[i] += std::abs(offd_A_[std::size_t(k)]);
+    }
+  }
+  return diagonal;
+}
+
+void SinglePrecisionParCSR::symmetricGaussSeidel(const std::vector<float>& b, std::vector<float>& x,
+                                                 const std::vector<float>& diagonal) const
+{
+  auto relax = [&](std::size_t i) {
+    if (diagonal[i] == 0.0f) {
+      return;
+    }
+    float residual = b[i];
+    for (int k = diag_I_[i]; k < diag_I_[i + 1]; k++) {
+      residual -= diag_A_[std::size_t(k)] * x[std::size_t(diag_J_[std::size_t(k)])];
+    }
+    for (int k = offd_I_[i]; k < offd_I_[i + 1]; k++) {
+      residual -= offd_A_[std::size_t(k)] * offd_values_[std::size_t(offd_J_[std::size_t(k)])];
+    }
+    x[i] += residual / diagonal[i];
+  };
+
+  exchange(x);
+  for (std::size_t i = 0; i < std::size_t(rows_); i++) {
+    relax(i);
+  }
+
+  exchange(x);
+  for (std::size_t i = std::size_t(rows_); i > 0; i--) {
+    relax(i - 1);
+  }
+}
+
+std::vector<double> SinglePrecisionParCSR::denseRows() const
+{
+  const auto          n = static_cast<std::size_t>(global_cols_);
+  std::vector<double> dense(std::size_t(rows_) * n, 0.0);
+  for (std::size_t i = 0; i < std::size_t(rows_); i++) {
+    for (int k = diag_I_[i]; k < diag_I_[i + 1]; k++) {
+      dense[i * n + std::size_t(first_column_ + diag_J_[std::size_t(k)])] = diag_A_[std::size_t(k)];
+    }
+    for (int k = offd_I_[i]; k < offd_I_[i + 1]; k++) {
+      dense[i * n + std::size_t(col_map_offd_[std::size_t(offd_J_[std::size_t(k)])])] = offd_A_[std::size_t(k)];
+    }
+  }
+  return dense;
+}
+
+std::size_t SinglePrecisionParCSR::bytes() const
+{
+  return sizeof(int) * (diag_I_.size() + diag_J_.size() + offd_I_.size() + offd_J_.size()) +
+         sizeof(float) * (diag_A_.size() + offd_A_.size()) + sizeof(HYPRE_BigInt) * col_map_offd_.size();
+}
+
+SinglePrecisionAMG::SinglePrecisionAMG(int print_level) : print_level_(print_level)
+{
+  fine_smoother_.SetType(mfem::HypreSmoother::l1GS);
+  fine_smoother_.iterative_mode = true;
+}
+
+SinglePrecisionAMG::~SinglePrecisionAMG()
+{
+  if (comm_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&comm_);
+  }
+}
+
+void SinglePrecisionAMG::setElasticityNearNullspace(mfem::ParFiniteElementSpace& space) { elasticity_space_ = &space; }
+
+void SinglePrecisionAMG::SetOperator(const mfem::Operator& op)
+{
+  auto* matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+  SLIC_ERROR_ROOT_IF(!matrix,
+                     "The single precision AMG preconditioner requires an assembled (HypreParMatrix) operator");
+
+  height = matrix->Height();
+  width  = matrix->Width();
+
+  fine_operator_ = matrix;
+  fine_smoother_.SetOperator(*matrix);
+  fine_residual_.SetSize(matrix->Height());
+
+  operators_.clear();
+  interpolations_.clear();
+  diagonals_.clear();
+  coarse_inverse_.reset();
+  coarse_matrix_.SetSize(0);
+
+  if (comm_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&comm_);
+  }
+  MPI_Comm_dup(matrix->GetComm(), &comm_);
+
+  {
+    // build the hierarchy in double precision. Note: hypre only builds the hierarchy in the first
+    // application of the preconditioner, and frees it (but not the finest operator) when it is destroyed
+    BoomerAMG amg;
+    amg.SetPrintLevel(print_level_);
+    if (elasticity_space_) {
+      amg.setElasticityNearNullspace(*elasticity_space_);
+    }
+    amg.SetOperator(*matrix);
+
+    mfem::Vector b(matrix->Height());
+    mfem::Vector x(matrix->Height());
+    b = 0.0;
+    amg.Mult(b, x);
+
+    HYPRE_Solver solver   = amg;
+    auto*        amg_data = reinterpret_cast<hypre_ParAMGData*>(solver);
+
+    const int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+    hypre_ParCSRMatrix** A          = hypre_ParAMGDataAArray(amg_data);
+    hypre_ParCSRMatrix** P          = hypre_ParAMGDataPArray(amg_data);
+
+    // BoomerAMG may have permuted the operator for its nodal coarsening, in which case the first
+    // interpolation is permuted back, so that the finest level is the operator itself
+    std::unique_ptr<mfem::HypreParMatrix> permuted_interpolation;
+    if (amg.permutation() && num_levels > 1) {
+      mfem::HypreParMatrix first_interpolation(P[0], false);
+      permuted_interpolation.reset(mfem::ParMult(amg.permutation(), &first_interpolation));
+    }
+
+    // the finest level is applied with the (double precision) operator itself
+    operators_.emplace_back();
+    diagonals_.emplace_back();
+    for (int level = 0; level < num_levels; level++) {
+      if (level > 0) {
+        operators_.push_back(std::make_unique<SinglePrecisionParCSR>(A[level], comm_));
+        diagonals_.push_back(operators_.back()->l1Diagonal());
+      }
+      if (level < num_levels - 1) {
+        hypre_ParCSRMatrix* interpolation =
+            (level == 0 && permuted_interpolation) ? static_cast<hypre_ParCSRMatrix*>(*permuted_interpolation)
+                                                   : P[level];
+        interpolations_.push_back(std::make_unique<SinglePrecisionParCSR>(interpolation, comm_));
+      }
+    }
+  }
+
+  const std::size_t num_levels = operators_.size();
+  rhs_.resize(num_levels);
+  solution_.resize(num_levels);
+  residual_.resize(num_levels);
+  for (std::size_t level = 0; level < num_levels; level++) {
+    const auto rows = std::size_t((level == 0) ? matrix->Height() : operators_[level]->rows());
+    rhs_[level].resize(rows);
+    solution_[level].resize(rows);
+    residual_[level].resize(rows);
+  }
+
+  // gather the coarsest operator on every rank, if it is small enough to solve directly
+  if (num_levels > 1 && operators_.back()->globalRows() <= max_direct_coarse_size) {
+    const SinglePrecisionParCSR& coarsest = *operators_.back();
+    const int                    n        = static_cast<int>(coarsest.globalRows());
+
+    int num_ranks = 0;
+    MPI_Comm_size(coarsest.comm(), &num_ranks);
+    coarse_counts_.resize(std::size_t(num_ranks));
+    coarse_offsets_.assign(std::size_t(num_ranks) + 1, 0);
+
+    const int local_rows = coarsest.rows();
+    MPI_Allgather(&local_rows, 1, MPI_INT, coarse_counts_.data(), 1, MPI_INT, coarsest.comm());
+    for (std::size_t r = 0; r < std::size_t(num_ranks); r++) {
+      coarse_offsets_[r + 1] = coarse_offsets_[r] + coarse_counts_[r];
+    }
+
+    std::vector<int> value_counts(std::size_t(num_ranks));
+    std::vector<int> value_offsets(std::size_t(num_ranks));
+    for (std::size_t r = 0; r < std::size_t(num_ranks); r++) {
+      value_counts[r]  = coarse_counts_[r] * n;
+      value_offsets[r] = coarse_offsets_[r] * n;
+    }
+
+    // note: the dense rows are row-major, and mfem::DenseMatrix is column-major, so this is the transpose
+    std::vector<double> local = coarsest.denseRows();
+    coarse_matrix_.SetSize(n);
+    MPI_Allgatherv(local.data(), local_rows * n, MPI_DOUBLE, coarse_matrix_.Data(), value_counts.data(),
+                   value_offsets.data(), MPI_DOUBLE, coarsest.comm());
+    coarse_matrix_.Transpose();
+
+    coarse_inverse_ = std::make_unique<mfem::DenseMatrixInverse>(coarse_matrix_);
+  }
+
+  memory_ = TrackedAllocation(MemoryCategory::AMG, hierarchyBytes());
+}
+
+std::size_t SinglePrecisionAMG::hierarchyBytes() const
+{
+  // like BoomerAMG, the finest operator isn't counted as part of the hierarchy (and it isn't copied)
+  std::size_t bytes = 0;
+  for (std::size_t level = 1; level < operators_.size(); level++) {
+    bytes += operators_[level]->bytes() + sizeof(float) * diagonals_[level].size();
+  }
+  for (auto& P : interpolations_) {
+    bytes += P->bytes();
+  }
+  bytes += sizeof(double) * std::size_t(coarse_matrix_.Height()) * std::size_t(coarse_matrix_.Width());
+  return bytes;
+}
+
+void SinglePrecisionAMG::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(operators_.empty(), "The single precision AMG preconditioner has no operator yet");
+
+  // pre-smoothing, in double precision
+  x = 0.0;
+  fine_smoother_.Mult(b, x);
+
+  if (operators_.size() == 1) {
+    // the operator is too small to coarsen, so it is only smoothed
+    for (int sweep = 1; sweep < coarse_smoothing_sweeps; sweep++) {
+      fine_smoother_.Mult(b, x);
+    }
+    return;
+  }
+
+  // coarse grid correction, in single precision
+  fine_operator_->Mult(x, fine_residual_);
+  subtract(b, fine_residual_, fine_residual_);
+
+  const double* r_data = fine_residual_.HostRead();
+  for (std::size_t i = 0; i < residual_[0].size(); i++) {
+    residual_[0][i] = static_cast<float>(r_data[i]);
+  }
+  interpolations_[0]->multTranspose(residual_[0], rhs_[1]);
+  cycle(1);
+  interpolations_[0]->mult(solution_[1], residual_[0]);
+
+  double* x_data = x.HostReadWrite();
+  for (std::size_t i = 0; i < residual_[0].size(); i++) {
+    x_data[i] += static_cast<double>(residual_[0][i]);
+  }
+
+  // post-smoothing, in double precision
+  fine_smoother_.Mult(b, x);
+}
+
+void SinglePrecisionAMG::coarseSolve() const
+{
+  const std::size_t level = operators_.size() - 1;
+
+  if (!coarse_inverse_) {
+    std::fill(solution_[level].begin(), solution_[level].end(), 0.0f);
+    for (int sweep = 0; sweep < coarse_smoothing_sweeps; sweep++) {
+      operators_[level]->symmetricGaussSeidel(rhs_[level], solution_[level], diagonals_[level]);
+    }
+    return;
+  }
+
+  const SinglePrecisionParCSR& coarsest = *operators_[level];
+
+  std::vector<double> local(rhs_[level].begin(), rhs_[level].end());
+  mfem::Vector        b(coarse_matrix_.Height());
+  mfem::Vector        x(coarse_matrix_.Height());
+  MPI_Allgatherv(local.data(), coarsest.rows(), MPI_DOUBLE, b.GetData(), coarse_counts_.data(),
+                 coarse_offsets_.data(), MPI_DOUBLE, coarsest.comm());
+
+  coarse_inverse_->Mult(b, x);
+
+  int rank = 0;
+  MPI_Comm_rank(coarsest.comm(), &rank);
+  for (std::size_t i = 0; i < solution_[level].size(); i++) {
+    solution_[level][i] = static_cast<float>(x(coarse_offsets_[std::size_t(rank)] + static_cast<int>(i)));
+  }
+}
+
+void SinglePrecisionAMG::cycle(std::size_t level) const
+{
+  if (level + 1 == operators_.size()) {
+    coarseSolve();
+    return;
+  }
+
+  const SinglePrecisionParCSR& A = *operators_[level];
+
+  auto& x = solution_[level];
+  auto& r = residual_[level];
+
+  // pre-smoothing
+  std::fill(x.begin(), x.end(), 0.0f);
+  A.symmetricGaussSeidel(rhs_[level], x, diagonals_[level]);
+
+  // coarse grid correction
+  A.mult(x, r);
+  for (std::size_t i = 0; i < r.size(); i++) {
+    r[i] = rhs_[level][i] - r[i];
+  }
+  interpolations_[level]->multTranspose(r, rhs_[level + 1]);
+  cycle(level + 1);
+  interpolations_[level]->mult(solution_[level + 1], r);
+  for (std::size_t i = 0; i < x.size(); i++) {
+    x[i] += r[i];
+  }
+
+  // post-smoothing
+  A.symmetricGaussSeidel(rhs_[level], x, diagonals_[level]);
+}
+
+}  // namespace serac
@@ -0,0 +1,246 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file single_precision_amg.hpp
+ *
+ * @brief An algebraic multigrid preconditioner whose coarse levels are stored and applied in single precision
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/infrastructure/memory.hpp"
+
+namespace serac {
+
+/**
+ * @brief A copy of a hypre_ParCSRMatrix with single precision values
+ *
+ * The layout (a local "diagonal" block, and an "off-diagonal" block whose columns are owned by other ranks) and the
+ * communication pattern of the matrix-vector products are those of hypre, but the values (and the vectors that are
+ * exchanged between ranks) are floats.
+ */
+class SinglePrecisionParCSR {
+public:
+  /**
+   * @brief Copy a hypre matrix
+   *
+   * @param matrix The matrix, whose communication package is created if it doesn't have one yet
+   * @param comm The communicator of the products, a duplicate of the matrix's, so that their messages can't be
+   * confused with any others
+   */
+  SinglePrecisionParCSR(hypre_ParCSRMatrix* matrix, MPI_Comm comm);
+
+  /**
+   * @brief Compute y = A x
+   */
+  void mult(const std::vector<float>& x, std::vector<float>& y) const;
+
+  /**
+   * @brief Compute y = A^T x
+   */
+  void multTranspose(const std::vector<float>& x, std::vector<float>& y) const;
+
+  /**
+   * @brief The diagonal of the l1 hybrid Gauss-Seidel smoother: the diagonal entry of each local row, plus the
+   * l1 norm of its entries in the off-diagonal block
+   */
+  std::vector<float> l1Diagonal() const;
+
+  /**
+   * @brief Apply one symmetric (forward, then backward) sweep of l1 hybrid Gauss-Seidel to A x = b
+   *
+   * The local rows are relaxed with Gauss-Seidel, and the entries of the other ranks with Jacobi, which the l1
+   * diagonal keeps convergent (as in hypre's relaxation type 8, the default smoother of BoomerAMG).
+   *
+   * @param b The right hand side
+   * @param x The solution, which is updated in place
+   * @param diagonal The l1 diagonal (see l1Diagonal)
+   */
+  void symmetricGaussSeidel(const std::vector<float>& b, std::vector<float>& x,
+                            const std::vector<float>& diagonal) const;
+
+  /**
+   * @brief The local rows of the matrix, as a dense (row-major) array over all of the global columns
+   */
+  std::vector<double> denseRows() const;
+
+  /// @brief the number of local rows
+  int rows() const { return rows_; }
+
+  /// @brief the number of local columns
+  int cols() const { return cols_; }
+
+  /// @brief the number of global rows
+  HYPRE_BigInt globalRows() const { return global_rows_; }
+
+  /// @brief the number of global columns
+  HYPRE_BigInt globalCols() const { return global_cols_; }
+
+  /// @brief the size (in bytes) of the matrix
+  std::size_t bytes() const;
+
+  /// @brief the MPI communicator of the products
+  MPI_Comm comm() const { return comm_; }
+
+private:
+  /// @brief receive the values of x that the off-diagonal block needs from other ranks into offd_values_
+  void exchange(const std::vector<float>& x) const;
+
+  /// @brief send the contributions in offd_values_ to the ranks that own them, and add them to y
+  void reverseExchange(std::vector<float>& y) const;
+
+  /// @brief the MPI communicator of the products (not owned)
+  MPI_Comm comm_;
+
+  /// @brief the local (and global) numbers of rows and columns
+  int          rows_, cols_;
+  HYPRE_BigInt global_rows_, global_cols_;
+
+  /// @brief the first global column of the diagonal block
+  HYPRE_BigInt first_column_;
+
+  /// @brief the CSR structure and values of the diagonal block
+  std::vector<int>   diag_I_, diag_J_;
+  std::vector<float> diag_A_;
+
+  /// @brief the CSR structure and values of the off-diagonal block
+  std::vector<int>   offd_I_, offd_J_;
+  std::vector<float> offd_A_;
+
+  /// @brief the global columns of the off-diagonal block
+  std::vector<HYPRE_BigInt> col_map_offd_;
+
+  /// @brief the ranks, and the local entries of x, sent to other ranks for their off-diagonal blocks
+  std::vector<int> send_procs_, send_starts_, send_elements_;
+
+  /// @brief the ranks that the off-diagonal block's values are received from
+  std::vector<int> recv_procs_, recv_starts_;
+
+  /// @brief communication buffers
+  mutable std::vector<float> send_buffer_, offd_values_;
+};
+
+/**
+ * @brief An algebraic multigrid preconditioner whose coarse levels are stored and applied in single precision
+ *
+ * The hierarchy is built by BoomerAMG (in double precision) from the assembled operator. Its coarse operators and
+ * interpolations are then copied to single precision, and the double precision hierarchy is freed. Each application
+ * is a V-cycle with l1 hybrid symmetric Gauss-Seidel smoothing (BoomerAMG's default smoother), and a direct solve
+ * on the coarsest level if it is small enough. The finest level is smoothed in double precision with the operator
+ * itself, which is not copied, so only the coarse-grid corrections are computed in single precision.
+ *
+ * This halves the memory (and bandwidth) of the coarse levels, at the cost of a less accurate preconditioner. As
+ * rounding makes each application (slightly) nonlinear, it is best used in a flexible Krylov solver
+ * (LinearSolver::FGMRES), which still solves the system in double precision.
+ */
+class SinglePrecisionAMG : public mfem::Solver {
+public:
+  /**
+   * @brief Construct a new single precision AMG preconditioner
+   *
+   * @param print_level The print level of BoomerAMG when it builds the hierarchy
+   */
+  explicit SinglePrecisionAMG(int print_level = 0);
+
+  /// @brief Free the communicator of the single precision levels
+  ~SinglePrecisionAMG() override;
+
+  /**
+   * @brief Use the rigid body modes of @a space as the near-nullspace of subsequent operators
+   *
+   * @param space The displacement space of the elasticity problem, which must outlive this object
+   */
+  void setElasticityNearNullspace(mfem::ParFiniteElementSpace& space);
+
+  /**
+   * @brief Build the hierarchy of a new operator
+   *
+   * @param op The assembled operator (a HypreParMatrix), which is used by the finest level and must outlive the
+   * hierarchy
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Apply one V-cycle
+   *
+   * @param b The input vector
+   * @param x The output vector
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief The number of levels of the hierarchy (including the finest)
+   */
+  int numLevels() const { return static_cast<int>(operators_.size()); }
+
+  /**
+   * @brief The size (in bytes) of the single precision levels on this rank
+   */
+  std::size_t hierarchyBytes() const;
+
+  /// @brief the largest (global) size of the coarsest level that is solved directly, rather than smoothed
+  static constexpr HYPRE_BigInt max_direct_coarse_size = 100;
+
+  /// @brief the number of smoothing sweeps on the coarsest level, when it is too large to solve directly
+  static constexpr int coarse_smoothing_sweeps = 10;
+
+private:
+  /// @brief apply a V-cycle, starting from the given (coarse) level
+  void cycle(std::size_t level) const;
+
+  /// @brief solve the equations of the coarsest level
+  void coarseSolve() const;
+
+  /// @brief the print level of BoomerAMG
+  int print_level_;
+
+  /// @brief the displacement space of an elasticity problem, if any
+  mfem::ParFiniteElementSpace* elasticity_space_ = nullptr;
+
+  /// @brief a duplicate of the communicator of the operator, for the products of the single precision levels
+  MPI_Comm comm_ = MPI_COMM_NULL;
+
+  /// @brief the operator of the finest level
+  const mfem::HypreParMatrix* fine_operator_ = nullptr;
+
+  /// @brief the (double precision) l1 hybrid Gauss-Seidel smoother of the finest level
+  mfem::HypreSmoother fine_smoother_;
+
+  /// @brief the residual of the finest level in a cycle
+  mutable mfem::Vector fine_residual_;
+
+  /// @brief the operators of each level, from the finest (null, as the operator itself is used) to the coarsest
+  std::vector<std::unique_ptr<SinglePrecisionParCSR>> operators_;
+
+  /// @brief the interpolations from each level to the next finer one
+  std::vector<std::unique_ptr<SinglePrecisionParCSR>> interpolations_;
+
+  /// @brief the l1 diagonals of the smoothers of each level (empty on the finest level)
+  std::vector<std::vector<float>> diagonals_;
+
+  /// @brief the right hand side, solution and residual of each level in a cycle
+  mutable std::vector<std::vector<float>> rhs_, solution_, residual_;
+
+  /// @brief the inverse of the (gathered) coarsest operator, if it is solved directly
+  std::unique_ptr<mfem::DenseMatrixInverse> coarse_inverse_;
+
+  /// @brief the gathered coarsest operator
+  mfem::DenseMatrix coarse_matrix_;
+
+  /// @brief the number of rows of the coarsest level on each rank, and their offsets
+  std::vector<int> coarse_counts_, coarse_offsets_;
+
+  /// @brief records the size of the hierarchy for `serac::memoryReport()`
+  TrackedAllocation memory_;
+};
+
+}  // namespace serac
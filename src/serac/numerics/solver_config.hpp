@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <limits>
 #include <variant>
 
 #include "mfem.hpp"
@@ -48,7 +49,7 @@ enum class TimestepMethod
   WBZAlpha,            /**< SecondOrderODE option */
   AverageAcceleration, /**< SecondOrderODE option */
   LinearAcceleration,  /**< SecondOrderODE option */
-  CentralDifference,   /**< SecondOrderODE option */
+  CentralDifference,   /**< SecondOrderODE option, integrated explicitly with a lumped mass matrix in SolidMechanics */
   FoxGoodwin           /**< SecondOrderODE option */
 };
 
@@ -87,6 +88,40 @@ enum class DirichletEnforcementMethod
   FullControl
 };
 
+/// Parameters for choosing the timestep size automatically, based on an estimate of the local truncation error
+struct AdaptiveTimesteppingOptions {
+  /// Whether or not the timestep size should be adapted
+  bool enabled = false;
+
+  /// Relative tolerance on the estimated local error
+  double relative_tol = 1.0e-3;
+
+  /// Absolute tolerance on the estimated local error
+  double absolute_tol = 1.0e-6;
+
+  /// Factor (less than 1) applied to the step size that the error estimate predicts would be optimal
+  double safety_factor = 0.9;
+
+  /// Largest factor by which the step size can shrink after a rejected step
+  double min_scale = 0.2;
+
+  /// Largest factor by which the step size can grow after an accepted step
+  double max_scale = 2.0;
+
+  /// Smallest allowable step size
+  double min_dt = 1.0e-12;
+
+  /// Largest allowable step size
+  double max_dt = std::numeric_limits<double>::max();
+
+  /// Maximum number of times a single step can be rejected before giving up
+  int max_rejections = 10;
+
+  /// For quasi-static problems, the largest number of Newton iterations for which a converged step is considered
+  /// easy enough that the size of the following step may grow
+  int easy_newton_iterations = 3;
+};
+
 /// A timestep and boundary condition enforcement method for a dynamic solver
 struct TimesteppingOptions {
   /// The timestepping method to be applied
@@ -94,6 +129,52 @@ struct TimesteppingOptions {
 
   /// The essential boundary enforcement method to use
   DirichletEnforcementMethod enforcement_method = DirichletEnforcementMethod::RateControl;
+
+  /// Parameters for adaptive timestep size control
+  AdaptiveTimesteppingOptions adaptive = {};
+
+  /**
+   * The number of cycles between checkpoints of the states and reports of the memory usage, for explicit
+   * (central difference) dynamics. Implicit methods checkpoint every cycle, as the transient adjoint requires it.
+   */
+  int output_interval = 1;
+};
+
+/**
+ * @brief How the physics modules of a staggered (operator-split) multiphysics solver are coupled in each timestep
+ *
+ * The iterated schemes repeat the staggered solves until the coupled solution is a fixed point of one pass through
+ * them. Aitken relaxation and Anderson acceleration are described in Küttler and Wall, "Fixed-point fluid-structure
+ * interaction solvers with dynamic relaxation" (Comput. Mech., 2008), and Walker and Ni, "Anderson acceleration for
+ * fixed-point iterations" (SIAM J. Numer. Anal., 2011).
+ */
+enum class CouplingScheme
+{
+  OneWay,     /**< A single pass through the physics modules per timestep */
+  FixedPoint, /**< Repeat the passes through the physics modules until they converge */
+  Aitken,     /**< FixedPoint, with Aitken's dynamic relaxation of each pass */
+  Anderson    /**< FixedPoint, with Anderson acceleration using the most recent passes */
+};
+
+/// Options for coupling the physics modules of a staggered multiphysics solver
+struct CouplingOptions {
+  /// The coupling scheme
+  CouplingScheme scheme = CouplingScheme::OneWay;
+
+  /// Relative tolerance on the change of each field over a pass through the physics modules
+  double relative_tol = 1.0e-6;
+
+  /// Absolute tolerance on the change of each field over a pass through the physics modules
+  double absolute_tol = 1.0e-10;
+
+  /// Maximum number of passes through the physics modules per timestep
+  int max_iterations = 20;
+
+  /// The number of previous passes used by Anderson acceleration
+  int anderson_depth = 5;
+
+  /// Whether the nonlinear solvers of the physics modules reuse their Jacobians after the first pass of a timestep
+  bool reuse_jacobians = true;
 };
 
 // _linear_solvers_start
@@ -102,6 +183,7 @@ enum class LinearSolver
 {
   CG,       /**< Conjugate gradient */
   GMRES,    /**< Generalized minimal residual method */
+  FGMRES,   /**< Flexible GMRES, for preconditioners that vary between applications */
   SuperLU,  /**< SuperLU MPI-enabled direct nodal solver */
   Strumpack /**< Strumpack MPI-enabled direct frontal solver*/
 };
@@ -125,6 +207,20 @@ enum class NonlinearSolver
 };
 // _nonlinear_solvers_end
 
+/**
+ * @brief How the relative tolerance of the linear solves in a Newton-type method is chosen
+ *
+ * The adaptive choices are those of Eisenstat and Walker, "Choosing the forcing terms in an inexact Newton method"
+ * (SIAM J. Sci. Comput., 1996). They solve the linear systems loosely while far from the solution, and more
+ * accurately as the nonlinear residual decreases.
+ */
+enum class ForcingTerm
+{
+  Fixed,            /**< Always use LinearSolverOptions::relative_tol */
+  EisenstatWalker1, /**< How well the linear model predicted the most recent nonlinear residual (choice 1) */
+  EisenstatWalker2  /**< The rate of decrease of the nonlinear residual (choice 2) */
+};
+
 /**
  * @brief Solver types supported by AMGX
  */
@@ -173,6 +269,9 @@ enum class Preconditioner
   HypreGaussSeidel, /**< Hypre-based Gauss-Seidel */
   HypreAMG,         /**< Hypre's BoomerAMG algebraic multi-grid */
   HypreILU,         /**< Hypre's Incomplete LU */
+  LOR,              /**< BoomerAMG on a low-order-refined sparsification of a high-order operator */
+  PMultigrid,       /**< p-multigrid with Chebyshev smoothing, and BoomerAMG on the p = 1 level */
+  BlockSchur,       /**< BoomerAMG and an approximate Schur complement, for Lagrange multiplier contact */
   AMGX,             /**< NVIDIA's AMGX GPU-enabled algebraic multi-grid, GPU builds only */
   None              /**< No preconditioner used */
 };
@@ -201,6 +300,27 @@ struct LinearSolverOptions {
 
   /// Debugging print level for the preconditioner
   int preconditioner_print_level = 0;
+
+  /**
+   * Number of matrices a direct solver (SuperLU or Strumpack) may solve with an earlier factorization before
+   * refactoring, as the preconditioner of an iterative refinement to relative_tol and absolute_tol
+   */
+  int max_factorization_reuse = 0;
+
+  /**
+   * Whether the coarse levels of the preconditioner (only HypreAMG) are stored and applied in single precision,
+   * inside of the double precision Krylov solve. This is best used with FGMRES.
+   */
+  bool mixed_precision = false;
+
+  /// Whether an iterative solver keeps its preconditioner for later Jacobians (and timesteps), until it becomes stale
+  bool reuse_preconditioner = false;
+
+  /**
+   * With reuse_preconditioner, the preconditioner becomes stale (and is rebuilt for the next Jacobian) once a linear
+   * solve fails, or takes more than this many times the iterations of the first solve with it
+   */
+  double max_iteration_growth = 2.0;
 };
 // _linear_options_end
 
@@ -225,6 +345,31 @@ struct NonlinearSolverOptions {
   /// Maximum line search cutbacks
   int max_line_search_iterations = 0;
 
+  /// How the relative tolerance of each linear solve is chosen (only used by Newton, NewtonLineSearch and TrustRegion)
+  ForcingTerm forcing_term = ForcingTerm::Fixed;
+
+  /// The relative tolerance of the first linear solve, for the adaptive forcing terms
+  double initial_forcing_term = 0.5;
+
+  /// The largest relative tolerance of a linear solve, for the adaptive forcing terms
+  double max_forcing_term = 0.9;
+
+  /// The factor gamma in the EisenstatWalker2 forcing term, gamma * (||r_k|| / ||r_{k-1}||)^alpha
+  double forcing_term_gamma = 0.9;
+
+  /// The exponent alpha in the EisenstatWalker2 forcing term, gamma * (||r_k|| / ||r_{k-1}||)^alpha
+  double forcing_term_alpha = 2.0;
+
+  /// Whether TrustRegion applies the Jacobian matrix-free, and only assembles it to update its preconditioner
+  bool matrix_free_hessian = false;
+
+  /// The minimum number of iterations between updates of the TrustRegion preconditioner, when matrix_free_hessian
+  int preconditioner_update_interval = 1;
+
+  /// A Jacobian reused by Newton and NewtonLineSearch is reassembled once an iteration doesn't reduce the residual
+  /// norm by this factor (see EquationSolver::reuseJacobian())
+  double jacobian_reuse_reduction = 0.5;
+
   /// Debug print level
   int print_level = 0;
 };
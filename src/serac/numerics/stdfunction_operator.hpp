@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 
 #include "mfem.hpp"
@@ -30,6 +31,25 @@ namespace serac::mfem_ext {
  */
 class StdFunctionOperator : public mfem::Operator {
 public:
+  /// @brief forms the gradient of the operator from a linearization computed by a previous evaluation
+  using Linearization = std::function<mfem::Operator&()>;
+
+  /**
+   * @brief the two forms of the gradient of the operator from a linearization computed by a previous evaluation:
+   * the assembled gradient (e.g. for preconditioners and direct solvers), and an unassembled operator that
+   * only implements its action (e.g. a Jacobian-vector product)
+   */
+  struct Linearizations {
+    Linearization assembled;    ///< forms the assembled gradient
+    Linearization matrix_free;  ///< forms the unassembled gradient
+  };
+
+  /// @brief the type of the tag that selects the constructor whose mult method also linearizes the operator
+  struct LinearizeOnMult {};
+
+  /// @brief selects the constructor whose mult method also linearizes the operator
+  static constexpr LinearizeOnMult linearize_on_mult{};
+
   /**
    * @brief Default constructor for creating a square uninitialized StdFunctionOperator
    *
@@ -97,13 +117,69 @@ public:
   {
   }
 
+  /**
+   * @brief Constructor for a square StdFunctionOperator that can evaluate and linearize the operator in a single call
+   *
+   * This is for operators like serac::Functional, where computing the derivatives alongside the value is much
+   * cheaper than computing them separately, as each requires a pass over every element. Mult only evaluates the
+   * operator, unless linearizeNextMult was called before it: then it also linearizes the operator at its input,
+   * and GetGradient at that same input only forms the gradient from that linearization. Nonlinear solvers request
+   * the linearization at the points they expect to accept (e.g. a full Newton step), so that those need a single
+   * evaluation instead of two, while trial points that may be rejected (e.g. in a line search) are only evaluated.
+   *
+   * @param[in] n The size of the operator
+   * @param[in] function The function that only evaluates the operator (typically the residual)
+   * @param[in] evaluate_and_linearize The function that evaluates the operator at its first argument, and returns
+   * a Linearization that forms the gradient (typically the residual jacobian) at that point
+   */
+  StdFunctionOperator(int n, LinearizeOnMult, std::function<void(const mfem::Vector&, mfem::Vector&)> function,
+                      std::function<Linearization(const mfem::Vector&, mfem::Vector&)> evaluate_and_linearize)
+      : mfem::Operator(n),
+        function_(function),
+        evaluate_and_linearize_([evaluate_and_linearize](const mfem::Vector& k, mfem::Vector& y) {
+          return Linearizations{evaluate_and_linearize(k, y), nullptr};
+        })
+  {
+  }
+
+  /**
+   * @brief Constructor for a square StdFunctionOperator that can evaluate and linearize the operator in a single call,
+   * and whose gradient can also be applied without assembling it (see GetMatrixFreeGradient)
+   *
+   * @param[in] n The size of the operator
+   * @param[in] function The function that only evaluates the operator (typically the residual)
+   * @param[in] evaluate_and_linearize The function that evaluates the operator at its first argument, and returns
+   * the Linearizations that form the assembled and unassembled gradients at that point
+   */
+  StdFunctionOperator(int n, LinearizeOnMult, std::function<void(const mfem::Vector&, mfem::Vector&)> function,
+                      std::function<Linearizations(const mfem::Vector&, mfem::Vector&)> evaluate_and_linearize)
+      : mfem::Operator(n), function_(function), evaluate_and_linearize_(evaluate_and_linearize)
+  {
+  }
+
   /**
    * @brief The underlying mult (e.g. residual evaluation) method
    *
    * @param[in] k state input vector
    * @param[out] y output residual vector
    */
-  void Mult(const mfem::Vector& k, mfem::Vector& y) const { function_(k, y); };
+  void Mult(const mfem::Vector& k, mfem::Vector& y) const
+  {
+    if (evaluate_and_linearize_ && linearize_next_mult_) {
+      linearize_next_mult_ = false;
+      linearization_       = evaluate_and_linearize_(k, y);
+      linearization_point_ = k;
+    } else {
+      function_(k, y);
+    }
+  };
+
+  /**
+   * @brief Make the next Mult also linearize the operator at its input, if the operator supports that
+   *
+   * Nonlinear solvers call this before evaluating the operator at a point where they expect to need its gradient.
+   */
+  void linearizeNextMult() const { linearize_next_mult_ = true; }
 
   /**
    * @brief The underlying GetGradient (e.g. residual jacobian evaluation) method
@@ -111,9 +187,65 @@ public:
    * @param[in] k The current state input vector
    * @return A non-owning reference to the gradient operator
    */
-  mfem::Operator& GetGradient(const mfem::Vector& k) const { return jacobian_(k); };
+  mfem::Operator& GetGradient(const mfem::Vector& k) const
+  {
+    if (evaluate_and_linearize_) {
+      linearizeAt(k);
+      return linearization_.assembled();
+    }
+    return jacobian_(k);
+  };
+
+  /**
+   * @brief The gradient at @a k as an unassembled operator, which only implements its action
+   *
+   * This is cheaper than GetGradient for solvers that only need Jacobian-vector products.
+   *
+   * @param[in] k The current state input vector
+   * @return A non-owning pointer to the unassembled gradient, which is invalidated by the next Mult that
+   * linearizes the operator, or nullptr if the operator doesn't provide one
+   */
+  mfem::Operator* GetMatrixFreeGradient(const mfem::Vector& k) const
+  {
+    if (!evaluate_and_linearize_) {
+      return nullptr;
+    }
+
+    linearizeAt(k);
+    return linearization_.matrix_free ? &linearization_.matrix_free() : nullptr;
+  }
+
+  /**
+   * @brief Discard the most recent linearization, so that the next GetGradient evaluates the operator again
+   *
+   * @note This must be called if anything other than the input vector that the operator depends on
+   * (e.g. the time, or a parameter field) changes between a Mult and a GetGradient at the same input
+   */
+  void resetLinearization() const { linearization_ = Linearizations{}; }
 
 private:
+  /// @brief whether the most recent linearization was computed at @a k
+  bool isLinearizedAt(const mfem::Vector& k) const
+  {
+    if (!linearization_.assembled || linearization_point_.Size() != k.Size()) {
+      return false;
+    }
+
+    const double* point = linearization_point_.HostRead();
+    const double* input = k.HostRead();
+    return std::equal(input, input + k.Size(), point);
+  }
+
+  /// @brief evaluates and linearizes the operator at @a k, unless it is already linearized there
+  void linearizeAt(const mfem::Vector& k) const
+  {
+    if (!isLinearizedAt(k)) {
+      mfem::Vector y(height);
+      linearizeNextMult();
+      Mult(k, y);
+    }
+  }
+
   /**
    * @brief the function that is used to implement mfem::Operator::Mult
    */
@@ -123,6 +255,20 @@ private:
    * @brief the function that is used to implement mfem::Operator::GetGradient
    */
   std::function<mfem::Operator&(const mfem::Vector&)> jacobian_;
+
+  /**
+   * @brief the function that is used to implement mfem::Operator::Mult, when it also linearizes the operator
+   */
+  std::function<Linearizations(const mfem::Vector&, mfem::Vector&)> evaluate_and_linearize_;
+
+  /// @brief form the gradient at `linearization_point_` (empty if there is no valid linearization)
+  mutable Linearizations linearization_;
+
+  /// @brief the input of the most recent Mult that linearized the operator
+  mutable mfem::Vector linearization_point_;
+
+  /// @brief whether the next Mult also linearizes the operator
+  mutable bool linearize_next_mult_ = false;
 };
 
 }  // namespace serac::mfem_ext
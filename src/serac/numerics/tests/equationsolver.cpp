@@ -7,11 +7,13 @@
 #include <array>
 #include <fstream>
 #include <functional>
+#include <utility>
 
 #include <gtest/gtest.h>
 #include "mfem.hpp"
 
 #include "serac/numerics/equation_solver.hpp"
+#include "serac/numerics/single_precision_amg.hpp"
 #include "serac/numerics/stdfunction_operator.hpp"
 #include "serac/numerics/functional/functional.hpp"
 
@@ -131,6 +133,1142 @@ INSTANTIATE_TEST_SUITE_P(AllEquationSolverTests, EquationSolverSuite,
                                                           Preconditioner::HypreILU)));
 #endif
 
+class ForcingTermSuite : public testing::TestWithParam<std::tuple<NonlinearSolver, ForcingTerm>> {};
+
+TEST_P(ForcingTermSuite, InexactNewtonConverges)
+{
+  // note: these aren't structured bindings, as they are captured by the lambda below
+  NonlinearSolver nonlin_solver = std::get<0>(GetParam());
+  ForcingTerm     forcing_term  = std::get<1>(GetParam());
+
+  auto mesh  = mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+  Functional<H1<p>(H1<p>)> residual(&fes, {&fes});
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto, auto scalar) {
+        auto [u, du_dx] = scalar;
+        return serac::tuple{u * u * u + u - 1.0, du_dx};
+      },
+      pmesh);
+
+  std::unique_ptr<mfem::HypreParMatrix> J;
+  StdFunctionOperator                   residual_opr(
+      fes.TrueVSize(),
+      [&residual](const mfem::Vector& x, mfem::Vector& r) {
+        const mfem::Vector res = residual(0.0, x);
+        r                      = res;
+      },
+      [&residual, &J](const mfem::Vector& x) -> mfem::Operator& {
+        auto [val, grad] = residual(0.0, differentiate_wrt(x));
+        J                = assemble(grad);
+        return *J;
+      });
+
+  const LinearSolverOptions lin_opts = {.linear_solver  = LinearSolver::CG,
+                                        .preconditioner = Preconditioner::HypreJacobi,
+                                        .relative_tol   = 1.0e-10,
+                                        .absolute_tol   = 1.0e-14,
+                                        .max_iterations = 500};
+
+  auto solve = [&](ForcingTerm forcing) {
+    const NonlinearSolverOptions nonlin_opts = {.nonlin_solver  = nonlin_solver,
+                                                .relative_tol   = 1.0e-10,
+                                                .absolute_tol   = 1.0e-12,
+                                                .max_iterations = 50,
+                                                .forcing_term   = forcing};
+
+    EquationSolver eq_solver(nonlin_opts, lin_opts);
+    eq_solver.setOperator(residual_opr);
+
+    mfem::Vector x(fes.TrueVSize());
+    x = 0.0;
+    eq_solver.solve(x);
+
+    EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+    return std::pair{x, eq_solver.statistics().linear_iterations};
+  };
+
+  auto [baseline, fixed_iterations]   = solve(ForcingTerm::Fixed);
+  auto [solution, inexact_iterations] = solve(forcing_term);
+
+  // the loose tolerances of the early linear solves don't change the solution ...
+  solution -= baseline;
+  EXPECT_LT(mfem::ParNormlp(solution, 2, MPI_COMM_WORLD), 1.0e-7 * mfem::ParNormlp(baseline, 2, MPI_COMM_WORLD));
+
+  // ... and take fewer linear iterations than the fixed tolerance of the linear solver (which the trust region
+  // method doesn't use, its subproblems are always solved to a loose tolerance)
+  if (nonlin_solver != NonlinearSolver::TrustRegion) {
+    EXPECT_LT(inexact_iterations, fixed_iterations);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(InexactNewton, ForcingTermSuite,
+                         testing::Combine(testing::Values(NonlinearSolver::Newton, NonlinearSolver::NewtonLineSearch,
+                                                          NonlinearSolver::TrustRegion),
+                                          testing::Values(ForcingTerm::EisenstatWalker1,
+                                                          ForcingTerm::EisenstatWalker2)));
+
+TEST(TrustRegion, MatrixFreeHessian)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+  Functional<H1<p>(H1<p>)> residual(&fes, {&fes});
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto, auto scalar) {
+        auto [u, du_dx] = scalar;
+        return serac::tuple{u * u * u + u - 1.0, du_dx};
+      },
+      pmesh);
+
+  // evaluations of the residual only, and evaluations that also linearize it
+  int evaluations             = 0;
+  int linearizing_evaluations = 0;
+
+  std::unique_ptr<mfem::HypreParMatrix> J;
+  StdFunctionOperator                   residual_opr(
+      fes.TrueVSize(), StdFunctionOperator::linearize_on_mult,
+      [&residual, &evaluations](const mfem::Vector& x, mfem::Vector& r) {
+        evaluations++;
+        r = residual(0.0, x);
+      },
+      [&residual, &J, &linearizing_evaluations](const mfem::Vector& x,
+                                                mfem::Vector& r) -> StdFunctionOperator::Linearizations {
+        linearizing_evaluations++;
+        auto evaluation = residual(0.0, differentiate_wrt(x));
+        r               = serac::get<0>(evaluation);
+
+        auto* drdx = &serac::get<1>(evaluation);
+        return {[&J, drdx]() -> mfem::Operator& {
+                  J = assemble(*drdx);
+                  return *J;
+                },
+                [drdx]() -> mfem::Operator& { return *drdx; }};
+      });
+
+  const LinearSolverOptions lin_opts = {.linear_solver  = LinearSolver::CG,
+                                        .preconditioner = Preconditioner::HypreJacobi,
+                                        .relative_tol   = 1.0e-10,
+                                        .absolute_tol   = 1.0e-14,
+                                        .max_iterations = 500};
+
+  auto solve = [&](bool matrix_free) {
+    const NonlinearSolverOptions nonlin_opts = {.nonlin_solver                  = NonlinearSolver::TrustRegion,
+                                                .relative_tol                   = 1.0e-10,
+                                                .absolute_tol                   = 1.0e-12,
+                                                .max_iterations                 = 50,
+                                                .matrix_free_hessian            = matrix_free,
+                                                .preconditioner_update_interval = 3};
+
+    EquationSolver eq_solver(nonlin_opts, lin_opts);
+    eq_solver.setOperator(residual_opr);
+
+    mfem::Vector x(fes.TrueVSize());
+    x = 0.0;
+    eq_solver.solve(x);
+
+    EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+    return eq_solver.statistics();
+  };
+
+  auto assembled   = solve(false);
+  auto matrix_free = solve(true);
+
+  // the jacobian is only assembled when the preconditioner is updated
+  EXPECT_GT(matrix_free.nonlinear_iterations, 1);
+  EXPECT_LT(matrix_free.jacobian_evaluations, matrix_free.nonlinear_iterations);
+  EXPECT_EQ(assembled.jacobian_evaluations, assembled.nonlinear_iterations);
+
+  // the residual is only linearized at the points that were accepted (once per iteration), while the trial
+  // points (one or more per iteration) are only evaluated
+  EXPECT_EQ(linearizing_evaluations, assembled.nonlinear_iterations + matrix_free.nonlinear_iterations);
+  EXPECT_GE(evaluations, assembled.nonlinear_iterations + matrix_free.nonlinear_iterations);
+}
+
+TEST(DirectSolver, ReusesFactorization)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  auto                        fec = mfem::H1_FECollection(1, 2);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+  // two matrices with the same sparsity pattern, but different values
+  auto assemble_matrix = [&fes](double mass) {
+    mfem::ConstantCoefficient coefficient(mass);
+    mfem::ParBilinearForm     form(&fes);
+    form.AddDomainIntegrator(new mfem::DiffusionIntegrator);
+    form.AddDomainIntegrator(new mfem::MassIntegrator(coefficient));
+    form.Assemble();
+    form.Finalize();
+    return std::unique_ptr<mfem::HypreParMatrix>(form.ParallelAssemble());
+  };
+  auto A = assemble_matrix(1.0);
+  auto B = assemble_matrix(1.05);
+
+  mfem::Vector b(fes.TrueVSize());
+  mfem::Vector x(fes.TrueVSize());
+  mfem::Vector r(fes.TrueVSize());
+  b.Randomize(0);
+
+  auto relative_residual = [&](const mfem::HypreParMatrix& matrix) {
+    matrix.Mult(x, r);
+    r -= b;
+    return mfem::ParNormlp(r, 2, MPI_COMM_WORLD) / mfem::ParNormlp(b, 2, MPI_COMM_WORLD);
+  };
+
+  // new values with the same pattern only need a numeric factorization
+  SuperLUSolver refactoring(0, MPI_COMM_WORLD);
+  refactoring.SetOperator(*A);
+  EXPECT_EQ(refactoring.factorizationOption(), mfem::superlu::DOFACT);
+  refactoring.SetOperator(*B);
+  EXPECT_EQ(refactoring.factorizationOption(), mfem::superlu::SamePattern);
+  refactoring.Mult(b, x);
+  EXPECT_EQ(refactoring.numFactorizations(), 2);
+  EXPECT_EQ(refactoring.numSymbolicFactorizations(), 1);
+  EXPECT_LT(relative_residual(*B), 1.0e-9);
+
+  // ... or none at all, if the factorization of A is a good enough preconditioner for B
+  SuperLUSolver reusing(0, MPI_COMM_WORLD, 1, 1.0e-10, 1.0e-14);
+  reusing.SetOperator(*A);
+  reusing.SetOperator(*B);
+  reusing.Mult(b, x);
+  EXPECT_EQ(reusing.numFactorizations(), 1);
+  EXPECT_LT(relative_residual(*B), 1.0e-9);
+
+  // the factorization can only be reused for a limited number of matrices
+  reusing.SetOperator(*A);
+  reusing.Mult(b, x);
+  EXPECT_EQ(reusing.numFactorizations(), 2);
+  EXPECT_EQ(reusing.numSymbolicFactorizations(), 1);
+  EXPECT_LT(relative_residual(*A), 1.0e-9);
+}
+
+TEST(DirectSolver, DetectsChangedSparsityPattern)
+{
+  // two matrices with the same numbers of rows and nonzeros, but different sparsity patterns:
+  // the first couples each row to the next, the second couples row 0 to row 2 instead of row 1
+  constexpr int n = 10;
+
+  auto make_matrix = [](bool skip_first) {
+    auto matrix = std::make_unique<mfem::SparseMatrix>(n, n);
+    for (int i = 0; i < n; i++) {
+      matrix->Add(i, i, 4.0);
+    }
+    for (int i = 0; i + 1 < n; i++) {
+      int j = (skip_first && i == 0) ? 2 : i + 1;
+      matrix->Add(i, j, -1.0);
+      matrix->Add(j, i, -1.0);
+    }
+    matrix->Finalize();
+    return matrix;
+  };
+  auto A = make_matrix(false);
+  auto B = make_matrix(true);
+  ASSERT_EQ(A->NumNonZeroElems(), B->NumNonZeroElems());
+
+  HYPRE_BigInt         row_starts[2] = {0, n};
+  mfem::HypreParMatrix hypre_A(MPI_COMM_WORLD, n, row_starts, A.get());
+  mfem::HypreParMatrix hypre_B(MPI_COMM_WORLD, n, row_starts, B.get());
+
+  mfem::Vector b(n);
+  mfem::Vector x(n);
+  mfem::Vector r(n);
+  b.Randomize(0);
+
+  SuperLUSolver solver(0, MPI_COMM_WORLD);
+  solver.SetOperator(hypre_A);
+  solver.SetOperator(hypre_B);
+  EXPECT_EQ(solver.numSymbolicFactorizations(), 2);
+  EXPECT_EQ(solver.factorizationOption(), mfem::superlu::DOFACT);
+
+  solver.Mult(b, x);
+  hypre_B.Mult(x, r);
+  r -= b;
+  EXPECT_LT(r.Norml2() / b.Norml2(), 1.0e-12);
+}
+
+TEST(RigidBodyModes, NullspaceOfElasticity)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian3D(3, 3, 3, mfem::Element::HEXAHEDRON);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p   = 2;
+  constexpr int dim = 3;
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec, dim, mfem::Ordering::byNODES);
+
+  mfem::ConstantCoefficient lambda(1.0);
+  mfem::ConstantCoefficient mu(1.0);
+  mfem::ParBilinearForm     K_form(&fes);
+  K_form.AddDomainIntegrator(new mfem::ElasticityIntegrator(lambda, mu));
+  K_form.Assemble();
+  K_form.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> K(K_form.ParallelAssemble());
+
+  auto modes = rigidBodyModes(fes);
+  ASSERT_EQ(modes.size(), std::size_t(6));
+
+  // rigid body motions produce no strain, so they don't generate any elastic forces
+  mfem::Vector force(fes.TrueVSize());
+  for (auto& mode : modes) {
+    K->Mult(*mode, force);
+    EXPECT_LT(mfem::ParNormlp(force, 2, MPI_COMM_WORLD), 1.0e-12 * mfem::ParNormlp(*mode, 2, MPI_COMM_WORLD));
+  }
+
+  // BoomerAMG with the rotations as its near-nullspace
+  mfem::Array<int> ess_tdofs;
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr    = 0;
+  ess_bdr[0] = 1;
+  fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+  std::unique_ptr<mfem::HypreParMatrix> K_e(K->EliminateRowsCols(ess_tdofs));
+
+  BoomerAMG amg;
+  amg.SetPrintLevel(0);
+  amg.setElasticityNearNullspace(fes);
+
+  mfem::Vector rhs(fes.TrueVSize());
+  mfem::Vector u(fes.TrueVSize());
+  rhs.Randomize(0);
+  rhs.SetSubVector(ess_tdofs, 0.0);
+  u = 0.0;
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1.0e-8);
+  cg.SetMaxIter(200);
+  cg.SetPreconditioner(amg);
+  cg.SetOperator(*K);
+  cg.Mult(rhs, u);
+  EXPECT_TRUE(cg.GetConverged());
+
+  // the options survive a change of operator
+  cg.SetOperator(*K);
+  u = 0.0;
+  cg.Mult(rhs, u);
+  EXPECT_TRUE(cg.GetConverged());
+  const int iterations = cg.GetNumIterations();
+
+  // in iterative mode, the (permuted) initial guess is kept, so the solution is a fixed point of the V-cycle
+  mfem::Vector solution(fes.TrueVSize());
+  mfem::Vector b(fes.TrueVSize());
+  solution.Randomize(1);
+  solution.SetSubVector(ess_tdofs, 0.0);
+  K->Mult(solution, b);
+  mfem::Vector x(solution);
+  amg.iterative_mode = true;
+  amg.Mult(b, x);
+  amg.iterative_mode = false;
+  x -= solution;
+  EXPECT_LT(mfem::ParNormlp(x, 2, MPI_COMM_WORLD), 1.0e-10 * mfem::ParNormlp(solution, 2, MPI_COMM_WORLD));
+
+  // nodal coarsening and the rotations make a better preconditioner than unknown-based systems AMG
+  mfem::HypreBoomerAMG systems_amg;
+  systems_amg.SetPrintLevel(0);
+  systems_amg.SetOperator(*K);
+  systems_amg.SetSystemsOptions(dim, true);
+
+  mfem::CGSolver systems_cg(MPI_COMM_WORLD);
+  systems_cg.SetRelTol(1.0e-8);
+  systems_cg.SetMaxIter(200);
+  systems_cg.SetOperator(*K);
+  systems_cg.SetPreconditioner(systems_amg);
+  u = 0.0;
+  systems_cg.Mult(rhs, u);
+  EXPECT_TRUE(systems_cg.GetConverged());
+  EXPECT_LT(iterations, systems_cg.GetNumIterations());
+}
+
+TEST(LORPreconditioner, HighOrderElasticity)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian3D(3, 3, 3, mfem::Element::HEXAHEDRON);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p   = 3;
+  constexpr int dim = 3;
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec, dim, mfem::Ordering::byNODES);
+
+  mfem::Array<int> ess_tdofs;
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr    = 0;
+  ess_bdr[0] = 1;
+  fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+
+  // a stiffer material than the unit model of the preconditioner
+  mfem::ConstantCoefficient lambda(20.0);
+  mfem::ConstantCoefficient mu(5.0);
+  mfem::ParBilinearForm     K_form(&fes);
+  K_form.AddDomainIntegrator(new mfem::ElasticityIntegrator(lambda, mu));
+  K_form.Assemble();
+  K_form.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> K(K_form.ParallelAssemble());
+  std::unique_ptr<mfem::HypreParMatrix> K_e(K->EliminateRowsCols(ess_tdofs));
+
+  LORPreconditioner lor;
+  lor.setSpace(fes, [&ess_tdofs]() -> const mfem::Array<int>& { return ess_tdofs; });
+
+  // the operator doesn't have to be a HypreParMatrix
+  mfem::ConstrainedOperator K_action(K.get(), ess_tdofs);
+  lor.SetOperator(K_action);
+
+  // the low-order operator is much sparser than the high-order one
+  EXPECT_LT(lor.lowOrderOperator().NNZ(), K->NNZ() / 2);
+
+  mfem::Vector rhs(fes.TrueVSize());
+  mfem::Vector u(fes.TrueVSize());
+  rhs.Randomize(0);
+  rhs.SetSubVector(ess_tdofs, 0.0);
+  u = 0.0;
+
+  mfem::GMRESSolver gmres(MPI_COMM_WORLD);
+  gmres.SetRelTol(1.0e-8);
+  gmres.SetMaxIter(200);
+  gmres.SetKDim(200);
+  gmres.SetPreconditioner(lor);
+  gmres.SetOperator(*K);
+  gmres.Mult(rhs, u);
+  EXPECT_TRUE(gmres.GetConverged());
+
+  // a new operator with the same essential dofs keeps the low-order operator
+  const mfem::HypreParMatrix* assembled = &lor.lowOrderOperator();
+  lor.SetOperator(*K);
+  EXPECT_EQ(&lor.lowOrderOperator(), assembled);
+
+  // given the element matrices, the model recovers the Lame parameters of the material
+  ElementMatrixSource element_matrices = [&fes, &lambda, &mu](const ElementMatrixVisitor& visit) {
+    mfem::ElasticityIntegrator integrator(lambda, mu);
+    mfem::Array<int>           vdofs;
+    mfem::DenseMatrix          matrix;
+    for (int e = 0; e < fes.GetNE(); e++) {
+      fes.GetElementVDofs(e, vdofs);
+      integrator.AssembleElementMatrix(*fes.GetFE(e), *fes.GetElementTransformation(e), matrix);
+      visit(vdofs, vdofs, matrix);
+    }
+  };
+
+  LORPreconditioner fitted;
+  fitted.setSpace(fes, [&ess_tdofs]() -> const mfem::Array<int>& { return ess_tdofs; }, element_matrices);
+  fitted.SetOperator(K_action);
+  for (int e = 0; e < pmesh.GetNE(); e++) {
+    EXPECT_NEAR(fitted.modelCoefficient(0)[e], 20.0, 1.0e-8);
+    EXPECT_NEAR(fitted.modelCoefficient(1)[e], 5.0, 1.0e-8);
+    EXPECT_NEAR(fitted.modelCoefficient(2)[e], 0.0, 1.0e-8);
+  }
+}
+
+TEST(LORPreconditioner, IterationsIndependentOfOrder)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian2D(6, 6, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int dim = 2;
+
+  // the number of CG iterations with the LOR preconditioner and with BoomerAMG on the high-order matrix
+  auto iterations = [&pmesh](int p, bool use_lor) {
+    auto                        fec = mfem::H1_FECollection(p, dim);
+    mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+    mfem::Array<int> ess_tdofs;
+    mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+    ess_bdr = 1;
+    fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+
+    mfem::ParBilinearForm form(&fes);
+    form.AddDomainIntegrator(new mfem::DiffusionIntegrator);
+    form.Assemble();
+    form.Finalize();
+    std::unique_ptr<mfem::HypreParMatrix> A(form.ParallelAssemble());
+    std::unique_ptr<mfem::HypreParMatrix> A_e(A->EliminateRowsCols(ess_tdofs));
+
+    std::unique_ptr<mfem::Solver> preconditioner;
+    if (use_lor) {
+      auto lor = std::make_unique<LORPreconditioner>();
+      lor->setSpace(fes, [&ess_tdofs]() -> const mfem::Array<int>& { return ess_tdofs; });
+      preconditioner = std::move(lor);
+    } else {
+      auto amg = std::make_unique<mfem::HypreBoomerAMG>();
+      amg->SetPrintLevel(0);
+      preconditioner = std::move(amg);
+    }
+
+    mfem::Vector rhs(fes.TrueVSize());
+    mfem::Vector u(fes.TrueVSize());
+    rhs.Randomize(0);
+    rhs.SetSubVector(ess_tdofs, 0.0);
+    u = 0.0;
+
+    mfem::CGSolver cg(MPI_COMM_WORLD);
+    cg.SetRelTol(1.0e-10);
+    cg.SetMaxIter(500);
+    cg.SetPreconditioner(*preconditioner);
+    cg.SetOperator(*A);
+    cg.Mult(rhs, u);
+    EXPECT_TRUE(cg.GetConverged());
+    return cg.GetNumIterations();
+  };
+
+  const int lor_low  = iterations(2, true);
+  const int lor_high = iterations(6, true);
+  const int amg_high = iterations(6, false);
+
+  // the LOR preconditioner is (nearly) independent of the order, unlike AMG on the high-order matrix
+  EXPECT_LE(lor_high, lor_low + lor_low / 2);
+  EXPECT_LT(lor_high, amg_high);
+}
+
+TEST(LORPreconditioner, HeterogeneousTransientDiffusion)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int    dim  = 2;
+  constexpr double mass = 10.0;
+
+  // a conductivity with a large jump, and the mass shift (density * specific heat / dt) of a transient Jacobian
+  auto                      conductivity = [](const mfem::Vector& X) { return (X[0] < 0.5) ? 1000.0 : 1.0; };
+  mfem::FunctionCoefficient conductivity_coefficient(conductivity);
+  mfem::ConstantCoefficient mass_coefficient(mass);
+
+  // the number of CG iterations with the LOR preconditioner, with or without the element matrices of the operator
+  auto iterations = [&](int p, bool fit) {
+    auto                        fec = mfem::H1_FECollection(p, dim);
+    mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+    mfem::Array<int> ess_tdofs;
+    mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+    ess_bdr    = 0;
+    ess_bdr[0] = 1;
+    fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+
+    mfem::ParBilinearForm form(&fes);
+    form.AddDomainIntegrator(new mfem::DiffusionIntegrator(conductivity_coefficient));
+    form.AddDomainIntegrator(new mfem::MassIntegrator(mass_coefficient));
+    form.Assemble();
+    form.Finalize();
+    std::unique_ptr<mfem::HypreParMatrix> A(form.ParallelAssemble());
+    std::unique_ptr<mfem::HypreParMatrix> A_e(A->EliminateRowsCols(ess_tdofs));
+
+    // one element matrix per integral, as the physics modules visit them
+    ElementMatrixSource element_matrices = [&](const ElementMatrixVisitor& visit) {
+      mfem::DiffusionIntegrator diffusion(conductivity_coefficient);
+      mfem::MassIntegrator      inertia(mass_coefficient);
+      mfem::Array<int>          dofs;
+      mfem::DenseMatrix         matrix;
+      for (int e = 0; e < fes.GetNE(); e++) {
+        fes.GetElementVDofs(e, dofs);
+        diffusion.AssembleElementMatrix(*fes.GetFE(e), *fes.GetElementTransformation(e), matrix);
+        visit(dofs, dofs, matrix);
+        inertia.AssembleElementMatrix(*fes.GetFE(e), *fes.GetElementTransformation(e), matrix);
+        visit(dofs, dofs, matrix);
+      }
+    };
+
+    LORPreconditioner lor;
+    lor.setSpace(
+        fes, [&ess_tdofs]() -> const mfem::Array<int>& { return ess_tdofs; },
+        fit ? element_matrices : ElementMatrixSource{});
+
+    mfem::ConstrainedOperator A_action(A.get(), ess_tdofs);
+    lor.SetOperator(A_action);
+
+    // the fitted model has the coefficients of the operator on each element
+    if (fit) {
+      for (int e = 0; e < pmesh.GetNE(); e++) {
+        mfem::Vector center;
+        pmesh.GetElementCenter(e, center);
+        EXPECT_NEAR(lor.modelCoefficient(0)[e], conductivity(center), 1.0e-8 * conductivity(center));
+        EXPECT_NEAR(lor.modelCoefficient(1)[e], mass, 1.0e-8 * mass);
+      }
+    }
+
+    mfem::Vector rhs(fes.TrueVSize());
+    mfem::Vector u(fes.TrueVSize());
+    rhs.Randomize(0);
+    rhs.SetSubVector(ess_tdofs, 0.0);
+    u = 0.0;
+
+    mfem::CGSolver cg(MPI_COMM_WORLD);
+    cg.SetRelTol(1.0e-10);
+    cg.SetMaxIter(1000);
+    cg.SetPreconditioner(lor);
+    cg.SetOperator(A_action);
+    cg.Mult(rhs, u);
+    EXPECT_TRUE(cg.GetConverged());
+    return cg.GetNumIterations();
+  };
+
+  const int fitted_low  = iterations(2, true);
+  const int fitted_high = iterations(5, true);
+  const int unit_high   = iterations(5, false);
+
+  // the fitted model stays (nearly) independent of the order, and the unit model doesn't see the jump
+  EXPECT_LE(fitted_high, fitted_low + fitted_low / 2);
+  EXPECT_LT(fitted_high, unit_high);
+}
+
+TEST(PMultigridPreconditioner, HighOrderDiffusionAndElasticity)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian3D(3, 3, 3, mfem::Element::HEXAHEDRON);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p   = 3;
+  constexpr int dim = 3;
+
+  auto fec = mfem::H1_FECollection(p, dim);
+
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr    = 0;
+  ess_bdr[0] = 1;
+
+  for (int components : {1, dim}) {
+    mfem::ParFiniteElementSpace fes(&pmesh, &fec, components, mfem::Ordering::byNODES);
+
+    mfem::ConstantCoefficient one(1.0);
+    auto                      make_integrator = [&one, components]() -> mfem::BilinearFormIntegrator* {
+      if (components == 1) {
+        return new mfem::DiffusionIntegrator(one);
+      }
+      return new mfem::ElasticityIntegrator(one, one);
+    };
+    std::unique_ptr<mfem::BilinearFormIntegrator> integrator(make_integrator());
+
+    // the element matrices, as the physics modules compute them from the q-function derivatives
+    ElementMatrixSource element_matrices = [&fes, &integrator](const ElementMatrixVisitor& visit) {
+      mfem::Array<int>  vdofs;
+      mfem::DenseMatrix matrix;
+      for (int e = 0; e < fes.GetNE(); e++) {
+        fes.GetElementVDofs(e, vdofs);
+        integrator->AssembleElementMatrix(*fes.GetFE(e), *fes.GetElementTransformation(e), matrix);
+        visit(vdofs, vdofs, matrix);
+      }
+    };
+
+    // the high-order operator is only assembled to check the preconditioner against
+    mfem::ParBilinearForm K_form(&fes);
+    K_form.AddDomainIntegrator(make_integrator());
+    K_form.Assemble();
+    K_form.Finalize();
+    std::unique_ptr<mfem::HypreParMatrix> K(K_form.ParallelAssemble());
+
+    // without essential dofs, the coarse operators are the Galerkin products of the high-order one
+    PMultigridPreconditioner galerkin;
+    galerkin.setSpace(fes, {}, element_matrices);
+    galerkin.SetOperator(*K);
+    ASSERT_EQ(galerkin.numLevels(), p);
+    for (int level = 0; level < p - 1; level++) {
+      mfem::Vector x(galerkin.levelOperator(level).Height());
+      x.Randomize(level + 1);
+
+      mfem::Vector fine(x);
+      for (int l = level; l < p - 1; l++) {
+        mfem::Vector finer(galerkin.prolongation(l).Height());
+        galerkin.prolongation(l).Mult(fine, finer);
+        fine.Swap(finer);
+      }
+
+      mfem::Vector expected(fine.Size());
+      K->Mult(fine, expected);
+      for (int l = p - 2; l >= level; l--) {
+        mfem::Vector coarser(galerkin.prolongation(l).Width());
+        galerkin.prolongation(l).MultTranspose(expected, coarser);
+        expected.Swap(coarser);
+      }
+
+      mfem::Vector y(x.Size());
+      galerkin.levelOperator(level).Mult(x, y);
+      y -= expected;
+      EXPECT_LT(mfem::ParNormlp(y, 2, MPI_COMM_WORLD), 1.0e-10 * mfem::ParNormlp(expected, 2, MPI_COMM_WORLD));
+    }
+
+    mfem::Array<int> ess_tdofs;
+    fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+
+    // the high-order operator is given to the preconditioner (and the solver) matrix-free
+    mfem::ConstrainedOperator K_action(K.get(), ess_tdofs);
+
+    PMultigridPreconditioner pmg;
+    pmg.setSpace(fes, [&ess_tdofs]() -> const mfem::Array<int>& { return ess_tdofs; }, element_matrices);
+    pmg.SetOperator(K_action);
+
+    // one level per order, where only the (much sparser) p = 1 operator is assembled
+    ASSERT_EQ(pmg.numLevels(), p);
+    for (int level = 0; level < p; level++) {
+      mfem::H1_FECollection       level_fec(level + 1, dim);
+      mfem::ParFiniteElementSpace level_fes(&pmesh, &level_fec, components, mfem::Ordering::byNODES);
+      EXPECT_EQ(pmg.levelOperator(level).Height(), level_fes.GetTrueVSize());
+    }
+    EXPECT_EQ(&pmg.levelOperator(p - 1), &K_action);
+    EXPECT_EQ(&pmg.levelOperator(0), &pmg.coarsestOperator());
+    EXPECT_LT(pmg.coarsestOperator().NNZ(), K->NNZ() / 4);
+
+    mfem::Vector rhs(fes.TrueVSize());
+    mfem::Vector u(fes.TrueVSize());
+    rhs.Randomize(0);
+    rhs.SetSubVector(ess_tdofs, 0.0);
+    u = 0.0;
+
+    mfem::CGSolver cg(MPI_COMM_WORLD);
+    cg.SetRelTol(1.0e-8);
+    cg.SetMaxIter(100);
+    cg.SetPreconditioner(pmg);
+    cg.SetOperator(K_action);
+    cg.Mult(rhs, u);
+    EXPECT_TRUE(cg.GetConverged());
+  }
+}
+
+TEST(BlockSchurPreconditioner, SaddlePoint)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParBilinearForm     K_form(&fes);
+  K_form.AddDomainIntegrator(new mfem::DiffusionIntegrator(one));
+  K_form.Assemble();
+  K_form.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> K(K_form.ParallelAssemble());
+
+  mfem::Array<int> ess_tdofs;
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr    = 0;
+  ess_bdr[0] = 1;
+  fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+  std::unique_ptr<mfem::HypreParMatrix> K_e(K->EliminateRowsCols(ess_tdofs));
+
+  // constraints tying pairs of neighboring (unconstrained) dofs together, and an inactive constraint
+  std::vector<bool> essential(std::size_t(fes.TrueVSize()), false);
+  for (int dof : ess_tdofs) {
+    essential[std::size_t(dof)] = true;
+  }
+
+  // the first dof of each tied pair: up to three on each rank, as far as its local dofs allow
+  std::vector<int> tied;
+  for (int dof = 0; dof + 1 < fes.TrueVSize() && tied.size() < 3; dof++) {
+    if (!essential[std::size_t(dof)] && !essential[std::size_t(dof + 1)]) {
+      tied.push_back(dof);
+      dof += 4;
+    }
+  }
+
+  const int          num_constraints = int(tied.size()) + 1;
+  mfem::SparseMatrix B_local(num_constraints, fes.TrueVSize());
+  mfem::SparseMatrix D_local(num_constraints);
+  for (int i = 0; i < num_constraints - 1; i++) {
+    B_local.Set(i, tied[std::size_t(i)], 1.0);
+    B_local.Set(i, tied[std::size_t(i)] + 1, -1.0);
+  }
+  D_local.Set(num_constraints - 1, num_constraints - 1, 1.0);
+  B_local.Finalize();
+  D_local.Finalize();
+
+  HYPRE_BigInt constraint_offset = 0;
+  HYPRE_BigInt local_constraints = num_constraints;
+  MPI_Exscan(&local_constraints, &constraint_offset, 1, HYPRE_MPI_BIG_INT, MPI_SUM, MPI_COMM_WORLD);
+  HYPRE_BigInt global_constraints = 0;
+  MPI_Allreduce(&local_constraints, &global_constraints, 1, HYPRE_MPI_BIG_INT, MPI_SUM, MPI_COMM_WORLD);
+  HYPRE_BigInt constraint_starts[2] = {constraint_offset, constraint_offset + local_constraints};
+
+  mfem::HypreParMatrix B(MPI_COMM_WORLD, global_constraints, fes.GlobalTrueVSize(), constraint_starts,
+                         fes.GetTrueDofOffsets(), &B_local);
+  mfem::HypreParMatrix D(MPI_COMM_WORLD, global_constraints, constraint_starts, &D_local);
+  std::unique_ptr<mfem::HypreParMatrix> B_transpose(B.Transpose());
+
+  mfem::Array<int> offsets({0, fes.TrueVSize(), fes.TrueVSize() + num_constraints});
+  mfem::BlockOperator J(offsets);
+  J.SetBlock(0, 0, K.get());
+  J.SetBlock(0, 1, B_transpose.get());
+  J.SetBlock(1, 0, &B);
+  J.SetBlock(1, 1, &D);
+
+  BlockSchurPreconditioner preconditioner;
+  preconditioner.SetOperator(J);
+  ASSERT_NE(preconditioner.schurComplement(), nullptr);
+
+  mfem::Vector rhs(J.Height());
+  mfem::Vector x(J.Height());
+  rhs.Randomize(0);
+  for (int i : ess_tdofs) {
+    rhs(i) = 0.0;
+  }
+  x = 0.0;
+
+  mfem::GMRESSolver gmres(MPI_COMM_WORLD);
+  gmres.SetRelTol(1.0e-10);
+  gmres.SetMaxIter(100);
+  gmres.SetKDim(100);
+  gmres.SetPreconditioner(preconditioner);
+  gmres.SetOperator(J);
+  gmres.Mult(rhs, x);
+  EXPECT_TRUE(gmres.GetConverged());
+
+  // the tied dofs satisfy their constraints
+  mfem::Vector x_u(x, 0, fes.TrueVSize());
+  mfem::Vector constraint(num_constraints);
+  B.Mult(x_u, constraint);
+  for (int i = 0; i < num_constraints - 1; i++) {
+    EXPECT_NEAR(constraint(i), rhs(fes.TrueVSize() + i), 1.0e-8);
+  }
+}
+
+TEST(SinglePrecisionAMG, ElasticityToDoublePrecisionTolerance)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian3D(6, 6, 6, mfem::Element::HEXAHEDRON);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p   = 1;
+  constexpr int dim = 3;
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec, dim, mfem::Ordering::byNODES);
+
+  mfem::ConstantCoefficient lambda(1.0);
+  mfem::ConstantCoefficient mu(1.0);
+  mfem::ParBilinearForm     K_form(&fes);
+  K_form.AddDomainIntegrator(new mfem::ElasticityIntegrator(lambda, mu));
+  K_form.Assemble();
+  K_form.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> K(K_form.ParallelAssemble());
+
+  mfem::Array<int> ess_tdofs;
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr    = 0;
+  ess_bdr[0] = 1;
+  fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+  std::unique_ptr<mfem::HypreParMatrix> K_e(K->EliminateRowsCols(ess_tdofs));
+
+  mfem::Vector rhs(fes.TrueVSize());
+  rhs.Randomize(0);
+  rhs.SetSubVector(ess_tdofs, 0.0);
+
+  // the reference: BoomerAMG in double precision
+  BoomerAMG amg;
+  amg.SetPrintLevel(0);
+  amg.setElasticityNearNullspace(fes);
+
+  mfem::Vector u(fes.TrueVSize());
+  u = 0.0;
+
+  mfem::FGMRESSolver fgmres(MPI_COMM_WORLD);
+  fgmres.SetRelTol(1.0e-10);
+  fgmres.SetMaxIter(200);
+  fgmres.SetKDim(200);
+  fgmres.SetPreconditioner(amg);
+  fgmres.SetOperator(*K);
+  fgmres.Mult(rhs, u);
+  EXPECT_TRUE(fgmres.GetConverged());
+  const int double_iterations = fgmres.GetNumIterations();
+
+  // a single precision preconditioner still solves the system to a tolerance below single precision
+  SinglePrecisionAMG single_amg;
+  single_amg.setElasticityNearNullspace(fes);
+
+  mfem::Vector u_single(fes.TrueVSize());
+  u_single = 0.0;
+
+  fgmres.SetPreconditioner(single_amg);
+  fgmres.SetOperator(*K);
+  fgmres.Mult(rhs, u_single);
+  EXPECT_TRUE(fgmres.GetConverged());
+  EXPECT_GT(single_amg.numLevels(), 1);
+  EXPECT_LE(fgmres.GetNumIterations(), 2 * double_iterations + 5);
+
+  // the single precision coarse levels take (about) two thirds of the memory of the double precision ones
+  EXPECT_GT(single_amg.hierarchyBytes(), 0u);
+  EXPECT_LT(single_amg.hierarchyBytes(), amg.hierarchyBytes() * 4 / 5);
+
+  u_single -= u;
+  EXPECT_LT(mfem::ParNormlp(u_single, 2, MPI_COMM_WORLD), 1.0e-8 * mfem::ParNormlp(u, 2, MPI_COMM_WORLD));
+}
+
+TEST(EquationSolver, ReusesPreconditionerUntilStale)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian2D(32, 32, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  auto                        fec = mfem::H1_FECollection(1, 2);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+  // a linear "timestep" problem, (K + c M) x = f, whose Jacobian is reassembled for every Newton iteration
+  auto assemble_matrix = [&fes](double mass) {
+    mfem::ConstantCoefficient coefficient(mass);
+    mfem::ParBilinearForm     form(&fes);
+    form.AddDomainIntegrator(new mfem::DiffusionIntegrator);
+    form.AddDomainIntegrator(new mfem::MassIntegrator(coefficient));
+    form.Assemble();
+    form.Finalize();
+    return std::unique_ptr<mfem::HypreParMatrix>(form.ParallelAssemble());
+  };
+
+  double                                c = 1.0e4;
+  std::unique_ptr<mfem::HypreParMatrix> A = assemble_matrix(c);
+  std::unique_ptr<mfem::HypreParMatrix> J;
+
+  mfem::Vector f(fes.TrueVSize());
+  f.Randomize(0);
+
+  StdFunctionOperator residual_opr(
+      fes.TrueVSize(),
+      [&](const mfem::Vector& x, mfem::Vector& r) {
+        A->Mult(x, r);
+        r -= f;
+      },
+      [&](const mfem::Vector&) -> mfem::Operator& {
+        J = assemble_matrix(c);
+        return *J;
+      });
+
+  const LinearSolverOptions lin_opts = {.linear_solver        = LinearSolver::CG,
+                                        .preconditioner       = Preconditioner::HypreJacobi,
+                                        .relative_tol         = 1.0e-10,
+                                        .absolute_tol         = 1.0e-14,
+                                        .max_iterations       = 500,
+                                        .reuse_preconditioner = true,
+                                        .max_iteration_growth = 2.0};
+
+  const NonlinearSolverOptions nonlin_opts = {.nonlin_solver  = NonlinearSolver::Newton,
+                                              .relative_tol   = 1.0e-8,
+                                              .absolute_tol   = 1.0e-12,
+                                              .max_iterations = 10};
+
+  EquationSolver eq_solver(nonlin_opts, lin_opts);
+  eq_solver.setOperator(residual_opr);
+
+  mfem::Vector x(fes.TrueVSize());
+  auto         step = [&](double new_c) {
+    c = new_c;
+    A = assemble_matrix(c);
+    x = 0.0;
+    eq_solver.solve(x);
+    EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+    return eq_solver.statistics();
+  };
+
+  // the preconditioner is built once, and kept while the problem changes slowly ...
+  EXPECT_EQ(step(1.0e4).preconditioner_setups, 1);
+  auto statistics = step(1.01e4);
+  EXPECT_EQ(statistics.preconditioner_setups, 1);
+  EXPECT_EQ(statistics.preconditioner_reuses, 1);
+
+  // ... until a rebuild is requested
+  eq_solver.rebuildPreconditioner();
+  EXPECT_EQ(step(1.0e4).preconditioner_setups, 2);
+
+  // ... or the linear iterations grow, which only rebuilds it for the following Jacobian
+  statistics = step(1.0);
+  EXPECT_EQ(statistics.preconditioner_setups, 2);
+  EXPECT_EQ(statistics.preconditioner_reuses, 2);
+  EXPECT_EQ(step(1.0).preconditioner_setups, 3);
+}
+
+TEST(EquationSolver, ReusesPreconditionerFromInputFile)
+{
+  axom::sidre::DataStore datastore;
+  axom::inlet::Inlet     inlet(std::make_unique<axom::inlet::LuaReader>(), datastore.getRoot());
+  inlet.reader().parseString(R"(
+    solver = {
+      linear = {
+        type = "iterative",
+        iterative_options = {
+          solver_type = "cg",
+          prec_type = "JacobiSmoother",
+          rel_tol = 1.0e-10,
+          abs_tol = 1.0e-14,
+          max_iter = 500,
+          reuse_preconditioner = true,
+        },
+      },
+      nonlinear = {
+        rel_tol = 1.0e-8,
+        abs_tol = 1.0e-12,
+        max_iter = 10,
+      },
+    })");
+
+  auto& solver_table = inlet.addStruct("solver", "Equation solver");
+  EquationSolver::defineInputFileSchema(solver_table);
+  ASSERT_TRUE(inlet.verify());
+
+  auto mesh  = mfem::Mesh::MakeCartesian2D(16, 16, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  auto                        fec = mfem::H1_FECollection(1, 2);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+  mfem::ConstantCoefficient mass(1.0e4);
+  mfem::ParBilinearForm     form(&fes);
+  form.AddDomainIntegrator(new mfem::DiffusionIntegrator);
+  form.AddDomainIntegrator(new mfem::MassIntegrator(mass));
+  form.Assemble();
+  form.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> A(form.ParallelAssemble());
+  std::unique_ptr<mfem::HypreParMatrix> J;
+
+  mfem::Vector f(fes.TrueVSize());
+  f.Randomize(0);
+
+  StdFunctionOperator residual_opr(
+      fes.TrueVSize(),
+      [&](const mfem::Vector& x, mfem::Vector& r) {
+        A->Mult(x, r);
+        r -= f;
+      },
+      [&](const mfem::Vector&) -> mfem::Operator& {
+        J = std::make_unique<mfem::HypreParMatrix>(*A);
+        return *J;
+      });
+
+  auto eq_solver = solver_table.get<EquationSolver>();
+  eq_solver.setOperator(residual_opr);
+
+  // the option read from the input file keeps the preconditioner of the first Jacobian for the second one
+  mfem::Vector x(fes.TrueVSize());
+  for (int solve = 0; solve < 2; solve++) {
+    x = 0.0;
+    eq_solver.solve(x);
+    EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+  }
+  EXPECT_EQ(eq_solver.statistics().preconditioner_setups, 1);
+  EXPECT_EQ(eq_solver.statistics().preconditioner_reuses, 1);
+}
+
+TEST(EquationSolver, ReusesPreconditionerOfMatrixFreeJacobians)
+{
+  auto mesh  = mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL);
+  auto pmesh = mfem::ParMesh(MPI_COMM_WORLD, mesh);
+
+  auto                        fec = mfem::H1_FECollection(3, 2);
+  mfem::ParFiniteElementSpace fes(&pmesh, &fec);
+
+  double                    c = 1.0;
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ConstantCoefficient mass(c);
+  mfem::DiffusionIntegrator diffusion(one);
+  mfem::MassIntegrator      inertia(mass);
+
+  // a timestep problem, (K + c M) x = f, whose Jacobian is only given to the solver matrix-free
+  auto assemble_matrix = [&fes, &c]() {
+    mfem::ConstantCoefficient coefficient(c);
+    mfem::ParBilinearForm     form(&fes);
+    form.AddDomainIntegrator(new mfem::DiffusionIntegrator);
+    form.AddDomainIntegrator(new mfem::MassIntegrator(coefficient));
+    form.Assemble();
+    form.Finalize();
+    return std::unique_ptr<mfem::HypreParMatrix>(form.ParallelAssemble());
+  };
+
+  ElementMatrixSource element_matrices = [&](const ElementMatrixVisitor& visit) {
+    mfem::Array<int>  dofs;
+    mfem::DenseMatrix matrix;
+    mfem::DenseMatrix mass_matrix;
+    mass.constant = c;
+    for (int e = 0; e < fes.GetNE(); e++) {
+      fes.GetElementVDofs(e, dofs);
+      diffusion.AssembleElementMatrix(*fes.GetFE(e), *fes.GetElementTransformation(e), matrix);
+      inertia.AssembleElementMatrix(*fes.GetFE(e), *fes.GetElementTransformation(e), mass_matrix);
+      matrix += mass_matrix;
+      visit(dofs, dofs, matrix);
+    }
+  };
+
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr    = 0;
+  ess_bdr[0] = 1;
+  mfem::Array<int> ess_tdofs;
+  fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+
+  std::unique_ptr<mfem::HypreParMatrix>      A;
+  std::unique_ptr<mfem::ConstrainedOperator> A_action;
+  std::unique_ptr<mfem::HypreParMatrix>      J;
+  std::unique_ptr<mfem::ConstrainedOperator> J_action;
+
+  mfem::Vector f(fes.TrueVSize());
+
+  // each linearization replaces the previous Jacobian, so a reused preconditioner mustn't refer to it
+  StdFunctionOperator residual_opr(
+      fes.TrueVSize(),
+      [&](const mfem::Vector& x, mfem::Vector& r) {
+        A_action->Mult(x, r);
+        r -= f;
+      },
+      [&](const mfem::Vector&) -> mfem::Operator& {
+        J        = assemble_matrix();
+        J_action = std::make_unique<mfem::ConstrainedOperator>(J.get(), ess_tdofs);
+        return *J_action;
+      });
+
+  const LinearSolverOptions lin_opts = {.linear_solver        = LinearSolver::CG,
+                                        .preconditioner       = Preconditioner::PMultigrid,
+                                        .relative_tol         = 1.0e-10,
+                                        .absolute_tol         = 1.0e-14,
+                                        .max_iterations       = 200,
+                                        .reuse_preconditioner = true,
+                                        .max_iteration_growth = 2.0};
+
+  const NonlinearSolverOptions nonlin_opts = {.nonlin_solver  = NonlinearSolver::Newton,
+                                              .relative_tol   = 1.0e-8,
+                                              .absolute_tol   = 1.0e-12,
+                                              .max_iterations = 10};
+
+  EquationSolver eq_solver(nonlin_opts, lin_opts);
+  eq_solver.setOperator(residual_opr);
+  eq_solver.setEssentialDofs([&ess_tdofs]() -> const mfem::Array<int>& { return ess_tdofs; });
+
+  auto& pmg = dynamic_cast<PMultigridPreconditioner&>(eq_solver.preconditioner());
+  pmg.setSpace(fes, [&ess_tdofs]() -> const mfem::Array<int>& { return ess_tdofs; }, element_matrices);
+
+  mfem::Vector x(fes.TrueVSize());
+  auto         step = [&](double new_c) {
+    c        = new_c;
+    A        = assemble_matrix();
+    A_action = std::make_unique<mfem::ConstrainedOperator>(A.get(), ess_tdofs);
+    f.Randomize(1);
+    f.SetSubVector(ess_tdofs, 0.0);
+    x = 0.0;
+    eq_solver.solve(x);
+    EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+    return eq_solver.statistics();
+  };
+
+  // the coarse levels are kept for the next (matrix-free) Jacobian, whose finest level is the new Jacobian ...
+  EXPECT_EQ(step(1.0).preconditioner_setups, 1);
+  auto statistics = step(1.01);
+  EXPECT_EQ(statistics.preconditioner_setups, 1);
+  EXPECT_EQ(statistics.preconditioner_reuses, 1);
+  EXPECT_EQ(&pmg.levelOperator(pmg.numLevels() - 1), J_action.get());
+
+  // ... until the essential dofs change
+  ess_bdr[1] = 1;
+  fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+  statistics = step(1.01);
+  EXPECT_EQ(statistics.preconditioner_setups, 2);
+  EXPECT_EQ(statistics.preconditioner_reuses, 1);
+}
+
 int main(int argc, char* argv[])
 {
   int result = 0;
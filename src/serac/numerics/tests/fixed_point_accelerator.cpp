@@ -0,0 +1,123 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/numerics/fixed_point_accelerator.hpp"
+
+namespace serac {
+
+/**
+ * Returns the number of iterations the given scheme takes to find the fixed point of G(x) = A x + b, where the
+ * iterates store the second unknown multiplied by @a scale, and are optionally scaled by block in the accelerator
+ */
+int fixedPointIterations(CouplingScheme scheme, mfem::Vector& x, double scale = 1.0, bool blocks = false)
+{
+  // a contraction, whose slowest mode converges at a rate of ~0.9 per (unaccelerated) iteration
+  mfem::DenseMatrix A(2);
+  A(0, 0) = 0.9;
+  A(0, 1) = 0.05;
+  A(1, 0) = 0.05;
+  A(1, 1) = 0.5;
+
+  mfem::Vector b(2);
+  b(0) = 1.0;
+  b(1) = 2.0;
+
+  FixedPointAccelerator accelerator(scheme, 5, MPI_COMM_WORLD);
+  if (blocks) {
+    mfem::Array<int> offsets({0, 1, 2});
+    accelerator.setBlocks(offsets);
+  }
+
+  x.SetSize(2);
+  x = 0.0;
+
+  mfem::Vector unscaled(2), g(2), r(2);
+  for (int k = 0; k < 1000; k++) {
+    unscaled(0) = x(0);
+    unscaled(1) = x(1) / scale;
+    A.Mult(unscaled, g);
+    g += b;
+
+    subtract(g, unscaled, r);
+    if (r.Norml2() < 1.0e-10) {
+      x = unscaled;
+      return k;
+    }
+
+    g(1) *= scale;
+    accelerator.update(x, g);
+  }
+
+  return -1;
+}
+
+TEST(FixedPointAccelerator, ConvergesFaster)
+{
+  // the fixed point solves (I - A) x = b
+  const double expected[2] = {12.0 / 0.95, 5.0 / 0.95};
+
+  mfem::Vector x;
+  int          fixed_point = fixedPointIterations(CouplingScheme::FixedPoint, x);
+  EXPECT_GT(fixed_point, 0);
+  EXPECT_NEAR(x(0), expected[0], 1.0e-8);
+  EXPECT_NEAR(x(1), expected[1], 1.0e-8);
+
+  int aitken = fixedPointIterations(CouplingScheme::Aitken, x);
+  EXPECT_GT(aitken, 0);
+  EXPECT_LT(aitken, fixed_point / 5);
+  EXPECT_NEAR(x(0), expected[0], 1.0e-8);
+  EXPECT_NEAR(x(1), expected[1], 1.0e-8);
+
+  // Anderson acceleration with more previous iterates than unknowns
+  // finds the fixed point of an affine map in (n + 2) iterations
+  int anderson = fixedPointIterations(CouplingScheme::Anderson, x);
+  EXPECT_GT(anderson, 0);
+  EXPECT_LE(anderson, 4);
+  EXPECT_NEAR(x(0), expected[0], 1.0e-8);
+  EXPECT_NEAR(x(1), expected[1], 1.0e-8);
+}
+
+TEST(FixedPointAccelerator, BlockScalingIsIndependentOfUnits)
+{
+  const double expected[2] = {12.0 / 0.95, 5.0 / 0.95};
+
+  // scaling each field by its first residual makes the iterates independent of the units of the fields, so a
+  // field with much larger values doesn't take over the relaxation factor or the least-squares fit
+  for (auto scheme : {CouplingScheme::Aitken, CouplingScheme::Anderson}) {
+    mfem::Vector x;
+    int          iterations = fixedPointIterations(scheme, x, 1.0, true);
+    EXPECT_GT(iterations, 0);
+
+    int scaled = fixedPointIterations(scheme, x, 1.0e6, true);
+    EXPECT_GT(scaled, 0);
+    EXPECT_LE(std::abs(scaled - iterations), 1);
+    EXPECT_NEAR(x(0), expected[0], 1.0e-8);
+    EXPECT_NEAR(x(1), expected[1], 1.0e-8);
+  }
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
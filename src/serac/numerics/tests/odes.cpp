@@ -237,7 +237,8 @@ int which_kind_of_ode(serac::TimestepMethod m)
 }
 
 double first_order_ode_test(int nsteps, ode_type type, constraint_type constraint, TimestepMethod timestepper,
-                            DirichletEnforcementMethod enforcement)
+                            DirichletEnforcementMethod enforcement, AdaptiveTimesteppingOptions adaptive = {},
+                            int* steps_taken = nullptr)
 {
   double t                      = 0.0;
   double ode_residual_eval_time = 0.0;
@@ -326,8 +327,21 @@ double first_order_ode_test(int nsteps, ode_type type, constraint_type constrain
   soln[1] = 2.0;
   soln[2] = 3.0;
 
-  for (int i = 0; i < nsteps; i++) {
-    ode.Step(soln, t, dt);
+  if (adaptive.enabled) {
+    // take as many steps as the error estimate requires to reach t = 1,
+    // using 1 / nsteps as the initial step size
+    ode.SetAdaptiveOptions(adaptive);
+    while (1.0 - t > 1.0e-12) {
+      double step = std::min(dt, 1.0 - t);
+      dt          = ode.AdaptiveStep(soln, t, step);
+      if (steps_taken) {
+        (*steps_taken)++;
+      }
+    }
+  } else {
+    for (int i = 0; i < nsteps; i++) {
+      ode.Step(soln, t, dt);
+    }
   }
 
   // these solutions are computed to machine precision in
@@ -358,7 +372,7 @@ double first_order_ode_test(int nsteps, ode_type type, constraint_type constrain
 }
 
 double second_order_ode_test(int nsteps, ode_type type, constraint_type constraint, TimestepMethod timestepper,
-                             DirichletEnforcementMethod enforcement)
+                             DirichletEnforcementMethod enforcement, AdaptiveTimesteppingOptions adaptive = {})
 {
   double t                      = 0.0;
   double ode_residual_eval_time = 0.0;
@@ -465,8 +479,18 @@ double second_order_ode_test(int nsteps, ode_type type, constraint_type constrai
     velocity[0] = 4.0;
   }
 
-  for (int i = 0; i < nsteps; i++) {
-    ode.Step(displacement, velocity, t, dt);
+  if (adaptive.enabled) {
+    // take as many steps as the error estimate requires to reach t = 1,
+    // using 1 / nsteps as the initial step size
+    ode.SetAdaptiveOptions(adaptive);
+    while (1.0 - t > 1.0e-12) {
+      double step = std::min(dt, 1.0 - t);
+      dt          = ode.AdaptiveStep(displacement, velocity, t, step);
+    }
+  } else {
+    for (int i = 0; i < nsteps; i++) {
+      ode.Step(displacement, velocity, t, dt);
+    }
   }
 
   // these solutions are computed to machine precision in
@@ -650,6 +674,50 @@ INSTANTIATE_TEST_SUITE_P(
     );
 // clang-format on
 
+TEST(AdaptiveTimestepping, FirstOrderIsMoreAccurateThanFixedStep)
+{
+  AdaptiveTimesteppingOptions adaptive{.enabled = true, .relative_tol = 1.0e-5, .absolute_tol = 1.0e-5};
+
+  for (auto constraint : {UNCONSTRAINED, SINE_WAVE}) {
+    double fixed_error    = first_order_ode_test(10, NONLINEAR, constraint, TimestepMethod::BackwardEuler,
+                                                 DirichletEnforcementMethod::RateControl);
+    double adaptive_error = first_order_ode_test(10, NONLINEAR, constraint, TimestepMethod::BackwardEuler,
+                                                 DirichletEnforcementMethod::RateControl, adaptive);
+    EXPECT_LT(adaptive_error, 0.1 * fixed_error);
+  }
+}
+
+TEST(AdaptiveTimestepping, FirstOrderMeetsTolerance)
+{
+  constexpr double            tol = 1.0e-6;
+  AdaptiveTimesteppingOptions adaptive{.enabled = true, .relative_tol = tol, .absolute_tol = tol};
+
+  for (auto constraint : {UNCONSTRAINED, SINE_WAVE}) {
+    // the first step is attempted over the whole interval, which is far too large, so it must be rejected
+    int    steps = 0;
+    double error = first_order_ode_test(1, NONLINEAR, constraint, TimestepMethod::BackwardEuler,
+                                        DirichletEnforcementMethod::RateControl, adaptive, &steps);
+    EXPECT_GT(steps, 1);
+
+    // the global error is bounded by the sum of the local errors, each of which is within
+    // (absolute_tol + relative_tol * |x|) <= 4 * tol, as the entries of the solution are at most about 3
+    EXPECT_LT(error, 4.0 * tol * steps);
+  }
+}
+
+TEST(AdaptiveTimestepping, SecondOrderIsMoreAccurateThanFixedStep)
+{
+  AdaptiveTimesteppingOptions adaptive{.enabled = true, .relative_tol = 1.0e-5, .absolute_tol = 1.0e-5};
+
+  for (auto constraint : {UNCONSTRAINED, SINE_WAVE}) {
+    double fixed_error    = second_order_ode_test(10, NONLINEAR, constraint, TimestepMethod::Newmark,
+                                                  DirichletEnforcementMethod::RateControl);
+    double adaptive_error = second_order_ode_test(10, NONLINEAR, constraint, TimestepMethod::Newmark,
+                                                  DirichletEnforcementMethod::RateControl, adaptive);
+    EXPECT_LT(adaptive_error, fixed_error);
+  }
+}
+
 int main(int argc, char* argv[])
 {
   int result = 0;
@@ -60,6 +60,78 @@ TEST(Operators, RectangularOperator)
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
+TEST(Operators, LinearizeOnMult)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  // f(x) = x^2 (componentwise), f'(x) = diag(2x)
+  mfem::DenseMatrix jacobian(2, 2);
+  int               evaluations    = 0;
+  int               linearizations = 0;
+
+  auto f_of_x = [](const mfem::Vector& x, mfem::Vector& y) {
+    y.SetSize(2);
+    y(0) = x(0) * x(0);
+    y(1) = x(1) * x(1);
+  };
+
+  mfem_ext::StdFunctionOperator f(
+      2, mfem_ext::StdFunctionOperator::linearize_on_mult,
+      [&](const mfem::Vector& x, mfem::Vector& y) {
+        evaluations++;
+        f_of_x(x, y);
+      },
+      [&](const mfem::Vector& x, mfem::Vector& y) -> mfem_ext::StdFunctionOperator::Linearization {
+        evaluations++;
+        f_of_x(x, y);
+
+        return [&, x0 = x(0), x1 = x(1)]() -> mfem::Operator& {
+          linearizations++;
+          jacobian       = 0.0;
+          jacobian(0, 0) = 2.0 * x0;
+          jacobian(1, 1) = 2.0 * x1;
+          return jacobian;
+        };
+      });
+
+  mfem::Vector x(2), y(2);
+  x(0) = 1.0;
+  x(1) = 2.0;
+
+  // the gradient at the input of an evaluation that was asked to linearize doesn't need another evaluation
+  f.linearizeNextMult();
+  f.Mult(x, y);
+  EXPECT_DOUBLE_EQ(y(1), 4.0);
+  auto& J = f.GetGradient(x);
+  EXPECT_EQ(evaluations, 1);
+  EXPECT_EQ(linearizations, 1);
+  EXPECT_EQ(&J, &jacobian);
+  EXPECT_DOUBLE_EQ(jacobian(1, 1), 4.0);
+
+  // other evaluations (e.g. at trial points) don't linearize, and keep the previous linearization
+  x(1) = 3.0;
+  f.Mult(x, y);
+  EXPECT_DOUBLE_EQ(y(1), 9.0);
+  x(1) = 2.0;
+  f.GetGradient(x);
+  EXPECT_EQ(evaluations, 2);
+  EXPECT_EQ(linearizations, 2);
+
+  // the gradient anywhere else needs another evaluation
+  x(1) = 3.0;
+  f.GetGradient(x);
+  EXPECT_EQ(evaluations, 3);
+  EXPECT_DOUBLE_EQ(jacobian(1, 1), 6.0);
+
+  // as does the gradient after the linearization is discarded
+  f.resetLinearization();
+  f.GetGradient(x);
+  EXPECT_EQ(evaluations, 4);
+  EXPECT_EQ(linearizations, 4);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
 }  // namespace serac
 
 int main(int argc, char* argv[])
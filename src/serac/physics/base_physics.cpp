@@ -12,6 +12,7 @@
 
 #include "serac/infrastructure/initialize.hpp"
 #include "serac/infrastructure/logger.hpp"
+#include "serac/infrastructure/memory.hpp"
 #include "serac/infrastructure/terminator.hpp"
 #include "serac/physics/state/finite_element_state.hpp"
 #include "serac/physics/state/state_manager.hpp"
@@ -228,9 +229,13 @@ void BasePhysics::initializeSummary(axom::sidre::DataStore& datastore, double t_
   //         │    ├── l1norm : Sidre::Array<double>
   //         │    └── l2norm : Sidre::Array<double>
   //         ...
-  //         └── <FiniteElementState name>
-  //              ├── l1norm : Sidre::Array<double>
-  //              └── l2norm : Sidre::Array<double>
+  //         ├── <FiniteElementState name>
+  //         │    ├── l1norm : Sidre::Array<double>
+  //         │    └── l2norm : Sidre::Array<double>
+  //         └── solver_diagnostics
+  //              ├── memory_high_water_mark : Sidre::Array<double>
+  //              ├── <diagnostic name> : Sidre::Array<double>
+  //              ...
 
   auto [count, rank] = getMPIInfo();
   if (rank != 0) {
@@ -267,6 +272,13 @@ void BasePhysics::initializeSummary(axom::sidre::DataStore& datastore, double t_
       axom::sidre::Array<double> array(curr_array_view, 0, array_size);
     }
   }
+
+  // Group for the solver diagnostics, with an array for each quantity to hold a value at each time step
+  axom::sidre::Group* diagnostics_group = curves_group->createGroup("solver_diagnostics");
+  for (const auto& [diagnostic_name, _] : summaryDiagnostics(0)) {
+    axom::sidre::View*         curr_array_view = diagnostics_group->createView(diagnostic_name);
+    axom::sidre::Array<double> array(curr_array_view, 0, array_size);
+  }
 }
 
 void BasePhysics::saveSummary(axom::sidre::DataStore& datastore, const double t) const
@@ -331,6 +343,54 @@ void BasePhysics::saveSummary(axom::sidre::DataStore& datastore, const double t)
       mins.push_back(min_value);
     }
   }
+
+  // Note: This is a collective operation.
+  auto diagnostics = summaryDiagnostics(memoryHighWaterMark(mesh_.GetComm()));
+
+  // Only save on root node
+  if (rank == 0) {
+    axom::sidre::Group* diagnostics_group = curves_group->getGroup("solver_diagnostics");
+    for (const auto& [diagnostic_name, value] : diagnostics) {
+      axom::sidre::Array<double> values(diagnostics_group->getView(diagnostic_name));
+      values.push_back(value);
+    }
+  }
+}
+
+std::map<std::string, double> BasePhysics::summaryDiagnostics(std::size_t memory_high_water_mark) const
+{
+  auto diagnostics = solverDiagnostics();
+  diagnostics.insert({"memory_high_water_mark", static_cast<double>(memory_high_water_mark)});
+  return diagnostics;
+}
+
+void BasePhysics::logMemoryUsage(const std::string& when) const
+{
+  logMemoryReport(axom::fmt::format("{} of physics module '{}'", when, name_), mesh_.GetComm());
+}
+
+void BasePhysics::setMemoryReportInterval(int interval)
+{
+  SLIC_ERROR_ROOT_IF(interval < 0, axom::fmt::format("Memory report interval must be non-negative, got {}", interval));
+  memory_report_interval_ = interval;
+}
+
+void BasePhysics::logMemoryUsageAtEndOfCycle() const
+{
+  bool due = memory_report_interval_ ? (*memory_report_interval_ > 0 && cycle_ % *memory_report_interval_ == 0)
+                                     : isCheckpointCycle(cycle_);
+  if (due) {
+    logMemoryUsage(axom::fmt::format("at the end of cycle {}", cycle_));
+  }
+}
+
+std::size_t BasePhysics::checkpointIndex(int cycle) const
+{
+  SLIC_ERROR_ROOT_IF(!isCheckpointCycle(cycle),
+                     axom::fmt::format("Cycle {} of physics module '{}' was not checkpointed, as its states are only "
+                                       "checkpointed every {} cycles",
+                                       cycle, name_, checkpoint_interval_));
+  return static_cast<std::size_t>(cycle / checkpoint_interval_);
 }
 
 FiniteElementState BasePhysics::loadCheckpointedState(const std::string& state_name, int cycle) const
@@ -355,7 +415,7 @@ FiniteElementState BasePhysics::loadCheckpointedState(const std::string& state_n
       checkpoint_states_.find(state_name) == checkpoint_states_.end(),
       axom::fmt::format("Requested state name {} does not exist in physics module {}.", state_name, name_));
 
-  return checkpoint_states_.at(state_name)[static_cast<size_t>(cycle)];
+  return checkpoint_states_.at(state_name)[checkpointIndex(cycle)];
 }
 
 std::unordered_map<std::string, FiniteElementState> BasePhysics::getCheckpointedStates(int /*cycle*/) const
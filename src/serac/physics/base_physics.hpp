@@ -13,7 +13,10 @@
 #pragma once
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "mfem.hpp"
 #include "axom/sidre.hpp"
@@ -462,6 +465,17 @@ public:
    */
   virtual void saveSummary(axom::sidre::DataStore& datastore, const double t) const;
 
+  /**
+   * @brief Get diagnostic information about the solver's behavior during the most recent call to advanceTimestep
+   *
+   * The entries are recorded in the summary alongside the state norms, so the set of names must not change
+   * over the course of a simulation. Physics modules with an EquationSolver include its SolverStatistics
+   * (iteration and evaluation counts, and assembly and solve times).
+   *
+   * @return A map from the name of each diagnostic quantity to its value
+   */
+  virtual std::map<std::string, double> solverDiagnostics() const { return {}; }
+
   /**
    * @brief Destroy the Base Solver object
    */
@@ -474,6 +488,16 @@ public:
   /// @overload
   mfem::ParMesh& mesh() { return mesh_; }
 
+  /**
+   * @brief Set how often the memory report is logged during time integration
+   *
+   * @param interval The memory report is logged at the end of every @a interval cycles, or never if it is 0.
+   * By default, it is logged at the end of every cycle whose states are checkpointed (i.e. every output cycle).
+   *
+   * @note The report is always logged after completeSetup
+   */
+  void setMemoryReportInterval(int interval);
+
 protected:
   /**
    * @brief Create a paraview data collection for the physics package if requested
@@ -505,6 +529,30 @@ protected:
    */
   virtual std::unordered_map<std::string, FiniteElementState> getCheckpointedStates(int cycle) const;
 
+  /**
+   * @brief The per-cycle quantities recorded in the "solver_diagnostics" group of the summary
+   *
+   * @param memory_high_water_mark The largest memory high-water mark (in bytes) of the ranks
+   * @return The solver diagnostics, and the memory high-water mark
+   */
+  std::map<std::string, double> summaryDiagnostics(std::size_t memory_high_water_mark) const;
+
+  /**
+   * @brief Log the memory in use by each category of allocation, across the ranks of this module's mesh
+   *
+   * @param when A description of the point in the simulation, e.g. "after completeSetup"
+   *
+   * @note This is a collective operation
+   */
+  void logMemoryUsage(const std::string& when) const;
+
+  /**
+   * @brief Log the memory report at the end of the current cycle, if it is due (see setMemoryReportInterval)
+   *
+   * @note This is a collective operation
+   */
+  void logMemoryUsageAtEndOfCycle() const;
+
   /// @brief Name of the physics module
   std::string name_ = {};
 
@@ -591,6 +639,23 @@ protected:
   /// @brief A map containing optionally in-memory checkpointed primal states for transient adjoint solvers
   mutable std::unordered_map<std::string, std::vector<serac::FiniteElementState>> checkpoint_states_;
 
+  /// @brief The number of cycles between checkpoints of the primal states
+  int checkpoint_interval_ = 1;
+
+  /// @brief The number of cycles between memory reports (0 disables them), or nullopt to report at checkpoint cycles
+  std::optional<int> memory_report_interval_;
+
+  /// @brief Whether the primal states are checkpointed at the end of a given cycle
+  bool isCheckpointCycle(int cycle) const { return cycle % checkpoint_interval_ == 0; }
+
+  /**
+   * @brief The position of a cycle in the vectors of in-memory checkpoints
+   *
+   * @param cycle The cycle, which must be a multiple of the checkpoint interval
+   * @return The index of the checkpoint of @a cycle in checkpoint_states_
+   */
+  std::size_t checkpointIndex(int cycle) const;
+
   /**
    * @brief A container relating a checkpointed cycle and the associated finite element state fields
    *
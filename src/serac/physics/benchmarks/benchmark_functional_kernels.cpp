@@ -0,0 +1,425 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file benchmark_functional_kernels.cpp
+ *
+ * @brief Measures the throughput (DOF/s and quadrature points/s) of Functional's kernels
+ * across element geometries, polynomial orders, function spaces and material models, and
+ * writes the results to a JSON file
+ *
+ * The operations measured for each problem are:
+ *   - "residual": evaluating the residual, r(U)
+ *   - "linearize": evaluating the residual and the q-function derivatives, r(U), dr/dU
+ *   - "jvp": applying the gradient to a vector, dr/dU * dU
+ *   - "element_gradient": computing the element stiffness matrices
+ *   - "assemble": assembling the global sparse matrix
+ *
+ * For reference, the action of the equivalent mfem operator with partial assembly is also
+ * measured for the scalar H1 problems ("mfem_partial_assembly_action").
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/infrastructure/about.hpp"
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/physics/materials/solid_material.hpp"
+
+namespace {
+
+/// @brief the settings shared by every benchmark problem
+struct BenchmarkOptions {
+  double target_dofs;  ///< the approximate (global) number of degrees of freedom in each problem
+  int    repetitions;  ///< the number of times each operation is timed, the fastest time is reported
+};
+
+/// @brief the measured performance of one operation on one problem
+struct BenchmarkResult {
+  std::string physics;            ///< the q-function being integrated
+  std::string space;              ///< the function space family
+  std::string geometry;           ///< the element geometry
+  int         order;              ///< the polynomial order
+  std::string operation;          ///< which operation was timed
+  long long   elements;           ///< the global number of elements
+  long long   dofs;               ///< the global number of true degrees of freedom
+  long long   quadrature_points;  ///< the global number of quadrature points
+  double      seconds;            ///< the fastest time to perform the operation
+};
+
+std::string name(mfem::Geometry::Type geom)
+{
+  switch (geom) {
+    case mfem::Geometry::TRIANGLE:
+      return "triangle";
+    case mfem::Geometry::SQUARE:
+      return "quadrilateral";
+    case mfem::Geometry::TETRAHEDRON:
+      return "tetrahedron";
+    case mfem::Geometry::CUBE:
+      return "hexahedron";
+    default:
+      return "unsupported";
+  }
+}
+
+std::string name(serac::Family family)
+{
+  switch (family) {
+    case serac::Family::H1:
+      return "H1";
+    case serac::Family::HCURL:
+      return "Hcurl";
+    case serac::Family::L2:
+      return "L2";
+    default:
+      return "unsupported";
+  }
+}
+
+/// @brief serac's simplex elements are only implemented up to p = 3
+constexpr bool supported(mfem::Geometry::Type geom, int p)
+{
+  return (geom == mfem::Geometry::SQUARE || geom == mfem::Geometry::CUBE) || p <= 3;
+}
+
+/// @brief build a mesh of the unit square (or cube), with roughly `target_dofs` degrees of freedom
+std::unique_ptr<mfem::ParMesh> buildMesh(mfem::Geometry::Type geom, int p, int components, double target_dofs)
+{
+  int dim = mfem::Geometry::Dimension[geom];
+  int n   = std::max(1, static_cast<int>(std::round(std::pow(target_dofs / components, 1.0 / dim) / p)));
+
+  mfem::Mesh mesh;
+  switch (geom) {
+    case mfem::Geometry::TRIANGLE:
+      mesh = mfem::Mesh::MakeCartesian2D(n, n, mfem::Element::TRIANGLE, true);
+      break;
+    case mfem::Geometry::SQUARE:
+      mesh = mfem::Mesh::MakeCartesian2D(n, n, mfem::Element::QUADRILATERAL, true);
+      break;
+    case mfem::Geometry::TETRAHEDRON:
+      mesh = mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::TETRAHEDRON);
+      break;
+    default:
+      mesh = mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON);
+      break;
+  }
+
+  return serac::mesh::refineAndDistribute(std::move(mesh), 0, 0);
+}
+
+/// @brief the fastest of several (synchronized) executions of f
+template <typename callable>
+double fastest(const callable& f, int repetitions)
+{
+  f();  // warm up
+
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < repetitions; r++) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    auto start = std::chrono::steady_clock::now();
+    f();
+    MPI_Barrier(MPI_COMM_WORLD);
+    auto stop = std::chrono::steady_clock::now();
+    best      = std::min(best, std::chrono::duration<double>(stop - start).count());
+  }
+  return best;
+}
+
+/// @brief a diffusion-like q-function, for scalar H1 and L2 spaces
+struct Diffusion {
+  template <typename X, typename Temperature>
+  SERAC_HOST_DEVICE auto operator()(double /*t*/, X /*x*/, Temperature temperature) const
+  {
+    auto [u, du_dx] = temperature;
+    return serac::tuple{u, du_dx};
+  }
+};
+
+/// @brief a curl-curl q-function, for Hcurl spaces
+struct CurlCurl {
+  template <typename X, typename VectorPotential>
+  SERAC_HOST_DEVICE auto operator()(double /*t*/, X /*x*/, VectorPotential vector_potential) const
+  {
+    auto [A, curl_A] = vector_potential;
+    return serac::tuple{A, curl_A};
+  }
+};
+
+/// @brief the (geometrically nonlinear) quasi-static solid mechanics q-function, see SolidMechanics
+template <typename Material>
+struct SolidMechanicsResidual {
+  Material material;  ///< the material model
+
+  template <typename X, typename State, typename Displacement>
+  SERAC_HOST_DEVICE auto operator()(double /*t*/, X /*x*/, State& state, Displacement displacement) const
+  {
+    constexpr auto I = serac::Identity<3>();
+    auto [u, du_dX]  = displacement;
+    auto stress      = material(state, du_dX);
+    auto dx_dX       = du_dX + I;
+    auto flux        = dot(stress, transpose(inv(dx_dX))) * det(dx_dX);
+    return serac::tuple{material.density * u, flux};
+  }
+};
+
+/**
+ * @brief time each operation of a Functional integrating the given q-function over a mesh
+ * with the given element geometry, and append the results to @a results
+ */
+template <mfem::Geometry::Type geom, typename space, typename QFunction, typename StateType = serac::Nothing>
+void benchmark(const std::string& physics, const QFunction& qf, const BenchmarkOptions& options,
+               std::vector<BenchmarkResult>& results, StateType initial_state = {})
+{
+  constexpr int dim = serac::dimension_of(geom);
+  constexpr int p   = space::order;
+
+  if constexpr (supported(geom, p)) {
+    std::string region = axom::fmt::format("{} {} {} p={}", physics, name(space::family), name(geom), p);
+    CALI_CXX_MARK_SCOPE(region.c_str());
+
+    auto      mesh         = buildMesh(geom, p, space::components, options.target_dofs);
+    auto      fe           = serac::generateParFiniteElementSpace<space>(mesh.get());
+    auto&     fespace      = fe.first;
+    long long num_elements = mesh->GetGlobalNE();
+    long long num_qpts     = num_elements * serac::num_quadrature_points(geom, p + 1);
+
+    serac::Functional<space(space)> residual(fespace.get(), {fespace.get()});
+
+    if constexpr (std::is_same_v<StateType, serac::Nothing>) {
+      residual.AddDomainIntegral(serac::Dimension<dim>{}, serac::DependsOn<0>{}, qf, *mesh);
+    } else if constexpr (std::is_same_v<StateType, serac::Empty>) {
+      residual.AddDomainIntegral(serac::Dimension<dim>{}, serac::DependsOn<0>{}, qf, *mesh, serac::EmptyQData);
+    } else {
+      using geom_array_t               = typename serac::QuadratureData<StateType>::geom_array_t;
+      geom_array_t elements            = {};
+      geom_array_t qpts_per_element    = {};
+      elements[uint32_t(geom)]         = uint32_t(mesh->GetNE());
+      qpts_per_element[uint32_t(geom)] = uint32_t(serac::num_quadrature_points(geom, p + 1));
+      auto qdata = std::make_shared<serac::QuadratureData<StateType>>(elements, qpts_per_element, initial_state);
+      residual.AddDomainIntegral(serac::Dimension<dim>{}, serac::DependsOn<0>{}, qf, *mesh, qdata);
+    }
+
+    // small random displacements, so that the nonlinear materials remain well defined
+    mfem::ParGridFunction u(fespace.get());
+    u.Randomize(0);
+    u *= 1.0e-3;
+    mfem::Vector U(fespace->TrueVSize());
+    u.GetTrueDofs(U);
+
+    double t = 0.0;
+
+    auto record = [&](const std::string& operation, double seconds) {
+      results.push_back({physics, name(space::family), name(geom), p, operation, num_elements,
+                         static_cast<long long>(fespace->GlobalTrueVSize()), num_qpts, seconds});
+    };
+
+    record("residual", fastest([&]() { residual(t, U); }, options.repetitions));
+    record("linearize", fastest([&]() { residual(t, serac::differentiate_wrt(U)); }, options.repetitions));
+
+    auto  linearization = residual(t, serac::differentiate_wrt(U));
+    auto& dr_dU         = serac::get<1>(linearization);
+    record("jvp", fastest([&]() { dr_dU(U); }, options.repetitions));
+    record("element_gradient", fastest([&]() { dr_dU.elementGradients(); }, options.repetitions));
+    record("assemble", fastest([&]() { assemble(dr_dU); }, options.repetitions));
+  }
+}
+
+/**
+ * @brief time the action of the equivalent mfem bilinear form (mass + diffusion) with partial assembly,
+ * as a point of reference for the scalar H1 "diffusion" results
+ */
+template <mfem::Geometry::Type geom, int p>
+void benchmarkPartialAssembly(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+  if constexpr (supported(geom, p)) {
+    auto                        mesh = buildMesh(geom, p, 1, options.target_dofs);
+    mfem::H1_FECollection       fec(p, mesh->Dimension());
+    mfem::ParFiniteElementSpace fespace(mesh.get(), &fec);
+
+    const mfem::IntegrationRule& rule = mfem::IntRules.Get(geom, 2 * p + 1);
+
+    mfem::ParBilinearForm form(&fespace);
+    form.SetAssemblyLevel(mfem::AssemblyLevel::PARTIAL);
+    form.AddDomainIntegrator(new mfem::MassIntegrator(&rule));
+    form.AddDomainIntegrator(new mfem::DiffusionIntegrator(&rule));
+    form.Assemble();
+
+    mfem::OperatorPtr A;
+    mfem::Array<int>  no_essential_dofs;
+    form.FormSystemMatrix(no_essential_dofs, A);
+
+    mfem::Vector U(fespace.TrueVSize());
+    mfem::Vector R(fespace.TrueVSize());
+    U.Randomize(0);
+
+    double seconds = fastest([&]() { A->Mult(U, R); }, options.repetitions);
+
+    long long num_elements = mesh->GetGlobalNE();
+    results.push_back({"diffusion", "H1", name(geom), p, "mfem_partial_assembly_action", num_elements,
+                       static_cast<long long>(fespace.GlobalTrueVSize()),
+                       num_elements * static_cast<long long>(rule.GetNPoints()), seconds});
+  }
+}
+
+/// @brief run a benchmark for each polynomial order, p = 1 .. 4
+template <mfem::Geometry::Type geom, template <int> typename space, typename QFunction, typename... StateType>
+void benchmarkOrders(const std::string& physics, const QFunction& qf, const BenchmarkOptions& options,
+                     std::vector<BenchmarkResult>& results, StateType... initial_state)
+{
+  benchmark<geom, space<1>>(physics, qf, options, results, initial_state...);
+  benchmark<geom, space<2>>(physics, qf, options, results, initial_state...);
+  benchmark<geom, space<3>>(physics, qf, options, results, initial_state...);
+  benchmark<geom, space<4>>(physics, qf, options, results, initial_state...);
+}
+
+/// @brief scalar H1 space
+template <int p>
+using H1Scalar = serac::H1<p>;
+
+/// @brief vector-valued H1 space in 3D
+template <int p>
+using H1Vector3D = serac::H1<p, 3>;
+
+/// @brief Hcurl space
+template <int p>
+using HcurlSpace = serac::Hcurl<p>;
+
+/// @brief scalar L2 space
+template <int p>
+using L2Scalar = serac::L2<p>;
+
+/// @brief write the results, along with some information about the build and the run, to a JSON file
+void writeJSON(const std::string& filename, const BenchmarkOptions& options,
+               const std::vector<BenchmarkResult>& results)
+{
+  int num_ranks = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  std::ofstream output(filename);
+  SLIC_ERROR_IF(!output, axom::fmt::format("Can not write benchmark results to '{}'", filename));
+
+  output << "{\n";
+  output << axom::fmt::format("  \"version\": \"{}\",\n", serac::version(false));
+  output << axom::fmt::format("  \"git_sha\": \"{}\",\n", serac::gitSHA());
+  output << axom::fmt::format("  \"mpi_ranks\": {},\n", num_ranks);
+  output << axom::fmt::format("  \"target_dofs\": {},\n", options.target_dofs);
+  output << axom::fmt::format("  \"repetitions\": {},\n", options.repetitions);
+  output << "  \"results\": [\n";
+  for (std::size_t i = 0; i < results.size(); i++) {
+    const auto& r = results[i];
+    output << axom::fmt::format(
+        "    {{\"physics\": \"{}\", \"space\": \"{}\", \"geometry\": \"{}\", \"order\": {}, \"operation\": \"{}\", "
+        "\"elements\": {}, \"dofs\": {}, \"quadrature_points\": {}, \"seconds\": {:.6e}, \"dofs_per_second\": "
+        "{:.6e}, \"qpts_per_second\": {:.6e}}}{}\n",
+        r.physics, r.space, r.geometry, r.order, r.operation, r.elements, r.dofs, r.quadrature_points, r.seconds,
+        r.dofs / r.seconds, r.quadrature_points / r.seconds, (i + 1 < results.size()) ? "," : "");
+  }
+  output << "  ]\n";
+  output << "}\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  BenchmarkOptions options{1.0e5, 5};
+  std::string      output_file = "functional_benchmarks.json";
+
+  axom::CLI::App app{"Functional kernel benchmarks"};
+  app.add_option("-o, --output", output_file, "JSON file to write the results to");
+  app.add_option("-d, --dofs", options.target_dofs, "Approximate number of degrees of freedom in each problem")
+      ->check(axom::CLI::PositiveNumber);
+  app.add_option("-r, --repetitions", options.repetitions, "Number of timed repetitions of each operation")
+      ->check(axom::CLI::PositiveNumber);
+  CLI11_PARSE(app, argc, argv);
+
+  serac::profiling::initialize();
+
+  std::vector<BenchmarkResult> results;
+
+  // function spaces, with diffusion-like q-functions
+  benchmarkOrders<mfem::Geometry::TRIANGLE, H1Scalar>("diffusion", Diffusion{}, options, results);
+  benchmarkOrders<mfem::Geometry::SQUARE, H1Scalar>("diffusion", Diffusion{}, options, results);
+  benchmarkOrders<mfem::Geometry::TETRAHEDRON, H1Scalar>("diffusion", Diffusion{}, options, results);
+  benchmarkOrders<mfem::Geometry::CUBE, H1Scalar>("diffusion", Diffusion{}, options, results);
+
+  benchmarkPartialAssembly<mfem::Geometry::TRIANGLE, 1>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::TRIANGLE, 2>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::TRIANGLE, 3>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::SQUARE, 1>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::SQUARE, 2>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::SQUARE, 3>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::SQUARE, 4>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::TETRAHEDRON, 1>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::TETRAHEDRON, 2>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::TETRAHEDRON, 3>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::CUBE, 1>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::CUBE, 2>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::CUBE, 3>(options, results);
+  benchmarkPartialAssembly<mfem::Geometry::CUBE, 4>(options, results);
+
+  // serac doesn't implement Hcurl on simplices
+  benchmarkOrders<mfem::Geometry::SQUARE, HcurlSpace>("curlcurl", CurlCurl{}, options, results);
+  benchmarkOrders<mfem::Geometry::CUBE, HcurlSpace>("curlcurl", CurlCurl{}, options, results);
+
+  benchmarkOrders<mfem::Geometry::TRIANGLE, L2Scalar>("diffusion", Diffusion{}, options, results);
+  benchmarkOrders<mfem::Geometry::SQUARE, L2Scalar>("diffusion", Diffusion{}, options, results);
+  benchmarkOrders<mfem::Geometry::TETRAHEDRON, L2Scalar>("diffusion", Diffusion{}, options, results);
+  benchmarkOrders<mfem::Geometry::CUBE, L2Scalar>("diffusion", Diffusion{}, options, results);
+
+  // solid mechanics material models (J2 is only implemented in 3D)
+  using serac::solid_mechanics::J2;
+  using serac::solid_mechanics::LinearIsotropic;
+  using serac::solid_mechanics::NeoHookean;
+
+  SolidMechanicsResidual<LinearIsotropic> linear{{.density = 1.0, .K = 1.0, .G = 1.0}};
+  SolidMechanicsResidual<NeoHookean>      neo_hookean{{.density = 1.0, .K = 1.0, .G = 1.0}};
+
+  // a low yield stress, so that the return mapping is exercised at most quadrature points
+  SolidMechanicsResidual<J2> j2{{.E = 100.0, .nu = 0.25, .Hi = 1.0, .Hk = 0.0, .sigma_y = 1.0e-4, .density = 1.0}};
+
+  constexpr serac::Empty no_state{};
+
+  benchmarkOrders<mfem::Geometry::TETRAHEDRON, H1Vector3D>("linear_isotropic", linear, options, results, no_state);
+  benchmarkOrders<mfem::Geometry::CUBE, H1Vector3D>("linear_isotropic", linear, options, results, no_state);
+
+  benchmarkOrders<mfem::Geometry::TETRAHEDRON, H1Vector3D>("neo_hookean", neo_hookean, options, results, no_state);
+  benchmarkOrders<mfem::Geometry::CUBE, H1Vector3D>("neo_hookean", neo_hookean, options, results, no_state);
+
+  benchmarkOrders<mfem::Geometry::TETRAHEDRON, H1Vector3D>("j2", j2, options, results, J2::State{});
+  benchmarkOrders<mfem::Geometry::CUBE, H1Vector3D>("j2", j2, options, results, J2::State{});
+
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  if (rank == 0) {
+    writeJSON(output_file, options, results);
+    SLIC_INFO(axom::fmt::format("Wrote {} benchmark results to '{}'", results.size(), output_file));
+  }
+
+  serac::profiling::finalize();
+
+  MPI_Finalize();
+
+  return 0;
+}
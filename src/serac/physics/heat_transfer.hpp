@@ -171,7 +171,9 @@ public:
     if (timestepping_opts.timestepper != TimestepMethod::QuasiStatic) {
       ode_.SetTimestepper(timestepping_opts.timestepper);
       ode_.SetEnforcementMethod(timestepping_opts.enforcement_method);
-      is_quasistatic_ = false;
+      ode_.SetAdaptiveOptions(timestepping_opts.adaptive);
+      adaptive_timestepping_ = timestepping_opts.adaptive.enabled;
+      is_quasistatic_        = false;
     } else {
       is_quasistatic_ = true;
     }
@@ -211,6 +213,30 @@ public:
 
     nonlin_solver_->setOperator(residual_with_bcs_);
 
+    // a reused preconditioner is rebuilt when the essential boundary conditions change
+    nonlin_solver_->setEssentialDofs([this]() -> const mfem::Array<int>& { return bcs_.allEssentialTrueDofs(); });
+
+    // The LOR and p-multigrid preconditioners need the temperature space to build their coarse levels
+    if (auto* lor_prec = dynamic_cast<LORPreconditioner*>(&nonlin_solver_->preconditioner())) {
+      // the LOR preconditioner fits its low-order model to the element matrices, so the Jacobian isn't assembled
+      lor_prec->setSpace(
+          temperature_.space(), [this]() -> const mfem::Array<int>& { return bcs_.allEssentialTrueDofs(); },
+          [this](const ElementMatrixVisitor& visit) {
+            SLIC_ERROR_ROOT_IF(!jacobian_element_matrices_, "The Jacobian has not been linearized yet");
+            jacobian_element_matrices_(visit);
+          });
+      matrix_free_jacobian_ = true;
+    } else if (auto* pmg_prec = dynamic_cast<PMultigridPreconditioner*>(&nonlin_solver_->preconditioner())) {
+      // the p-multigrid preconditioner forms its levels from the element matrices, so the Jacobian isn't assembled
+      pmg_prec->setSpace(
+          temperature_.space(), [this]() -> const mfem::Array<int>& { return bcs_.allEssentialTrueDofs(); },
+          [this](const ElementMatrixVisitor& visit) {
+            SLIC_ERROR_ROOT_IF(!jacobian_element_matrices_, "The Jacobian has not been linearized yet");
+            jacobian_element_matrices_(visit);
+          });
+      matrix_free_jacobian_ = true;
+    }
+
     int true_size = temperature_.space().TrueVSize();
     u_.SetSize(true_size);
     u_predicted_.SetSize(true_size);
@@ -277,6 +303,7 @@ public:
   {
     dt_          = 0.0;
     previous_dt_ = -1.0;
+    next_dt_     = -1.0;
 
     u_                                              = 0.0;
     temperature_                                    = 0.0;
@@ -328,43 +355,103 @@ public:
    *
    * Advance the underlying ODE with the requested time integration scheme using the previously set timestep.
    *
+   * If adaptive timestepping is enabled, the interval dt is covered by as many steps as the local error
+   * estimate requires, and each accepted step is recorded as its own cycle (so adjoint solves replay the
+   * steps that were actually taken).
+   *
    * @param dt The increment of simulation time to advance the underlying heat transfer problem
    */
   void advanceTimestep(double dt) override
   {
-    if (is_quasistatic_) {
-      time_ += dt;
+    nonlin_solver_->resetStatistics();
 
-      // Set the ODE time point for the time-varying loads in quasi-static problems
-      ode_time_point_ = time_;
+    // the time, boundary conditions and parameters may have changed since the residual was last linearized
+    residual_with_bcs_.resetLinearization();
 
-      // Project the essential boundary coefficients
-      for (auto& bc : bcs_.essentials()) {
-        bc.setDofs(temperature_, time_);
+    if (adaptive_timestepping_) {
+      const double end_time = time_ + dt;
+      if (next_dt_ <= 0.0) {
+        next_dt_ = dt;
       }
-      nonlin_solver_->solve(temperature_);
-    } else {
-      // Step the time integrator
-      // Note that the ODE solver handles the essential boundary condition application itself
-      ode_.Step(temperature_, time_, dt);
-    }
 
-    cycle_ += 1;
+      while (end_time - time_ > 1.0e-12 * dt) {
+        const double requested = std::min(next_dt_, end_time - time_);
+        double       step      = requested;
+        double       next      = ode_.AdaptiveStep(temperature_, time_, step);
 
-    if (checkpoint_to_disk_) {
-      outputStateToDisk();
-    } else {
-      auto state_names = stateNames();
-      for (const auto& state_name : state_names) {
-        checkpoint_states_[state_name].push_back(state(state_name));
+        // a step that was only shortened to land on the end of the interval
+        // shouldn't limit the size of subsequent steps
+        if (requested < next_dt_ && step == requested) {
+          next = std::max(next, next_dt_);
+        }
+        next_dt_ = next;
+
+        finalizeTimestep(step);
       }
+      return;
     }
 
-    if (cycle_ > max_cycle_) {
-      timesteps_.push_back(dt);
-      max_cycle_ = cycle_;
-      max_time_  = time_;
+    solveStep(dt);
+    finalizeTimestep(dt);
+  }
+
+  /**
+   * @brief Solve for the temperature at the end of a timestep, without completing the timestep
+   *
+   * This lets coupled physics modules (e.g. Thermomechanics) iterate on a timestep. Until the timestep is completed
+   * by completeTimestep(), every call after the first solves the same timestep again from the state at its start,
+   * picking up any changes to the parameters. Quasi-static solves start from the most recent temperature instead, as
+   * it is usually the better initial guess.
+   *
+   * @param dt The increment of simulation time to advance the underlying heat transfer problem
+   * @param reuse_jacobian Whether a repeated solve of the timestep reuses the Jacobian of the previous solve (see
+   * EquationSolver::reuseJacobian())
+   * @note Adaptive timestepping and the generalized-alpha method (which depends on the history of previous steps)
+   * are not supported
+   */
+  void solveTimestep(double dt, bool reuse_jacobian = false)
+  {
+    SLIC_ERROR_ROOT_IF(adaptive_timestepping_, "HeatTransfer::solveTimestep() does not support adaptive timestepping");
+    SLIC_ERROR_ROOT_IF(!is_quasistatic_ && ode_.GetTimestepper() == TimestepMethod::GeneralizedAlpha,
+                       "HeatTransfer::solveTimestep() does not support the generalized-alpha method");
+
+    if (timestep_in_progress_) {
+      SLIC_ERROR_ROOT_IF(dt != timestep_dt_, "Every solve of a timestep in HeatTransfer must use the same dt");
+      time_ = timestep_start_time_;
+      if (!is_quasistatic_) {
+        temperature_ = timestep_start_temperature_;
+      }
+      nonlin_solver_->reuseJacobian(reuse_jacobian);
+    } else {
+      nonlin_solver_->resetStatistics();
+      timestep_start_time_        = time_;
+      timestep_start_temperature_ = temperature_;
+      timestep_dt_                = dt;
+      timestep_in_progress_       = true;
     }
+
+    // the parameters may have changed since the residual was last linearized
+    residual_with_bcs_.resetLinearization();
+
+    solveStep(dt);
+    nonlin_solver_->reuseJacobian(false);
+  }
+
+  /**
+   * @brief Complete the timestep most recently solved by solveTimestep()
+   */
+  void completeTimestep()
+  {
+    SLIC_ERROR_ROOT_IF(!timestep_in_progress_, "HeatTransfer::completeTimestep() requires a call to solveTimestep()");
+
+    timestep_in_progress_ = false;
+    finalizeTimestep(timestep_dt_);
+  }
+
+  /// @overload
+  std::map<std::string, double> solverDiagnostics() const override
+  {
+    return nonlin_solver_->statistics().diagnostics();
   }
 
   /**
@@ -688,6 +775,30 @@ public:
     return adjoint_temperature_;
   }
 
+  /**
+   * @brief The Jacobian given to the linear solver: assembled (with its essential rows and columns eliminated into
+   * J_e_), or only its action when the p-multigrid preconditioner forms its levels from the element matrices
+   *
+   * @param jacobian The unassembled Jacobian (e.g. the derivative of the residual computed by Functional)
+   * @return The Jacobian, which is valid until the next call
+   */
+  template <typename Jacobian>
+  mfem::Operator& linearSolverJacobian(Jacobian& jacobian)
+  {
+    jacobian_element_matrices_ = [&jacobian](const ElementMatrixVisitor& visit) {
+      jacobian.forEachElementMatrix(visit);
+    };
+
+    if (matrix_free_jacobian_) {
+      J_action_ = std::make_unique<mfem::ConstrainedOperator>(&jacobian, bcs_.allEssentialTrueDofs());
+      return *J_action_;
+    }
+
+    J_   = assemble(jacobian);
+    J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+    return *J_;
+  }
+
   /**
    * @brief Complete the initialization and allocation of the data structures.
    *
@@ -700,8 +811,9 @@ public:
 
     if (is_quasistatic_) {
       residual_with_bcs_ = mfem_ext::StdFunctionOperator(
-          temperature_.space().TrueVSize(),
+          temperature_.space().TrueVSize(), mfem_ext::StdFunctionOperator::linearize_on_mult,
 
+          // residual function
           [this](const mfem::Vector& u, mfem::Vector& r) {
             const mfem::Vector res = (*residual_)(ode_time_point_, shape_displacement_, u, temperature_rate_,
                                                   *parameters_[parameter_indices].state...);
@@ -713,49 +825,52 @@ public:
             r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
           },
 
-          [this](const mfem::Vector& u) -> mfem::Operator& {
-            auto [r, drdu] = (*residual_)(ode_time_point_, shape_displacement_, differentiate_wrt(u), temperature_rate_,
-                                          *parameters_[parameter_indices].state...);
-            J_             = assemble(drdu);
-            J_e_           = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
-            return *J_;
+          // residual function, which also computes the q-function derivatives needed by its gradient
+          [this](const mfem::Vector& u, mfem::Vector& r) -> mfem_ext::StdFunctionOperator::Linearization {
+            auto evaluation = (*residual_)(ode_time_point_, shape_displacement_, differentiate_wrt(u),
+                                           temperature_rate_, *parameters_[parameter_indices].state...);
+
+            // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
+            // tracking strategy
+            // See https://github.com/mfem/mfem/issues/3531
+            r = get<VALUE>(evaluation);
+            r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+
+            // gradient of residual function, formed only if the solver asks for it
+            return [this, drdu = &get<DERIVATIVE>(evaluation)]() -> mfem::Operator& {
+              return linearSolverJacobian(*drdu);
+            };
           });
     } else {
       residual_with_bcs_ = mfem_ext::StdFunctionOperator(
-          temperature_.space().TrueVSize(),
+          temperature_.space().TrueVSize(), mfem_ext::StdFunctionOperator::linearize_on_mult,
 
+          // residual function, at trial points where the solver doesn't need the jacobian
           [this](const mfem::Vector& du_dt, mfem::Vector& r) {
             add(1.0, u_, dt_, du_dt, u_predicted_);
+
             const mfem::Vector res = (*residual_)(ode_time_point_, shape_displacement_, u_predicted_, du_dt,
                                                   *parameters_[parameter_indices].state...);
 
-            // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
-            // tracking strategy
-            // See https://github.com/mfem/mfem/issues/3531
             r = res;
             r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
           },
 
-          [this](const mfem::Vector& du_dt) -> mfem::Operator& {
+          [this](const mfem::Vector& du_dt, mfem::Vector& r) -> mfem_ext::StdFunctionOperator::Linearization {
             add(1.0, u_, dt_, du_dt, u_predicted_);
 
             // K := dR/du
-            auto K = serac::get<DERIVATIVE>((*residual_)(ode_time_point_, shape_displacement_,
-                                                         differentiate_wrt(u_predicted_), du_dt,
-                                                         *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-            // M := dR/du_dot
-            auto M = serac::get<DERIVATIVE>((*residual_)(ode_time_point_, shape_displacement_, u_predicted_,
-                                                         differentiate_wrt(du_dt),
-                                                         *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
-
-            // J := M + dt K
-            J_.reset(mfem::Add(1.0, *m_mat, dt_, *k_mat));
-            J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
-
-            return *J_;
+            // the residual, and the derivatives for J := M + dt K = dR/du_dot + dt * dR/du, computed in a single pass
+            auto evaluation = (*residual_)(ode_time_point_, shape_displacement_, differentiate_wrt(u_predicted_, dt_),
+                                           differentiate_wrt(du_dt), *parameters_[parameter_indices].state...);
+
+            // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
+            // tracking strategy
+            // See https://github.com/mfem/mfem/issues/3531
+            r = get<VALUE>(evaluation);
+            r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+
+            return [this, J = &get<DERIVATIVE>(evaluation)]() -> mfem::Operator& { return linearSolverJacobian(*J); };
           });
     }
 
@@ -768,6 +883,8 @@ public:
         checkpoint_states_[state_name].push_back(state(state_name));
       }
     }
+
+    logMemoryUsage("after completeSetup");
   }
 
   /**
@@ -1006,6 +1123,58 @@ public:
   virtual ~HeatTransfer() = default;
 
 protected:
+  /**
+   * @brief Solve for the temperature at the end of a timestep of size dt, starting from the current time
+   *
+   * @param dt The size of the timestep
+   */
+  void solveStep(double dt)
+  {
+    if (is_quasistatic_) {
+      time_ += dt;
+
+      // Set the ODE time point for the time-varying loads in quasi-static problems
+      ode_time_point_ = time_;
+
+      // Project the essential boundary coefficients
+      for (auto& bc : bcs_.essentials()) {
+        bc.setDofs(temperature_, time_);
+      }
+      nonlin_solver_->solve(temperature_);
+    } else {
+      // Step the time integrator
+      // Note that the ODE solver handles the essential boundary condition application itself
+      ode_.Step(temperature_, time_, dt);
+    }
+  }
+
+  /**
+   * @brief Record a completed timestep: increment the cycle, checkpoint the states and store the step size
+   *
+   * @param dt The size of the timestep that was just taken
+   */
+  void finalizeTimestep(double dt)
+  {
+    cycle_ += 1;
+
+    if (checkpoint_to_disk_) {
+      outputStateToDisk();
+    } else {
+      auto state_names = stateNames();
+      for (const auto& state_name : state_names) {
+        checkpoint_states_[state_name].push_back(state(state_name));
+      }
+    }
+
+    if (cycle_ > max_cycle_) {
+      timesteps_.push_back(dt);
+      max_cycle_ = cycle_;
+      max_time_  = time_;
+    }
+
+    logMemoryUsageAtEndOfCycle();
+  }
+
   /// The compile-time finite element trial space for heat transfer (H1 of order p)
   using scalar_trial = H1<order>;
 
@@ -1065,12 +1234,39 @@ protected:
   /// because are associated with essential boundary conditions
   std::unique_ptr<mfem::HypreParMatrix> J_e_;
 
+  /// Unassembled counterpart of J_, with the same essential boundary condition treatment
+  std::unique_ptr<mfem::ConstrainedOperator> J_action_;
+
+  /// Whether the linear solver is given J_action_ instead of J_ (for the LOR and p-multigrid preconditioners)
+  bool matrix_free_jacobian_ = false;
+
+  /// Visits the element matrices of the most recent Jacobian
+  ElementMatrixSource jacobian_element_matrices_;
+
   /// The current timestep
   double dt_;
 
   /// The previous timestep
   double previous_dt_;
 
+  /// Whether the size of each timestep is chosen adaptively from an estimate of the local error
+  bool adaptive_timestepping_ = false;
+
+  /// The size of the next timestep suggested by the adaptive timestep controller (negative if unset)
+  double next_dt_ = -1.0;
+
+  /// Whether solveTimestep() has solved a timestep that has not been completed yet
+  bool timestep_in_progress_ = false;
+
+  /// The size of the timestep being solved by solveTimestep()
+  double timestep_dt_ = 0.0;
+
+  /// The time at the start of the timestep being solved by solveTimestep()
+  double timestep_start_time_ = 0.0;
+
+  /// The temperature at the start of the timestep being solved by solveTimestep()
+  mfem::Vector timestep_start_temperature_;
+
   /// Predicted temperature true dofs
   mfem::Vector u_;
 
@@ -44,6 +44,39 @@ struct LinearIsotropic {
     return lambda * tr(epsilon) * I + 2.0 * G * epsilon;
   }
 
+  /**
+   * @brief stress calculation for all of the quadrature points of an element at once
+   *
+   * This gives the same stress as operator(), but is written as branch-free loops over the quadrature
+   * points, which the compiler can vectorize (see domain_integral::has_batch_evaluation_v).
+   *
+   * @tparam T Number-like type for the displacement gradient components
+   * @tparam dim Dimensionality of space
+   * @tparam n The number of quadrature points
+   * @param du_dX Displacement gradients with respect to the reference configuration
+   * @return The Cauchy stress at each quadrature point
+   */
+  template <typename T, int dim, int n>
+  SERAC_HOST_DEVICE auto batch(tensor<State, n>& /* states */, const tensor<tensor<T, dim, dim>, n>& du_dX) const
+  {
+    const double lambda = K - (2.0 / 3.0) * G;
+
+    tensor<tensor<T, dim, dim>, n> sigma{};
+    for (int q = 0; q < n; q++) {
+      auto tr_epsilon = du_dX[q][0][0];
+      for (int i = 1; i < dim; i++) {
+        tr_epsilon += du_dX[q][i][i];
+      }
+      for (int i = 0; i < dim; i++) {
+        for (int j = 0; j < dim; j++) {
+          sigma[q][i][j] = G * (du_dX[q][i][j] + du_dX[q][j][i]);
+        }
+        sigma[q][i][i] += lambda * tr_epsilon;
+      }
+    }
+    return sigma;
+  }
+
   double density;  ///< mass density
   double K;        ///< bulk modulus
   double G;        ///< shear modulus
@@ -121,6 +154,45 @@ struct NeoHookean {
     return (lambda * log1p(J_minus_1) * I + G * B_minus_I) / J;
   }
 
+  /**
+   * @brief stress calculation for all of the quadrature points of an element at once
+   *
+   * This gives the same stress as operator(), split into branch-free loops over the quadrature points
+   * (the volume change, its logarithm, and the stress), which the compiler can vectorize
+   * (see domain_integral::has_batch_evaluation_v).
+   *
+   * @tparam T Number-like type for the displacement gradient components
+   * @tparam dim Dimensionality of space
+   * @tparam n The number of quadrature points
+   * @param du_dX Displacement gradients with respect to the reference configuration
+   * @return The Cauchy stress at each quadrature point
+   */
+  template <typename T, int dim, int n>
+  SERAC_HOST_DEVICE auto batch(tensor<State, n>& /* states */, const tensor<tensor<T, dim, dim>, n>& du_dX) const
+  {
+    using std::log1p;
+    constexpr auto I      = Identity<dim>();
+    const double   lambda = K - (2.0 / 3.0) * G;
+
+    using scalar_type = decltype(detApIm1(du_dX[0]));
+    tensor<scalar_type, n> J_minus_1{};
+    for (int q = 0; q < n; q++) {
+      J_minus_1[q] = detApIm1(du_dX[q]);
+    }
+
+    tensor<scalar_type, n> log_J{};
+    for (int q = 0; q < n; q++) {
+      log_J[q] = log1p(J_minus_1[q]);
+    }
+
+    tensor<tensor<T, dim, dim>, n> sigma{};
+    for (int q = 0; q < n; q++) {
+      auto B_minus_I = du_dX[q] * transpose(du_dX[q]) + transpose(du_dX[q]) + du_dX[q];
+      sigma[q]       = (lambda * log_J[q] * I + G * B_minus_I) / (J_minus_1[q] + 1);
+    }
+    return sigma;
+  }
+
   double density;  ///< mass density
   double K;        ///< bulk modulus
   double G;        ///< shear modulus
@@ -195,6 +267,41 @@ struct VoceHardening {
   };
 };
 
+/**
+ * @brief Evaluate a stress response that is linear in the displacement gradient, given its value and its
+ * (constant) tangent. When the displacement gradient carries derivative information, the derivatives of the
+ * stress are obtained by applying the tangent directly, rather than propagating dual numbers through the
+ * constitutive update.
+ *
+ * @param C the tangent, d(stress) / d(du_dX)
+ * @param stress the value of the stress
+ * @param du_dX the displacement gradient (possibly a tensor of dual numbers)
+ */
+template <typename T, int dim>
+SERAC_HOST_DEVICE auto apply_constant_tangent(const isotropic_tensor<double, dim, dim, dim, dim>& C,
+                                              const tensor<double, dim, dim>& stress, const tensor<T, dim, dim>& du_dX)
+{
+  if constexpr (is_dual_number<T>::value) {
+    // C(i,j,k,l) * dH(k,l) := c1 * tr(dH) * I + 0.5 * (c2 + c3) * dH + 0.5 * (c2 - c3) * transpose(dH)
+    decltype(du_dX[0][0].gradient) trace{};
+    for (int k = 0; k < dim; k++) {
+      trace = trace + du_dX[k][k].gradient;
+    }
+
+    tensor<T, dim, dim> output{};
+    for (int i = 0; i < dim; i++) {
+      for (int j = 0; j < dim; j++) {
+        output[i][j].value    = stress[i][j];
+        output[i][j].gradient = (0.5 * (C.c2 + C.c3)) * du_dX[i][j].gradient +
+                                (0.5 * (C.c2 - C.c3)) * du_dX[j][i].gradient + (C.c1 * (i == j)) * trace;
+      }
+    }
+    return output;
+  } else {
+    return stress;
+  }
+}
+
 /// @brief J2 material with nonlinear isotropic hardening.
 template <typename HardeningType>
 struct J2Nonlinear {
@@ -212,6 +319,14 @@ struct J2Nonlinear {
     double                   accumulated_plastic_strain;  ///< uniaxial equivalent plastic strain
   };
 
+  /** @brief the tangent of the stress with respect to the displacement gradient, for elastic loading */
+  SERAC_HOST_DEVICE auto elastic_tangent() const
+  {
+    const double K = E / (3.0 * (1.0 - 2.0 * nu));
+    const double G = 0.5 * E / (1.0 + nu);
+    return isotropic_tensor<double, dim, dim, dim, dim>{K - (2.0 / 3.0) * G, 2.0 * G, 0.0};
+  }
+
   /** @brief calculate the Cauchy stress, given the displacement gradient and previous material state */
   template <typename T>
   auto operator()(State& state, const T du_dX) const
@@ -221,34 +336,42 @@ struct J2Nonlinear {
     const double   K = E / (3.0 * (1.0 - 2.0 * nu));
     const double   G = 0.5 * E / (1.0 + nu);
 
-    // (i) elastic predictor
-    auto el_strain = sym(du_dX) - state.plastic_strain;
-    auto p         = K * tr(el_strain);
-    auto s         = 2.0 * G * dev(el_strain);
-    auto q         = sqrt(1.5) * norm(s);
+    // (i) elastic predictor, evaluated without derivative information
+    const tensor<double, dim, dim> trial_strain = sym(get_value(du_dX)) - state.plastic_strain;
+    const tensor<double, dim, dim> trial_stress = 2.0 * G * dev(trial_strain) + K * tr(trial_strain) * I;
 
     // (ii) admissibility
     const double eqps_old = state.accumulated_plastic_strain;
     auto         residual = [eqps_old, G, *this](auto delta_eqps, auto trial_mises) {
       return trial_mises - 3.0 * G * delta_eqps - this->hardening(eqps_old + delta_eqps);
     };
-    if (residual(0.0, get_value(q)) > tol * hardening.sigma_y) {
-      // (iii) return mapping
 
-      // Note the tolerance for convergence is the same as the tolerance for entering the return map.
-      // This ensures that if the constitutive update is called again with the updated internal
-      // variables, the return map won't be repeated.
-      ScalarSolverOptions opts{.xtol = 0, .rtol = tol * hardening.sigma_y, .max_iter = 25};
-      double              lower_bound = 0.0;
-      double              upper_bound = (get_value(q) - hardening(eqps_old)) / (3.0 * G);
-      auto [delta_eqps, status]       = solve_scalar_equation(residual, 0.0, lower_bound, upper_bound, opts, q);
+    // most quadrature points remain elastic during a given step. In that case, the stress is
+    // linear in du_dX, so its derivatives are given by the elastic tangent
+    if (residual(0.0, sqrt(1.5) * norm(dev(trial_stress))) <= tol * hardening.sigma_y) {
+      return apply_constant_tangent(elastic_tangent(), trial_stress, du_dX);
+    }
 
-      auto Np = 1.5 * s / q;
+    auto el_strain = sym(du_dX) - state.plastic_strain;
+    auto p         = K * tr(el_strain);
+    auto s         = 2.0 * G * dev(el_strain);
+    auto q         = sqrt(1.5) * norm(s);
 
-      s = s - 2.0 * G * delta_eqps * Np;
-      state.accumulated_plastic_strain += get_value(delta_eqps);
-      state.plastic_strain += get_value(delta_eqps) * get_value(Np);
-    }
+    // (iii) return mapping
+
+    // Note the tolerance for convergence is the same as the tolerance for entering the return map.
+    // This ensures that if the constitutive update is called again with the updated internal
+    // variables, the return map won't be repeated.
+    ScalarSolverOptions opts{.xtol = 0, .rtol = tol * hardening.sigma_y, .max_iter = 25};
+    double              lower_bound = 0.0;
+    double              upper_bound = (get_value(q) - hardening(eqps_old)) / (3.0 * G);
+    auto [delta_eqps, status]       = solve_scalar_equation(residual, 0.0, lower_bound, upper_bound, opts, q);
+
+    auto Np = 1.5 * s / q;
+
+    s = s - 2.0 * G * delta_eqps * Np;
+    state.accumulated_plastic_strain += get_value(delta_eqps);
+    state.plastic_strain += get_value(delta_eqps) * get_value(Np);
 
     return s + p * I;
   }
@@ -273,6 +396,14 @@ struct J2 {
     double                   accumulated_plastic_strain;  ///< incremental plastic strain
   };
 
+  /** @brief the tangent of the stress with respect to the displacement gradient, for elastic loading */
+  SERAC_HOST_DEVICE auto elastic_tangent() const
+  {
+    const double K = E / (3.0 * (1.0 - 2.0 * nu));
+    const double G = 0.5 * E / (1.0 + nu);
+    return isotropic_tensor<double, dim, dim, dim, dim>{K - (2.0 / 3.0) * G, 2.0 * G, 0.0};
+  }
+
   /** @brief calculate the Cauchy stress, given the displacement gradient and previous material state */
   template <typename T>
   auto operator()(State& state, const T du_dX) const
@@ -287,7 +418,19 @@ struct J2 {
     // in "Computational Methods for Plasticity"
     //
 
-    // (i) elastic predictor
+    // (i) elastic predictor, evaluated without derivative information
+    const tensor<double, dim, dim> trial_strain = sym(get_value(du_dX)) - state.plastic_strain;
+    const tensor<double, dim, dim> trial_stress = 2.0 * G * dev(trial_strain) + K * tr(trial_strain) * I;
+    const double                   trial_q      = sqrt(3.0 / 2.0) * norm(dev(trial_stress) - state.beta);
+
+    // (ii) admissibility
+    //
+    // most quadrature points remain elastic during a given step. In that case, the stress is
+    // linear in du_dX, so its derivatives are given by the elastic tangent
+    if (trial_q - (sigma_y + Hi * state.accumulated_plastic_strain) <= 0.0) {
+      return apply_constant_tangent(elastic_tangent(), trial_stress, du_dX);
+    }
+
     auto el_strain = sym(du_dX) - state.plastic_strain;
     auto p         = K * tr(el_strain);
     auto s         = 2.0 * G * dev(el_strain);
@@ -295,21 +438,18 @@ struct J2 {
     auto q         = sqrt(3.0 / 2.0) * norm(eta);
     auto phi       = q - (sigma_y + Hi * state.accumulated_plastic_strain);
 
-    // (ii) admissibility
-    if (phi > 0.0) {
-      // see (7.207) on pg. 261
-      auto plastic_strain_inc = phi / (3 * G + Hk + Hi);
+    // see (7.207) on pg. 261
+    auto plastic_strain_inc = phi / (3 * G + Hk + Hi);
 
-      // from here on, only normalize(eta) is required
-      // so we overwrite eta with its normalized version
-      eta = normalize(eta);
+    // from here on, only normalize(eta) is required
+    // so we overwrite eta with its normalized version
+    eta = normalize(eta);
 
-      // (iii) return mapping
-      s = s - sqrt(6.0) * G * plastic_strain_inc * eta;
-      state.accumulated_plastic_strain += get_value(plastic_strain_inc);
-      state.plastic_strain += sqrt(3.0 / 2.0) * get_value(plastic_strain_inc) * get_value(eta);
-      state.beta = state.beta + sqrt(2.0 / 3.0) * Hk * get_value(plastic_strain_inc) * get_value(eta);
-    }
+    // (iii) return mapping
+    s = s - sqrt(6.0) * G * plastic_strain_inc * eta;
+    state.accumulated_plastic_strain += get_value(plastic_strain_inc);
+    state.plastic_strain += sqrt(3.0 / 2.0) * get_value(plastic_strain_inc) * get_value(eta);
+    state.beta = state.beta + sqrt(2.0 / 3.0) * Hk * get_value(plastic_strain_inc) * get_value(eta);
 
     return s + p * I;
   }
@@ -54,6 +54,41 @@ TEST(NonlinearJ2Material, SatisfiesConsistency)
   EXPECT_LT(norm(s - dev(stress)) / norm(s), 1e-9);
 };
 
+TEST(NonlinearJ2Material, ElasticTangentMatchesLinearIsotropic)
+{
+  // clang-format off
+  tensor<double, 3, 3> du_dx{
+      {{0.7551559, 0.3129729, 0.12388372},
+       {0.548188, 0.8851279, 0.30576992},
+       {0.82008433, 0.95633745, 0.3566252}}
+  };
+  // clang-format on
+
+  // a displacement gradient small enough that the response is elastic
+  du_dx = 1.0e-4 * du_dx;
+
+  using Hardening = solid_mechanics::LinearHardening;
+  using Material  = solid_mechanics::J2Nonlinear<Hardening>;
+
+  double E  = 1.0;
+  double nu = 0.25;
+
+  Hardening hardening{.sigma_y = 0.01, .Hi = E / 100.0};
+  Material  material{.E = E, .nu = nu, .hardening = hardening, .density = 1.0};
+
+  solid_mechanics::LinearIsotropic linear_material{
+      .density = 1.0, .K = E / (3.0 * (1.0 - 2.0 * nu)), .G = 0.5 * E / (1.0 + nu)};
+
+  auto  internal_state = Material::State{};
+  Empty empty_state{};
+  auto  stress        = material(internal_state, make_dual(du_dx));
+  auto  linear_stress = linear_material(empty_state, make_dual(du_dx));
+
+  EXPECT_LT(norm(get_value(stress) - get_value(linear_stress)), 1e-12 * norm(get_value(linear_stress)));
+  EXPECT_LT(norm(get_gradient(stress) - get_gradient(linear_stress)), 1e-12 * norm(get_gradient(linear_stress)));
+  EXPECT_EQ(internal_state.accumulated_plastic_strain, 0.0);
+};
+
 TEST(NonlinearJ2Material, Uniaxial)
 {
   using Hardening = solid_mechanics::LinearHardening;
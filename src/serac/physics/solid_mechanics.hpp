@@ -20,6 +20,7 @@
 #include "serac/physics/base_physics.hpp"
 #include "serac/numerics/odes.hpp"
 #include "serac/numerics/stdfunction_operator.hpp"
+#include "serac/numerics/single_precision_amg.hpp"
 #include "serac/numerics/functional/shape_aware_functional.hpp"
 #include "serac/physics/state/state_manager.hpp"
 #include "serac/physics/materials/solid_material.hpp"
@@ -195,11 +196,26 @@ public:
     if (timestepping_opts.timestepper != TimestepMethod::QuasiStatic) {
       ode2_.SetTimestepper(timestepping_opts.timestepper);
       ode2_.SetEnforcementMethod(timestepping_opts.enforcement_method);
+      ode2_.SetAdaptiveOptions(timestepping_opts.adaptive);
       is_quasistatic_ = false;
     } else {
       is_quasistatic_ = true;
     }
 
+    adaptive_options_      = timestepping_opts.adaptive;
+    adaptive_timestepping_ = timestepping_opts.adaptive.enabled;
+
+    // central difference is integrated explicitly with a lumped mass matrix, without calling the nonlinear solver
+    explicit_dynamics_ = (timestepping_opts.timestepper == TimestepMethod::CentralDifference);
+    SLIC_ERROR_ROOT_IF(explicit_dynamics_ && adaptive_timestepping_,
+                       "Adaptive timestepping is not supported for explicit (central difference) dynamics");
+    SLIC_ERROR_ROOT_IF(timestepping_opts.output_interval < 1, "The output interval must be at least one cycle");
+
+    // explicit dynamics has no transient adjoint, so it only needs its states at the cycles that are output
+    if (explicit_dynamics_) {
+      checkpoint_interval_ = timestepping_opts.output_interval;
+    }
+
     states_.push_back(&displacement_);
     if (!is_quasistatic_) {
       states_.push_back(&velocity_);
@@ -237,16 +253,38 @@ public:
     residual_ = std::make_unique<ShapeAwareFunctional<shape_trial, test(trial, trial, parameter_space...)>>(
         shape_space, test_space, trial_spaces);
 
-    // If the user wants the AMG preconditioner with a linear solver, set the pfes
-    // to be the displacement
-    auto* amg_prec = dynamic_cast<mfem::HypreBoomerAMG*>(&nonlin_solver_->preconditioner());
-    if (amg_prec) {
-      // amg_prec->SetElasticityOptions(&displacement_.space());
-
-      // TODO: The above call was seg faulting in the HYPRE_BoomerAMGSetInterpRefine(amg_precond, interp_refine)
-      // method as of Hypre version v2.26.0. Instead, we just set the system size for Hypre. This is a temporary work
-      // around as it will decrease the effectiveness of the preconditioner.
-      amg_prec->SetSystemsOptions(dim, true);
+    // a reused preconditioner is rebuilt when the essential boundary conditions change
+    nonlin_solver_->setEssentialDofs([this]() -> const mfem::Array<int>& { return bcs_.allEssentialTrueDofs(); });
+
+    // If the user wants the AMG preconditioner with a linear solver, give it the rigid body
+    // modes of the displacement space as a near-nullspace
+    if (auto* amg_prec = dynamic_cast<BoomerAMG*>(&nonlin_solver_->preconditioner())) {
+      amg_prec->setElasticityNearNullspace(displacement_.space());
+    } else if (auto* mfem_amg_prec = dynamic_cast<mfem::HypreBoomerAMG*>(&nonlin_solver_->preconditioner())) {
+      // a user-supplied mfem::HypreBoomerAMG: just set the system size for hypre
+      mfem_amg_prec->SetSystemsOptions(dim, true);
+    } else if (auto* single_amg_prec = dynamic_cast<SinglePrecisionAMG*>(&nonlin_solver_->preconditioner())) {
+      single_amg_prec->setElasticityNearNullspace(displacement_.space());
+    } else if (auto* block_prec = dynamic_cast<BlockSchurPreconditioner*>(&nonlin_solver_->preconditioner())) {
+      block_prec->setElasticityNearNullspace(displacement_.space());
+    } else if (auto* lor_prec = dynamic_cast<LORPreconditioner*>(&nonlin_solver_->preconditioner())) {
+      // the LOR preconditioner fits its low-order model to the element matrices, so the Jacobian isn't assembled
+      lor_prec->setSpace(
+          displacement_.space(), [this]() -> const mfem::Array<int>& { return bcs_.allEssentialTrueDofs(); },
+          [this](const ElementMatrixVisitor& visit) {
+            SLIC_ERROR_ROOT_IF(!jacobian_element_matrices_, "The Jacobian has not been linearized yet");
+            jacobian_element_matrices_(visit);
+          });
+      matrix_free_jacobian_ = true;
+    } else if (auto* pmg_prec = dynamic_cast<PMultigridPreconditioner*>(&nonlin_solver_->preconditioner())) {
+      // the p-multigrid preconditioner forms its levels from the element matrices, so the Jacobian isn't assembled
+      pmg_prec->setSpace(
+          displacement_.space(), [this]() -> const mfem::Array<int>& { return bcs_.allEssentialTrueDofs(); },
+          [this](const ElementMatrixVisitor& visit) {
+            SLIC_ERROR_ROOT_IF(!jacobian_element_matrices_, "The Jacobian has not been linearized yet");
+            jacobian_element_matrices_(visit);
+          });
+      matrix_free_jacobian_ = true;
     }
 
     int true_size = velocity_.space().TrueVSize();
@@ -360,8 +398,11 @@ public:
    */
   void initializeSolidMechanicsStates()
   {
-    c0_ = 0.0;
-    c1_ = 0.0;
+    c0_      = 0.0;
+    c1_      = 0.0;
+    next_dt_ = -1.0;
+
+    explicit_acceleration_is_current_ = false;
 
     displacement_ = 0.0;
     velocity_     = 0.0;
@@ -671,14 +712,14 @@ public:
   {
     if (state_name == "displacement") {
       displacement_ = state;
-      if (!checkpoint_to_disk_) {
-        checkpoint_states_["displacement"][static_cast<size_t>(cycle_)] = displacement_;
+      if (!checkpoint_to_disk_ && isCheckpointCycle(cycle_)) {
+        checkpoint_states_["displacement"][checkpointIndex(cycle_)] = displacement_;
       }
       return;
     } else if (state_name == "velocity") {
       velocity_ = state;
-      if (!checkpoint_to_disk_) {
-        checkpoint_states_["velocity"][static_cast<size_t>(cycle_)] = velocity_;
+      if (!checkpoint_to_disk_ && isCheckpointCycle(cycle_)) {
+        checkpoint_states_["velocity"][checkpointIndex(cycle_)] = velocity_;
       }
       return;
     }
@@ -857,6 +898,50 @@ public:
 
       return serac::tuple{material_.density * d2u_dt2, flux};
     }
+
+    /**
+     * @brief Material stress response at all of the quadrature points of an element, for materials that
+     * provide a batched stress calculation (see domain_integral::has_batch_evaluation_v)
+     *
+     * @tparam X Spatial position type
+     * @tparam State state
+     * @tparam Displacement displacement
+     * @tparam Acceleration acceleration
+     * @tparam n The number of quadrature points
+     * @param[in] states state at each quadrature point
+     * @param[in] displacement displacement at each quadrature point
+     * @param[in] acceleration acceleration at each quadrature point
+     * @return The material response at each quadrature point, as given by operator()
+     */
+    template <typename X, typename State, typename Displacement, typename Acceleration, int n,
+              typename Gradient = std::decay_t<decltype(get<DERIVATIVE>(std::declval<Displacement>()))>,
+              typename = decltype(std::declval<const Material&>().batch(std::declval<tensor<State, n>&>(),
+                                                                        std::declval<const tensor<Gradient, n>&>()))>
+    auto SERAC_HOST_DEVICE batch(double t, const tensor<X, n>& x, tensor<State, n>& states,
+                                 const tensor<Displacement, n>& displacement,
+                                 const tensor<Acceleration, n>& acceleration) const
+    {
+      tensor<Gradient, n> du_dX{};
+      for (int q = 0; q < n; q++) {
+        du_dX[q] = get<DERIVATIVE>(displacement[q]);
+      }
+
+      auto stress = material_.batch(states, du_dX);
+
+      using output_type = decltype((*this)(t, x[0], states[0], displacement[0], acceleration[0]));
+      tensor<output_type, n> outputs{};
+      for (int q = 0; q < n; q++) {
+        auto dx_dX = 0.0 * du_dX[q] + I;
+
+        if (geom_nonlin_ == GeometricNonlinearities::On) {
+          dx_dX += du_dX[q];
+        }
+
+        auto flux  = dot(stress[q], transpose(inv(dx_dX))) * det(dx_dX);
+        outputs[q] = serac::tuple{material_.density * get<VALUE>(acceleration[q]), flux};
+      }
+      return outputs;
+    }
   };
 
   /**
@@ -1115,13 +1200,49 @@ public:
     setPressure(DependsOn<>{}, pressure_function, optional_domain);
   }
 
+  /**
+   * @brief The action of a Jacobian without assembling it, with its essential rows and columns replaced by
+   * the identity like those of J_
+   *
+   * @param jacobian The unassembled Jacobian (e.g. the derivative of the residual computed by Functional)
+   * @return The constrained Jacobian, which is valid until the next call
+   */
+  mfem::Operator& jacobianAction(mfem::Operator& jacobian)
+  {
+    J_action_ = std::make_unique<mfem::ConstrainedOperator>(&jacobian, bcs_.allEssentialTrueDofs());
+    return *J_action_;
+  }
+
+  /**
+   * @brief The Jacobian given to the linear solver: assembled (with its essential rows and columns eliminated into
+   * J_e_), or only its action when the p-multigrid preconditioner forms its levels from the element matrices
+   *
+   * @param jacobian The unassembled Jacobian (e.g. the derivative of the residual computed by Functional)
+   * @return The Jacobian, which is valid until the next call
+   */
+  template <typename Jacobian>
+  mfem::Operator& linearSolverJacobian(Jacobian& jacobian)
+  {
+    jacobian_element_matrices_ = [&jacobian](const ElementMatrixVisitor& visit) {
+      jacobian.forEachElementMatrix(visit);
+    };
+
+    if (matrix_free_jacobian_) {
+      return jacobianAction(jacobian);
+    }
+
+    J_   = assemble(jacobian);
+    J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+    return *J_;
+  }
+
   /// @brief Build the quasi-static operator corresponding to the total Lagrangian formulation
   virtual std::unique_ptr<mfem_ext::StdFunctionOperator> buildQuasistaticOperator()
   {
     // the quasistatic case is entirely described by the residual,
     // there is no ordinary differential equation
     return std::make_unique<mfem_ext::StdFunctionOperator>(
-        displacement_.space().TrueVSize(),
+        displacement_.space().TrueVSize(), mfem_ext::StdFunctionOperator::linearize_on_mult,
 
         // residual function
         [this](const mfem::Vector& u, mfem::Vector& r) {
@@ -1135,13 +1256,21 @@ public:
           r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
         },
 
-        // gradient of residual function
-        [this](const mfem::Vector& u) -> mfem::Operator& {
-          auto [r, drdu] = (*residual_)(ode_time_point_, shape_displacement_, differentiate_wrt(u), acceleration_,
-                                        *parameters_[parameter_indices].state...);
-          J_             = assemble(drdu);
-          J_e_           = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
-          return *J_;
+        // residual function, which also computes the q-function derivatives needed by its gradient
+        [this](const mfem::Vector& u, mfem::Vector& r) -> mfem_ext::StdFunctionOperator::Linearizations {
+          auto evaluation = (*residual_)(ode_time_point_, shape_displacement_, differentiate_wrt(u), acceleration_,
+                                         *parameters_[parameter_indices].state...);
+
+          // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
+          // tracking strategy
+          // See https://github.com/mfem/mfem/issues/3531
+          r = get<VALUE>(evaluation);
+          r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+
+          // gradient of residual function, assembled only if the solver asks for it
+          auto* drdu = &get<DERIVATIVE>(evaluation);
+          return {[this, drdu]() -> mfem::Operator& { return linearSolverJacobian(*drdu); },
+                  [this, drdu]() -> mfem::Operator& { return jacobianAction(*drdu); }};
         });
   }
 
@@ -1171,49 +1300,51 @@ public:
 
     if (is_quasistatic_) {
       residual_with_bcs_ = buildQuasistaticOperator();
-    } else {
+    } else if (!explicit_dynamics_) {
       // the dynamic case is described by a residual function and a second order
       // ordinary differential equation. Here, we define the residual function in
       // terms of an acceleration.
       residual_with_bcs_ = std::make_unique<mfem_ext::StdFunctionOperator>(
-          displacement_.space().TrueVSize(),
+          displacement_.space().TrueVSize(), mfem_ext::StdFunctionOperator::linearize_on_mult,
 
+          // residual function, at trial points where the solver doesn't need the jacobian
           [this](const mfem::Vector& d2u_dt2, mfem::Vector& r) {
             add(1.0, u_, c0_, d2u_dt2, predicted_displacement_);
+
             const mfem::Vector res = (*residual_)(ode_time_point_, shape_displacement_, predicted_displacement_,
                                                   d2u_dt2, *parameters_[parameter_indices].state...);
 
-            // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
-            // tracking strategy
-            // See https://github.com/mfem/mfem/issues/3531
             r = res;
             r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
           },
 
-          [this](const mfem::Vector& d2u_dt2) -> mfem::Operator& {
+          [this](const mfem::Vector& d2u_dt2, mfem::Vector& r) -> mfem_ext::StdFunctionOperator::Linearizations {
             add(1.0, u_, c0_, d2u_dt2, predicted_displacement_);
 
-            // K := dR/du
-            auto K = serac::get<DERIVATIVE>((*residual_)(ode_time_point_, shape_displacement_,
-                                                         differentiate_wrt(predicted_displacement_), d2u_dt2,
-                                                         *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-            // M := dR/da
-            auto M = serac::get<DERIVATIVE>((*residual_)(ode_time_point_, shape_displacement_, predicted_displacement_,
-                                                         differentiate_wrt(d2u_dt2),
-                                                         *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
+            // the residual, and the derivatives for J := M + c0 * K = dR/da + c0 * dR/du, computed in a single pass
+            auto evaluation =
+                (*residual_)(ode_time_point_, shape_displacement_, differentiate_wrt(predicted_displacement_, c0_),
+                             differentiate_wrt(d2u_dt2), *parameters_[parameter_indices].state...);
 
-            // J = M + c0 * K
-            J_.reset(mfem::Add(1.0, *m_mat, c0_, *k_mat));
-            J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+            // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
+            // tracking strategy
+            // See https://github.com/mfem/mfem/issues/3531
+            r = get<VALUE>(evaluation);
+            r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
 
-            return *J_;
+            auto* J = &get<DERIVATIVE>(evaluation);
+            return {[this, J]() -> mfem::Operator& { return linearSolverJacobian(*J); },
+                    [this, J]() -> mfem::Operator& { return jacobianAction(*J); }};
           });
     }
 
-    nonlin_solver_->setOperator(*residual_with_bcs_);
+    // explicit dynamics never calls the nonlinear solver, so it doesn't need an operator
+    if (explicit_dynamics_) {
+      computeLumpedMass();
+      explicit_acceleration_is_current_ = false;
+    } else {
+      nonlin_solver_->setOperator(*residual_with_bcs_);
+    }
 
     if (checkpoint_to_disk_) {
       outputStateToDisk();
@@ -1224,6 +1355,8 @@ public:
         checkpoint_states_[state_name].push_back(state(state_name));
       }
     }
+
+    logMemoryUsage("after completeSetup");
   }
 
   /// @brief Set field to zero wherever their are essential boundary conditions applies
@@ -1246,40 +1379,171 @@ public:
       }
     }
 
-    if (is_quasistatic_) {
+    substeps_          = 0;
+    cutbacks_          = 0;
+    newton_iterations_ = 0;
+    nonlin_solver_->resetStatistics();
+
+    // the time, boundary conditions and parameters may have changed since the residual was last linearized
+    if (residual_with_bcs_) {
+      residual_with_bcs_->resetLinearization();
+    }
+
+    if (is_quasistatic_ && adaptive_timestepping_) {
+      adaptiveQuasiStaticSolve(dt);
+      return;
+    } else if (is_quasistatic_) {
       quasiStaticSolve(dt);
+      newton_iterations_ = nonlin_solver_->nonlinearSolver().GetNumIterations();
+    } else if (explicit_dynamics_) {
+      explicitDynamicsStep(dt);
+
+      // the step has already updated the material state and reactions
+      finalizeTimestep(dt, false);
+      substeps_ = 1;
+      return;
+    } else if (adaptive_timestepping_) {
+      const double end_time = time_ + dt;
+      if (next_dt_ <= 0.0) {
+        next_dt_ = dt;
+      }
+
+      while (end_time - time_ > 1.0e-12 * dt) {
+        const double requested = std::min(next_dt_, end_time - time_);
+        double       step      = requested;
+        double       next      = ode2_.AdaptiveStep(displacement_, velocity_, time_, step);
+
+        // a step that was only shortened to land on the end of the interval
+        // shouldn't limit the size of subsequent steps
+        if (requested < next_dt_ && step == requested) {
+          next = std::max(next, next_dt_);
+        }
+        next_dt_ = next;
+
+        finalizeTimestep(step);
+        substeps_ += 1;
+      }
+      return;
     } else {
       ode2_.Step(displacement_, velocity_, time_, dt);
     }
 
-    cycle_ += 1;
+    finalizeTimestep(dt);
+    substeps_ = 1;
+  }
 
-    if (checkpoint_to_disk_) {
-      outputStateToDisk();
+  /**
+   * @brief Solve for the displacement at the end of a quasi-static timestep, without completing the timestep
+   *
+   * This lets coupled physics modules (e.g. Thermomechanics) iterate on a timestep. Until the timestep is completed
+   * by completeTimestep(), every call after the first solves the same timestep again, picking up any changes to the
+   * parameters. These later solves start from the most recent displacement, without a warm start.
+   *
+   * @param dt The increment of simulation time to advance the underlying solid mechanics problem
+   * @param reuse_jacobian Whether a repeated solve of the timestep reuses the Jacobian of the previous solve (see
+   * EquationSolver::reuseJacobian())
+   * @note Only quasi-static problems without adaptive timestepping are supported
+   */
+  void solveTimestep(double dt, bool reuse_jacobian = false)
+  {
+    SLIC_ERROR_ROOT_IF(!residual_, "completeSetup() must be called prior to solveTimestep(dt) in SolidMechanics.");
+    SLIC_ERROR_ROOT_IF(!is_quasistatic_ || adaptive_timestepping_,
+                       "SolidMechanics::solveTimestep() only supports quasi-static problems without adaptive "
+                       "timestepping");
+
+    // the parameters may have changed since the residual was last linearized
+    residual_with_bcs_->resetLinearization();
+
+    if (timestep_in_progress_) {
+      SLIC_ERROR_ROOT_IF(dt != timestep_dt_, "Every solve of a timestep in SolidMechanics must use the same dt");
+
+      // the most recent displacement already satisfies the boundary conditions at the end of the timestep
+      for (auto& parameter : parameters_) {
+        *parameter.previous_state = *parameter.state;
+      }
+      nonlin_solver_->reuseJacobian(reuse_jacobian);
+      nonlin_solver_->solve(displacement_);
+      nonlin_solver_->reuseJacobian(false);
     } else {
-      auto state_names = stateNames();
-      for (const auto& state_name : state_names) {
-        checkpoint_states_[state_name].push_back(state(state_name));
+      if (cycle_ == 0) {
+        for (auto& parameter : parameters_) {
+          *parameter.previous_state = *parameter.state;
+        }
       }
+
+      substeps_          = 0;
+      cutbacks_          = 0;
+      newton_iterations_ = 0;
+      nonlin_solver_->resetStatistics();
+
+      quasiStaticSolve(dt);
+      timestep_dt_          = dt;
+      timestep_in_progress_ = true;
     }
 
-    {
-      // after finding displacements that satisfy equilibrium,
-      // compute the residual one more time, this time enabling
-      // the material state buffers to be updated
-      residual_->updateQdata(true);
+    newton_iterations_ += nonlin_solver_->nonlinearSolver().GetNumIterations();
+  }
 
-      reactions_ = (*residual_)(ode_time_point_, shape_displacement_, displacement_, acceleration_,
-                                *parameters_[parameter_indices].state...);
+  /**
+   * @brief Complete the timestep most recently solved by solveTimestep()
+   */
+  void completeTimestep()
+  {
+    SLIC_ERROR_ROOT_IF(!timestep_in_progress_, "SolidMechanics::completeTimestep() requires a call to solveTimestep()");
 
-      residual_->updateQdata(false);
-    }
+    timestep_in_progress_ = false;
+    finalizeTimestep(timestep_dt_);
+    substeps_ = 1;
+  }
 
-    if (cycle_ > max_cycle_) {
-      timesteps_.push_back(dt);
-      max_cycle_ = cycle_;
-      max_time_  = time_;
+  /**
+   * @brief Estimate the largest stable timestep for explicit (central difference) dynamics
+   *
+   * This is the CFL condition dt < h / (p * c), where h is the smallest element size (the smallest singular
+   * value of the element Jacobian) over the entire mesh, p is the polynomial order of the displacement field
+   * and c is the fastest wave speed in the material. For isotropic materials c = sqrt((K + 4 G / 3) / rho).
+   * The estimate does not account for geometric nonlinearity, so a safety factor is recommended.
+   *
+   * @param wave_speed The largest wave speed in the material
+   * @return The estimated critical timestep
+   */
+  double stableTimestepEstimate(double wave_speed) const
+  {
+    SLIC_ERROR_ROOT_IF(wave_speed <= 0.0, "Wave speed must be positive to estimate a stable timestep");
+
+    double h_min = std::numeric_limits<double>::max();
+    for (int e = 0; e < mesh_.GetNE(); e++) {
+      h_min = std::min(h_min, mesh_.GetElementSize(e, 1));
     }
+    MPI_Allreduce(MPI_IN_PLACE, &h_min, 1, MPI_DOUBLE, MPI_MIN, mesh_.GetComm());
+
+    return h_min / (order * wave_speed);
+  }
+
+  /**
+   * @brief Start (or stop) measuring the time spent evaluating the residual on each element
+   *
+   * @param enable whether or not to measure the per-element costs
+   */
+  void enableElementCosts(bool enable = true) { residual_->enableElementCosts(enable); }
+
+  /**
+   * @brief The time (in seconds) spent evaluating the residual (and its derivatives) on each local
+   * element since `enableElementCosts` was called
+   *
+   * @note These costs can be passed to `StateManager::rebalance` to repartition the mesh
+   */
+  mfem::Vector elementCosts() const { return residual_->elementCosts(); }
+
+  /// @overload
+  std::map<std::string, double> solverDiagnostics() const override
+  {
+    auto diagnostics = nonlin_solver_->statistics().diagnostics();
+    diagnostics.insert({{"substeps", substeps_},
+                        {"cutbacks", cutbacks_},
+                        {"newton_iterations", newton_iterations_},
+                        {"next_dt", next_dt_}});
+    return diagnostics;
   }
 
   /**
@@ -1406,11 +1670,10 @@ public:
           {previous_states.at("displacement"), previous_states.at("velocity"), previous_states.at("acceleration")});
       return previous_states;
     } else {
-      previous_states.emplace("displacement",
-                              checkpoint_states_.at("displacement")[static_cast<size_t>(cycle_to_load)]);
-      previous_states.emplace("velocity", checkpoint_states_.at("velocity")[static_cast<size_t>(cycle_to_load)]);
-      previous_states.emplace("acceleration",
-                              checkpoint_states_.at("acceleration")[static_cast<size_t>(cycle_to_load)]);
+      const auto index = checkpointIndex(cycle_to_load);
+      previous_states.emplace("displacement", checkpoint_states_.at("displacement")[index]);
+      previous_states.emplace("velocity", checkpoint_states_.at("velocity")[index]);
+      previous_states.emplace("acceleration", checkpoint_states_.at("acceleration")[index]);
     }
 
     return previous_states;
@@ -1517,6 +1780,49 @@ public:
   };
 
 protected:
+  /**
+   * @brief Record a completed timestep: increment the cycle, checkpoint the states, update
+   * the material state and reactions, and store the step size
+   *
+   * @param dt The size of the timestep that was just taken
+   * @param update_state Whether to evaluate the residual to update the material state and reactions, which
+   * explicit dynamics has already done during the step
+   */
+  void finalizeTimestep(double dt, bool update_state = true)
+  {
+    cycle_ += 1;
+
+    const bool checkpoint = isCheckpointCycle(cycle_);
+    if (checkpoint && checkpoint_to_disk_) {
+      outputStateToDisk();
+    } else if (checkpoint) {
+      auto state_names = stateNames();
+      for (const auto& state_name : state_names) {
+        checkpoint_states_[state_name].push_back(state(state_name));
+      }
+    }
+
+    if (update_state) {
+      // after finding displacements that satisfy equilibrium,
+      // compute the residual one more time, this time enabling
+      // the material state buffers to be updated
+      residual_->updateQdata(true);
+
+      reactions_ = (*residual_)(ode_time_point_, shape_displacement_, displacement_, acceleration_,
+                                *parameters_[parameter_indices].state...);
+
+      residual_->updateQdata(false);
+    }
+
+    if (cycle_ > max_cycle_) {
+      timesteps_.push_back(dt);
+      max_cycle_ = cycle_;
+      max_time_  = time_;
+    }
+
+    logMemoryUsageAtEndOfCycle();
+  }
+
   /// The compile-time finite element trial space for displacement and velocity (H1 of order p)
   using trial = H1<order, dim>;
 
@@ -1584,6 +1890,15 @@ protected:
   /// because are associated with essential boundary conditions
   std::unique_ptr<mfem::HypreParMatrix> J_e_;
 
+  /// Unassembled counterpart of J_ for matrix-free solvers, with the same essential boundary condition treatment
+  std::unique_ptr<mfem::ConstrainedOperator> J_action_;
+
+  /// Whether the linear solver is given J_action_ instead of J_ (for the LOR and p-multigrid preconditioners)
+  bool matrix_free_jacobian_ = false;
+
+  /// Visits the element matrices of the most recent Jacobian
+  ElementMatrixSource jacobian_element_matrices_;
+
   /// an intermediate variable used to store the predicted end-step displacement
   mfem::Vector predicted_displacement_;
 
@@ -1605,6 +1920,40 @@ protected:
   /// coefficient used to calculate predicted velocity: dudt_p := dudt + c1 * d2u_dt2
   double c1_;
 
+  /// Whether the size of each timestep is chosen adaptively from an estimate of the local error
+  bool adaptive_timestepping_ = false;
+
+  /// The size of the next timestep suggested by the adaptive timestep controller (negative if unset)
+  double next_dt_ = -1.0;
+
+  /// Parameters for the adaptive timestep controller
+  AdaptiveTimesteppingOptions adaptive_options_;
+
+  /// Whether solveTimestep() has solved a timestep that has not been completed yet
+  bool timestep_in_progress_ = false;
+
+  /// The size of the timestep being solved by solveTimestep()
+  double timestep_dt_ = 0.0;
+
+  /// Whether the dynamics are integrated explicitly (central difference with a lumped mass matrix)
+  bool explicit_dynamics_ = false;
+
+  /// Whether the acceleration state is consistent with the current displacement, for explicit dynamics
+  bool explicit_acceleration_is_current_ = false;
+
+  /// The row-sum lumped mass matrix, stored as a true-dof vector, for explicit dynamics
+  mfem::Vector lumped_mass_;
+
+  /// Number of timesteps taken during the most recent call to advanceTimestep
+  int substeps_ = 0;
+
+  /// Number of timestep cutbacks caused by nonlinear solver failures during the most recent call to advanceTimestep
+  int cutbacks_ = 0;
+
+  /// Total number of quasi-static Newton iterations (from converged solves) during the most recent call to
+  /// advanceTimestep
+  int newton_iterations_ = 0;
+
   /// @brief A flag denoting whether to compute geometric nonlinearities in the residual
   GeometricNonlinearities geom_nonlin_;
 
@@ -1640,6 +1989,188 @@ protected:
     nonlin_solver_->solve(displacement_);
   }
 
+  /**
+   * @brief Compute the row-sum lumped mass matrix used for explicit dynamics
+   *
+   * The residual is linear in the acceleration, so its derivative with respect to the acceleration is the
+   * consistent mass matrix, and the action of that derivative on a vector of ones gives the row sums without
+   * assembling the matrix.
+   *
+   * @note Row-sum lumping of quadratic or higher order triangles and tetrahedra gives zero or negative masses
+   * at their vertices, so those elements are not supported by explicit dynamics.
+   */
+  void computeLumpedMass()
+  {
+    auto M = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, displacement_,
+                                                 differentiate_wrt(acceleration_),
+                                                 *parameters_[parameter_indices].state...));
+
+    mfem::Vector ones(acceleration_.Size());
+    ones         = 1.0;
+    lumped_mass_ = M(ones);
+
+    double min_mass = lumped_mass_.Min();
+    MPI_Allreduce(MPI_IN_PLACE, &min_mass, 1, MPI_DOUBLE, MPI_MIN, mesh_.GetComm());
+    SLIC_ERROR_ROOT_IF(min_mass <= 0.0,
+                       "The row-sum lumped mass matrix has non-positive entries. Explicit dynamics requires an element "
+                       "type with positive lumped masses, i.e. linear elements or tensor-product (quad/hex) elements "
+                       "of any order. Quadratic and higher order simplices are not supported.");
+  }
+
+  /**
+   * @brief Set the acceleration to M_L^{-1} (f_ext - f_int(u)), where M_L is the lumped mass matrix
+   *
+   * Since the residual is M a + f_int(u) - f_ext, this only requires evaluating it once with zero acceleration.
+   * The acceleration of the constrained degrees of freedom is set to zero.
+   *
+   * @param update_state Whether this evaluation also updates the material state and the reactions, which are
+   * then consistent with the lumped mass matrix
+   */
+  void computeExplicitAcceleration(bool update_state)
+  {
+    mfem::Vector zero(acceleration_.Size());
+    zero = 0.0;
+
+    residual_->updateQdata(update_state);
+    const mfem::Vector r = (*residual_)(ode_time_point_, shape_displacement_, displacement_, zero,
+                                        *parameters_[parameter_indices].state...);
+    residual_->updateQdata(false);
+
+    for (int i = 0; i < acceleration_.Size(); i++) {
+      acceleration_(i) = -r(i) / lumped_mass_(i);
+    }
+    acceleration_.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+
+    if (update_state) {
+      for (int i = 0; i < reactions_.Size(); i++) {
+        reactions_(i) = r(i) + lumped_mass_(i) * acceleration_(i);
+      }
+    }
+
+    explicit_acceleration_is_current_ = true;
+  }
+
+  /**
+   * @brief Take one explicit central difference (velocity Verlet) step, which requires one residual evaluation
+   * and no matrix assembly or linear solves
+   *
+   * The constrained degrees of freedom take their prescribed values at the end of the step, and their velocity
+   * is the corresponding finite difference. The residual evaluation at the end of the step also updates the
+   * material state and reactions.
+   *
+   * @param dt The size of the timestep
+   */
+  void explicitDynamicsStep(double dt)
+  {
+    if (!explicit_acceleration_is_current_) {
+      ode_time_point_ = time_;
+      computeExplicitAcceleration(false);
+    }
+
+    auto&        constrained_dofs = bcs_.allEssentialTrueDofs();
+    mfem::Vector constrained_start;
+    displacement_.GetSubVector(constrained_dofs, constrained_start);
+
+    velocity_.Add(0.5 * dt, acceleration_);
+    displacement_.Add(dt, velocity_);
+
+    time_ += dt;
+    ode_time_point_ = time_;
+
+    for (auto& bc : bcs_.essentials()) {
+      bc.setDofs(displacement_, time_);
+    }
+
+    computeExplicitAcceleration(true);
+    velocity_.Add(0.5 * dt, acceleration_);
+
+    for (int i = 0; i < constrained_dofs.Size(); i++) {
+      int j        = constrained_dofs[i];
+      velocity_(j) = (displacement_(j) - constrained_start(i)) / dt;
+    }
+  }
+
+  /**
+   * @brief Advance a quasi-static problem by dt, subdividing the interval whenever the nonlinear solver fails
+   *
+   * Each attempted step starts from a copy of the displacement and the previous parameter values. If Newton
+   * does not converge, that copy is restored and the step is retried with a size reduced by
+   * AdaptiveTimesteppingOptions::min_scale. The material state (quadrature data) does not need to be restored, as
+   * it is only committed in finalizeTimestep() once a step has converged. After a step that converges in at most
+   * AdaptiveTimesteppingOptions::easy_newton_iterations iterations, the size of the next step is allowed to grow
+   * by AdaptiveTimesteppingOptions::max_scale.
+   *
+   * @param dt The size of the interval to advance over
+   */
+  void adaptiveQuasiStaticSolve(double dt)
+  {
+    const double end_time = time_ + dt;
+    if (next_dt_ <= 0.0) {
+      next_dt_ = std::min(dt, adaptive_options_.max_dt);
+    }
+
+    mfem::Vector              displacement_start(displacement_);
+    std::vector<mfem::Vector> previous_parameters_start;
+    for (auto& parameter : parameters_) {
+      previous_parameters_start.emplace_back(*parameter.previous_state);
+    }
+
+    while (end_time - time_ > 1.0e-12 * dt) {
+      const double time_start = time_;
+      const double requested  = std::min(next_dt_, end_time - time_start);
+      double       step       = requested;
+
+      for (int rejections = 0;; rejections++) {
+        quasiStaticSolve(step);
+
+        if (nonlin_solver_->nonlinearSolver().GetConverged()) {
+          break;
+        }
+
+        SLIC_ERROR_ROOT_IF(rejections >= adaptive_options_.max_rejections,
+                           axom::fmt::format("Quasi-static solve at time {0} failed to converge after {1} timestep "
+                                             "cutbacks",
+                                             time_start, rejections));
+
+        // undo the failed attempt, and try again with a smaller step
+        time_           = time_start;
+        ode_time_point_ = time_start;
+        displacement_   = displacement_start;
+        for (std::size_t i = 0; i < parameters_.size(); i++) {
+          *parameters_[i].previous_state = previous_parameters_start[i];
+        }
+
+        step *= adaptive_options_.min_scale;
+        cutbacks_ += 1;
+
+        SLIC_ERROR_ROOT_IF(step < adaptive_options_.min_dt,
+                           axom::fmt::format("Quasi-static solve at time {0} requires a timestep ({1}) smaller than "
+                                             "the minimum allowed ({2})",
+                                             time_start, step, adaptive_options_.min_dt));
+
+        SLIC_INFO_ROOT(axom::fmt::format("Nonlinear solve did not converge, retrying with dt = {0}", step));
+      }
+
+      const int iterations = nonlin_solver_->nonlinearSolver().GetNumIterations();
+      newton_iterations_ += iterations;
+
+      if (step < requested) {
+        // don't try the step size that just failed again right away
+        next_dt_ = step;
+      } else if (iterations <= adaptive_options_.easy_newton_iterations && requested == next_dt_) {
+        next_dt_ = std::min(step * adaptive_options_.max_scale, adaptive_options_.max_dt);
+      }
+
+      finalizeTimestep(step);
+      substeps_ += 1;
+
+      displacement_start = displacement_;
+      for (std::size_t i = 0; i < parameters_.size(); i++) {
+        previous_parameters_start[i] = *parameters_[i].previous_state;
+      }
+    }
+  }
+
   /**
    * @brief Calculate a list of constrained dofs in the true displacement vector from a function that
    * returns true if a physical coordinate is in the constrained set
@@ -1708,8 +2239,7 @@ protected:
     // Update the linearized Jacobian matrix
     auto [r, drdu] = (*residual_)(ode_time_point_, shape_displacement_, differentiate_wrt(displacement_), acceleration_,
                                   *parameters_[parameter_indices].state...);
-    J_             = assemble(drdu);
-    J_e_           = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+    mfem::Operator& jacobian = linearSolverJacobian(drdu);
 
     du_ = 0.0;
     for (auto& bc : bcs_.essentials()) {
@@ -1723,7 +2253,13 @@ protected:
     }
 
     dr_ = 0.0;
-    mfem::EliminateBC(*J_, *J_e_, constrained_dofs, du_, dr_);
+    if (matrix_free_jacobian_) {
+      // du_ vanishes away from the essential dofs, so this is the action of the eliminated columns
+      drdu.Mult(du_, dr_);
+      dr_.Neg();
+    } else {
+      mfem::EliminateBC(*J_, *J_e_, constrained_dofs, du_, dr_);
+    }
 
     // Update the initial guess for changes in the parameters if this is not the first solve
     for (std::size_t parameter_index = 0; parameter_index < parameters_.size(); ++parameter_index) {
@@ -1752,7 +2288,7 @@ protected:
 
     auto& lin_solver = nonlin_solver_->linearSolver();
 
-    lin_solver.SetOperator(*J_);
+    lin_solver.SetOperator(jacobian);
 
     lin_solver.Mult(dr_, du_);
     displacement_ += du_;
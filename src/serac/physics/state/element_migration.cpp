@@ -0,0 +1,107 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/physics/state/element_migration.hpp"
+
+#include <numeric>
+
+namespace serac {
+
+ElementMigration::ElementMigration(std::vector<int> destinations, const mfem::ParMesh& old_mesh,
+                                   const mfem::ParMesh& new_mesh)
+    : comm_(old_mesh.GetComm()), destinations_(std::move(destinations))
+{
+  MPI_Comm_size(comm_, &num_ranks_);
+  SLIC_ERROR_IF(static_cast<int>(destinations_.size()) != old_mesh.GetNE(),
+                "Every element of the old partition must be assigned to a rank");
+
+  // the send lists are built in a single pass over the old elements
+  send_elements_.resize(static_cast<std::size_t>(num_ranks_));
+  std::array<int, mfem::Geometry::NUM_GEOMETRIES> geom_index{};
+  for (int e = 0; e < old_mesh.GetNE(); e++) {
+    auto geom = old_mesh.GetElementGeometry(e);
+    old_geometries_.push_back(geom);
+    old_geometry_indices_.push_back(geom_index[geom]++);
+    send_elements_[static_cast<std::size_t>(destinations_[static_cast<std::size_t>(e)])].push_back(e);
+  }
+
+  std::vector<int> send_counts(static_cast<std::size_t>(num_ranks_));
+  for (std::size_t r = 0; r < send_counts.size(); r++) {
+    send_counts[r] = static_cast<int>(send_elements_[r].size());
+  }
+  recv_elements_.resize(static_cast<std::size_t>(num_ranks_));
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_elements_.data(), 1, MPI_INT, comm_);
+
+  SLIC_ERROR_IF(std::accumulate(recv_elements_.begin(), recv_elements_.end(), 0) != new_mesh.GetNE(),
+                "The elements sent to this rank don't match the elements of its new partition");
+
+  for (int e = 0; e < new_mesh.GetNE(); e++) {
+    new_geometries_.push_back(new_mesh.GetElementGeometry(e));
+  }
+}
+
+std::vector<int> ElementMigration::exclusiveScan(const std::vector<int>& sizes)
+{
+  std::vector<int> offsets(sizes.size() + 1, 0);
+  std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+  return offsets;
+}
+
+void ElementMigration::migrate(const FiniteElementState& old_state, FiniteElementState& new_state) const
+{
+  // the values of the dofs of each element, in the element's own dof order, are the same on both partitions
+  const mfem::ParGridFunction&       old_field = old_state.gridFunction();
+  const mfem::ParFiniteElementSpace& old_space = old_state.space();
+  mfem::ParFiniteElementSpace&       new_space = new_state.space();
+
+  auto value = [](const mfem::GridFunction& field, int vdof) { return (vdof >= 0) ? field(vdof) : -field(-1 - vdof); };
+
+  mfem::Array<int>    vdofs;
+  std::vector<double> send_buffer;
+  std::vector<int>    send_counts(static_cast<std::size_t>(num_ranks_), 0);
+  for (std::size_t r = 0; r < send_elements_.size(); r++) {
+    for (int e : send_elements_[r]) {
+      old_space.GetElementVDofs(e, vdofs);
+      for (int vdof : vdofs) {
+        send_buffer.push_back(value(old_field, vdof));
+      }
+      send_counts[r] += vdofs.Size();
+    }
+  }
+
+  std::vector<int> recv_counts(static_cast<std::size_t>(num_ranks_), 0);
+  for (int e = 0, r = 0; r < num_ranks_; r++) {
+    for (int i = 0; i < recv_elements_[static_cast<std::size_t>(r)]; i++, e++) {
+      new_space.GetElementVDofs(e, vdofs);
+      recv_counts[static_cast<std::size_t>(r)] += vdofs.Size();
+    }
+  }
+
+  std::vector<int>    send_offsets = exclusiveScan(send_counts);
+  std::vector<int>    recv_offsets = exclusiveScan(recv_counts);
+  std::vector<double> recv_buffer(static_cast<std::size_t>(recv_offsets.back()));
+  MPI_Alltoallv(send_buffer.data(), send_counts.data(), send_offsets.data(), MPI_DOUBLE, recv_buffer.data(),
+                recv_counts.data(), recv_offsets.data(), MPI_DOUBLE, comm_);
+
+  // dofs shared by several elements receive the same value from each of them
+  mfem::ParGridFunction new_field(&new_space);
+  std::size_t           k = 0;
+  for (int e = 0; e < new_space.GetNE(); e++) {
+    new_space.GetElementVDofs(e, vdofs);
+    for (int vdof : vdofs) {
+      double received = recv_buffer[k++];
+      if (vdof >= 0) {
+        new_field(vdof) = received;
+      } else {
+        new_field(-1 - vdof) = -received;
+      }
+    }
+  }
+
+  new_state.setFromGridFunction(new_field);
+}
+
+}  // namespace serac
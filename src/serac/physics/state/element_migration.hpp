@@ -0,0 +1,187 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file element_migration.hpp
+ *
+ * @brief This file contains the declaration of the ElementMigration class, which moves
+ * data from an old partition of a mesh to a new one
+ */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include "mpi.h"
+#include "mfem.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+#include "serac/numerics/functional/quadrature_data.hpp"
+#include "serac/physics/state/finite_element_state.hpp"
+
+namespace serac {
+
+/**
+ * @brief Describes where each element went when a mesh was repartitioned, and moves the
+ * data associated with those elements to their new owners
+ *
+ * Objects of this type are returned by `StateManager::rebalance`. The data of the elements that
+ * change owner is sent directly from their old owners to their new owners, without ever
+ * gathering it on a single rank.
+ */
+class ElementMigration {
+public:
+  /**
+   * @brief Record the element migration between two partitions of the same mesh
+   *
+   * The new partition must number the elements it receives from each rank in their old order, and order
+   * the elements from lower ranks first (as mfem::ParMesh does for the elements of a serial mesh that is
+   * ordered by the old owning rank, like the one returned by `old_mesh.GetSerialMesh()`).
+   *
+   * @param destinations The new owning rank of each element of this rank's old partition
+   * @param old_mesh The previous partition of the mesh
+   * @param new_mesh The new partition of the mesh
+   *
+   * @note This is a collective operation
+   */
+  ElementMigration(std::vector<int> destinations, const mfem::ParMesh& old_mesh, const mfem::ParMesh& new_mesh);
+
+  /**
+   * @brief Copy the values of a field on the old partition to the same field on the new partition
+   *
+   * @param old_state The field defined on the old partition
+   * @param new_state The field (with the same function space) defined on the new partition
+   *
+   * @note This is a collective operation
+   */
+  void migrate(const FiniteElementState& old_state, FiniteElementState& new_state) const;
+
+  /**
+   * @brief Move the quadrature point data of each element to the element's new owner
+   *
+   * @tparam T The type stored at each quadrature point, it must be trivially copyable
+   * @param qdata Quadrature data defined on every element of the old partition (e.g. created by
+   * `createQuadratureDataBuffer`). On return it holds the data of every element of the new partition.
+   *
+   * @note This is a collective operation
+   */
+  template <typename T>
+  void migrate(QuadratureData<T>& qdata) const
+  {
+    if constexpr (std::is_same_v<T, Nothing> || std::is_same_v<T, Empty>) {
+      // nothing is stored, so there is nothing to move
+      return;
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable quadrature data can be migrated");
+
+      // ranks that have no elements of a given geometry don't know how many quadrature points it has
+      std::array<int, mfem::Geometry::NUM_GEOMETRIES> qpts_per_element{};
+      for (auto& [geom, values] : qdata.data) {
+        qpts_per_element[geom] = static_cast<int>(values.shape()[1]);
+      }
+      MPI_Allreduce(MPI_IN_PLACE, qpts_per_element.data(), mfem::Geometry::NUM_GEOMETRIES, MPI_INT, MPI_MAX, comm_);
+
+      auto element_bytes = [&](mfem::Geometry::Type geom) {
+        return static_cast<int>(sizeof(T)) * qpts_per_element[geom];
+      };
+
+      // pack the data of the elements being sent to each rank, in the order of the send lists
+      std::vector<int> send_bytes(static_cast<std::size_t>(num_ranks_), 0);
+      std::vector<int> recv_bytes(static_cast<std::size_t>(num_ranks_), 0);
+      for (std::size_t r = 0; r < send_bytes.size(); r++) {
+        for (int e : send_elements_[r]) {
+          send_bytes[r] += element_bytes(old_geometries_[static_cast<std::size_t>(e)]);
+        }
+      }
+      for (std::size_t e = 0, r = 0; r < recv_bytes.size(); r++) {
+        for (int i = 0; i < recv_elements_[r]; i++, e++) {
+          recv_bytes[r] += element_bytes(new_geometries_[e]);
+        }
+      }
+
+      std::vector<int> send_offsets = exclusiveScan(send_bytes);
+      std::vector<int> recv_offsets = exclusiveScan(recv_bytes);
+
+      std::vector<char> send_buffer(static_cast<std::size_t>(send_offsets.back()));
+      char*             packed = send_buffer.data();
+      for (auto& elements : send_elements_) {
+        for (int e : elements) {
+          auto geom = old_geometries_[static_cast<std::size_t>(e)];
+          auto i    = old_geometry_indices_[static_cast<std::size_t>(e)];
+          std::memcpy(packed, &qdata.data.at(geom)(i, 0), static_cast<std::size_t>(element_bytes(geom)));
+          packed += element_bytes(geom);
+        }
+      }
+
+      std::vector<char> recv_buffer(static_cast<std::size_t>(recv_offsets.back()));
+      MPI_Alltoallv(send_buffer.data(), send_bytes.data(), send_offsets.data(), MPI_CHAR, recv_buffer.data(),
+                    recv_bytes.data(), recv_offsets.data(), MPI_CHAR, comm_);
+
+      std::array<uint32_t, mfem::Geometry::NUM_GEOMETRIES> new_elements{};
+      for (auto geom : new_geometries_) {
+        new_elements[geom]++;
+      }
+
+      std::map<mfem::Geometry::Type, axom::Array<T, 2> > new_data;
+      for (int g = 0; g < mfem::Geometry::NUM_GEOMETRIES; g++) {
+        auto geom = static_cast<mfem::Geometry::Type>(g);
+        if (new_elements[geom] > 0) {
+          new_data[geom] = axom::Array<T, 2>(new_elements[geom], static_cast<uint32_t>(qpts_per_element[geom]));
+        }
+      }
+
+      // the received data is already in the order of the new elements
+      std::array<int, mfem::Geometry::NUM_GEOMETRIES> geom_index{};
+      const char*                                     values = recv_buffer.data();
+      for (auto geom : new_geometries_) {
+        std::memcpy(&new_data[geom](geom_index[geom]++, 0), values, static_cast<std::size_t>(element_bytes(geom)));
+        values += element_bytes(geom);
+      }
+
+      qdata.data = std::move(new_data);
+      qdata.updateMemoryRecord();
+    }
+  }
+
+  /// @brief The new owning rank of each element of this rank's old partition
+  const std::vector<int>& destinations() const { return destinations_; }
+
+private:
+  /**
+   * @brief The offsets of consecutive blocks of the given sizes, with the total size as the last entry
+   */
+  static std::vector<int> exclusiveScan(const std::vector<int>& sizes);
+
+  /// @brief The communicator of the old and new partitions
+  MPI_Comm comm_;
+
+  /// @brief The number of ranks in the communicator
+  int num_ranks_;
+
+  /// @brief The new owning rank of each element on this rank's old partition
+  std::vector<int> destinations_;
+
+  /// @brief The old elements sent to each rank, in increasing order
+  std::vector<std::vector<int> > send_elements_;
+
+  /// @brief The number of new elements received from each rank
+  std::vector<int> recv_elements_;
+
+  /// @brief The geometry of each element on this rank's old partition
+  std::vector<mfem::Geometry::Type> old_geometries_;
+
+  /// @brief The index of each element on this rank's old partition among the elements of the same geometry
+  std::vector<int> old_geometry_indices_;
+
+  /// @brief The geometry of each element on this rank's new partition
+  std::vector<mfem::Geometry::Type> new_geometries_;
+};
+
+}  // namespace serac
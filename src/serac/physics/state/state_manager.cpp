@@ -6,8 +6,13 @@
 
 #include "serac/physics/state/state_manager.hpp"
 
+#include <numeric>
+#include <sstream>
+
 #include "axom/core.hpp"
 
+#include "serac/mesh/mesh_utils_base.hpp"
+
 namespace serac {
 
 // Initialize StateManager's static members - these will be fully initialized in StateManager::initialize
@@ -18,6 +23,7 @@ axom::sidre::DataStore*                                               StateManag
 std::string                                                           StateManager::output_dir_ = "";
 std::unordered_map<std::string, mfem::ParGridFunction*>               StateManager::named_states_;
 std::unordered_map<std::string, mfem::ParGridFunction*>               StateManager::named_duals_;
+std::unordered_map<std::string, StateManager::RetiredDataCollection>   StateManager::retired_datacolls_;
 
 double StateManager::newDataCollection(const std::string& name, const std::optional<int> cycle_to_load)
 {
@@ -270,6 +276,111 @@ mfem::ParMesh& StateManager::setMesh(std::unique_ptr<mfem::ParMesh> pmesh, const
   return new_pmesh;
 }
 
+void StateManager::retireDataCollection(const std::string& mesh_tag)
+{
+  auto&       old_mesh  = mesh(mesh_tag);
+  std::string coll_name = mesh_tag + "_datacoll";
+
+  // release the mesh retired by a previous rebalance
+  if (retired_datacolls_.erase(mesh_tag) > 0) {
+    ds_->getRoot()->destroyGroup(coll_name + "_retired");
+    ds_->getRoot()->destroyGroup(coll_name + "_retired_global");
+  }
+
+  // move the sidre groups out of the way of the new datacollection's groups
+  ds_->getRoot()->getGroup(coll_name)->rename(coll_name + "_retired");
+  ds_->getRoot()->getGroup(coll_name + "_global")->rename(coll_name + "_retired_global");
+
+  // the fields on the old mesh can no longer be updated or saved
+  for (auto* fields : {&named_states_, &named_duals_}) {
+    for (auto it = fields->begin(); it != fields->end();) {
+      if (it->second->ParFESpace()->GetParMesh() == &old_mesh) {
+        it = fields->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  retired_datacolls_[mesh_tag] = {datacolls_.extract(mesh_tag), std::move(shape_displacements_[mesh_tag])};
+  shape_displacements_.erase(mesh_tag);
+}
+
+ElementMigration StateManager::rebalance(const std::string& mesh_tag, const mfem::Vector& element_costs)
+{
+  SLIC_ERROR_ROOT_IF(!ds_, "Serac's data store was not initialized - call StateManager::initialize first");
+  auto& old_mesh = mesh(mesh_tag);
+  SLIC_ERROR_ROOT_IF(element_costs.Size() != old_mesh.GetNE(),
+                     axom::fmt::format("Expected a cost for each of the {} local elements, got {}", old_mesh.GetNE(),
+                                       element_costs.Size()));
+
+  MPI_Comm comm      = old_mesh.GetComm();
+  int      rank      = old_mesh.GetMyRank();
+  int      num_ranks = old_mesh.GetNRanks();
+
+  // gather the mesh and the costs on the root, both ordered by rank
+  mfem::Mesh gathered = old_mesh.GetSerialMesh(0);
+
+  int              num_elements = old_mesh.GetNE();
+  std::vector<int> counts(static_cast<std::size_t>(num_ranks));
+  std::vector<int> offsets(static_cast<std::size_t>(num_ranks) + 1, 0);
+  MPI_Allgather(&num_elements, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+  std::partial_sum(counts.begin(), counts.end(), offsets.begin() + 1);
+
+  mfem::Vector costs(rank == 0 ? offsets.back() : 0);
+  MPI_Gatherv(element_costs.GetData(), num_elements, MPI_DOUBLE, costs.GetData(), counts.data(), offsets.data(),
+              MPI_DOUBLE, 0, comm);
+
+  // the root partitions the mesh, and sends each rank only its own part of the new mesh and the new
+  // owners of its old elements. mfem can only partition a conforming mesh in serial, so the whole mesh
+  // is gathered on the root, but never stored on the other ranks.
+  std::vector<int> partition;
+  std::string      parts;
+  std::vector<int> part_lengths(static_cast<std::size_t>(num_ranks), 0);
+  std::vector<int> part_offsets(static_cast<std::size_t>(num_ranks) + 1, 0);
+  if (rank == 0) {
+    partition = mesh::weightedPartition(gathered, costs, num_ranks);
+
+    // each part lists its elements in order of increasing (old) global element number
+    mfem::MeshPartitioner partitioner(gathered, num_ranks, partition.data());
+    mfem::MeshPart        part;
+    std::ostringstream    output;
+    output.precision(16);
+    for (int r = 0; r < num_ranks; r++) {
+      partitioner.ExtractPart(r, part);
+      part.Print(output);
+      part_offsets[static_cast<std::size_t>(r) + 1] = static_cast<int>(output.tellp());
+      part_lengths[static_cast<std::size_t>(r)] =
+          part_offsets[static_cast<std::size_t>(r) + 1] - part_offsets[static_cast<std::size_t>(r)];
+    }
+    parts = output.str();
+  }
+
+  int length = 0;
+  MPI_Scatter(part_lengths.data(), 1, MPI_INT, &length, 1, MPI_INT, 0, comm);
+  std::string local_part(static_cast<std::size_t>(length), '\0');
+  MPI_Scatterv(parts.data(), part_lengths.data(), part_offsets.data(), MPI_CHAR, local_part.data(), length, MPI_CHAR,
+               0, comm);
+
+  std::vector<int> destinations(static_cast<std::size_t>(num_elements));
+  MPI_Scatterv(partition.data(), counts.data(), offsets.data(), MPI_INT, destinations.data(), num_elements, MPI_INT,
+               0, comm);
+
+  std::istringstream input(local_part);
+  auto               new_mesh = std::make_unique<mfem::ParMesh>(comm, input);
+  new_mesh->EnsureNodes();
+  new_mesh->ExchangeFaceNbrData();
+
+  retireDataCollection(mesh_tag);
+  auto& rebalanced_mesh = setMesh(std::move(new_mesh), mesh_tag);
+
+  const auto&      retired = retired_datacolls_.at(mesh_tag);
+  ElementMigration migration(std::move(destinations), old_mesh, rebalanced_mesh);
+  migration.migrate(*retired.shape_displacement, *shape_displacements_.at(mesh_tag));
+
+  return migration;
+}
+
 void StateManager::constructShapeFields(const std::string& mesh_tag)
 {
   // Construct the shape displacement field associated with this mesh
@@ -21,6 +21,7 @@
 #include "serac/infrastructure/logger.hpp"
 #include "serac/physics/state/finite_element_state.hpp"
 #include "serac/physics/state/finite_element_dual.hpp"
+#include "serac/physics/state/element_migration.hpp"
 #include "serac/numerics/functional/quadrature_data.hpp"
 
 namespace serac {
@@ -194,6 +195,7 @@ public:
    */
   static void reset()
   {
+    retired_datacolls_.clear();
     named_states_.clear();
     named_duals_.clear();
     shape_displacements_.clear();
@@ -211,6 +213,25 @@ public:
    */
   static mfem::ParMesh& setMesh(std::unique_ptr<mfem::ParMesh> pmesh, const std::string& mesh_tag);
 
+  /**
+   * @brief Repartitions a stored mesh so that every rank receives approximately the same total element cost
+   *
+   * The mesh is gathered on the root rank, repartitioned with `mesh::weightedPartition`, and each rank is sent
+   * its own part of the new mesh. Afterwards @a mesh_tag refers to the new mesh (with a new data collection and
+   * shape displacement field). The shape displacement is migrated automatically, but the other fields on the old mesh are not: physics
+   * modules (and any Functionals) must be reconstructed on the new mesh, and the returned object used to
+   * copy their states and quadrature data to the new partition.
+   *
+   * @param mesh_tag A string that uniquely identifies the mesh
+   * @param element_costs The cost of each local element, e.g. from `SolidMechanics::elementCosts()`
+   * @return A description of the new partition, used to migrate data from the old mesh to the new one
+   *
+   * @note The old mesh (and the fields stored on it) are kept alive until the same mesh is rebalanced again
+   * or the StateManager is reset, so that the old states can be migrated. They are no longer saved.
+   * @note This is a collective operation, and the whole mesh is temporarily stored on the root rank
+   */
+  static ElementMigration rebalance(const std::string& mesh_tag, const mfem::Vector& element_costs);
+
   /**
    * @brief Returns a non-owning reference to mesh held by StateManager
    * @param[in] mesh_tag A string that uniquely identifies the mesh
@@ -298,6 +319,24 @@ private:
    */
   static void constructShapeFields(const std::string& mesh_tag);
 
+  /**
+   * @brief Detach the datacollection (and the fields stored on it) of a mesh that is about to be replaced
+   *
+   * @param mesh_tag The mesh whose datacollection is retired
+   */
+  static void retireDataCollection(const std::string& mesh_tag);
+
+  /// @brief A datacollection replaced by `rebalance`, kept alive so that its fields can be migrated
+  struct RetiredDataCollection {
+    /// @brief The old datacollection, which owns the old mesh
+    std::unordered_map<std::string, axom::sidre::MFEMSidreDataCollection>::node_type datacoll;
+    /// @brief The shape displacement field on the old mesh
+    std::unique_ptr<FiniteElementState> shape_displacement;
+  };
+
+  /// @brief The datacollections retired by `rebalance`, for each mesh ID
+  static std::unordered_map<std::string, RetiredDataCollection> retired_datacolls_;
+
   /**
    * @brief The datacollection instances
    * The object is constructed when the user calls StateManager::initialize.
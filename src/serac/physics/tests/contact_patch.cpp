@@ -6,6 +6,7 @@
 
 #include "serac/physics/solid_mechanics_contact.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
@@ -115,6 +116,89 @@ INSTANTIATE_TEST_SUITE_P(tribol, ContactTest,
                                          std::make_pair(ContactEnforcement::LagrangeMultiplier,
                                                         "lagrange_multiplier")));
 
+/**
+ * @brief Solve the patch test with Lagrange multiplier contact, on the mesh refined @a refinements times
+ *
+ * @return The displacement, and the average number of iterations of the linear solves
+ */
+std::pair<mfem::Vector, double> lagrangeMultiplierPatch(int refinements, const LinearSolverOptions& linear_options,
+                                                        const std::string& name)
+{
+  constexpr int p   = 1;
+  constexpr int dim = 3;
+
+  axom::sidre::DataStore datastore;
+  StateManager::initialize(datastore, name + "_data");
+
+  std::string filename = SERAC_REPO_DIR "/data/meshes/twohex_for_contact.mesh";
+  StateManager::setMesh(mesh::refineAndDistribute(buildMeshFromFile(filename), refinements, 0), "patch_mesh");
+
+  NonlinearSolverOptions nonlinear_options{.nonlin_solver  = NonlinearSolver::Newton,
+                                           .relative_tol   = 1.0e-10,
+                                           .absolute_tol   = 1.0e-12,
+                                           .max_iterations = 20,
+                                           .print_level    = 1};
+
+  ContactOptions contact_options{.method      = ContactMethod::SingleMortar,
+                                 .enforcement = ContactEnforcement::LagrangeMultiplier,
+                                 .type        = ContactType::Frictionless,
+                                 .penalty     = 1.0e4};
+
+  SolidMechanicsContact<p, dim> solid_solver(nonlinear_options, linear_options,
+                                             solid_mechanics::default_quasistatic_options, GeometricNonlinearities::On,
+                                             name, "patch_mesh");
+
+  solid_mechanics::NeoHookean mat{1.0, 10.0, 0.25};
+  solid_solver.setMaterial(mat);
+
+  auto zero_disp_bc    = [](const mfem::Vector&) { return 0.0; };
+  auto nonzero_disp_bc = [](const mfem::Vector&) { return -0.01; };
+  solid_solver.setDisplacementBCs({1}, zero_disp_bc, 0);
+  solid_solver.setDisplacementBCs({2}, zero_disp_bc, 1);
+  solid_solver.setDisplacementBCs({3}, zero_disp_bc, 2);
+  solid_solver.setDisplacementBCs({6}, nonzero_disp_bc, 2);
+
+  solid_solver.addContactInteraction(0, {4}, {5}, contact_options);
+  solid_solver.completeSetup();
+  solid_solver.advanceTimestep(1.0);
+
+  auto diagnostics = solid_solver.solverDiagnostics();
+  return {mfem::Vector(solid_solver.displacement()),
+          diagnostics["linear_iterations"] / std::max(diagnostics["linear_solves"], 1.0)};
+}
+
+TEST(ContactTest, BlockSchurPreconditioner)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+#ifndef MFEM_USE_STRUMPACK
+  SLIC_INFO_ROOT("Contact requires MFEM built with strumpack.");
+  return;
+#endif
+
+  LinearSolverOptions direct_options{.linear_solver = LinearSolver::Strumpack, .print_level = 0};
+  LinearSolverOptions block_schur_options{.linear_solver  = LinearSolver::GMRES,
+                                          .preconditioner = Preconditioner::BlockSchur,
+                                          .relative_tol   = 1.0e-12,
+                                          .absolute_tol   = 1.0e-16,
+                                          .max_iterations = 500,
+                                          .print_level    = 0};
+
+  mfem::Vector direct = lagrangeMultiplierPatch(2, direct_options, "contact_patch_direct").first;
+
+  auto [iterative, coarse_iterations] = lagrangeMultiplierPatch(2, block_schur_options, "contact_patch_schur");
+  auto [refined, refined_iterations]  = lagrangeMultiplierPatch(3, block_schur_options, "contact_patch_refined");
+
+  // GMRES with the block Schur complement preconditioner converges to the solution of the direct solver
+  mfem::Vector difference(iterative);
+  difference -= direct;
+  EXPECT_LT(mfem::ParNormlp(difference, 2, MPI_COMM_WORLD), 1.0e-8 * mfem::ParNormlp(direct, 2, MPI_COMM_WORLD));
+
+  // and its number of iterations stays bounded as the mesh is refined
+  EXPECT_GT(coarse_iterations, 0.0);
+  EXPECT_LT(refined_iterations, 2.0 * coarse_iterations);
+}
+
 }  // namespace serac
 
 int main(int argc, char* argv[])
@@ -0,0 +1,215 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/physics/state/finite_element_state.hpp"
+#include "serac/physics/state/state_manager.hpp"
+
+namespace serac {
+
+// an element cost that is much larger on one side of the mesh, so a uniform partition is unbalanced
+double cost(mfem::ParMesh& mesh, int e)
+{
+  mfem::Vector centroid;
+  mesh.GetElementCenter(e, centroid);
+  return (centroid[0] < 0.25) ? 10.0 : 1.0;
+}
+
+TEST(Rebalance, MeasuredElementCosts)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  auto pmesh = mesh::refineAndDistribute(buildRectangleMesh(8, 8), 0);
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fespace(pmesh.get(), &fec);
+
+  Functional<H1<p>(H1<p>)> residual(&fespace, {&fespace});
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto /*x*/, auto temperature) {
+        auto [u, du_dx] = temperature;
+        return serac::tuple{u, du_dx};
+      },
+      *pmesh);
+
+  mfem::Vector U(fespace.TrueVSize());
+  U = 1.0;
+
+  residual.enableElementCosts();
+  residual(0.0, U);
+  residual(0.0, differentiate_wrt(U));
+
+  mfem::Vector costs = residual.elementCosts();
+  ASSERT_EQ(costs.Size(), pmesh->GetNE());
+  for (int e = 0; e < costs.Size(); e++) {
+    EXPECT_GT(costs[e], 0.0);
+  }
+
+  // re-enabling the measurement starts over
+  residual.enableElementCosts();
+  EXPECT_EQ(residual.elementCosts().Normlinf(), 0.0);
+}
+
+TEST(Rebalance, MeasuredBoundaryElementCosts)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  auto pmesh = mesh::refineAndDistribute(buildRectangleMesh(8, 8), 0);
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fespace(pmesh.get(), &fec);
+
+  Functional<H1<p>(H1<p>)> residual(&fespace, {&fespace});
+  residual.AddBoundaryIntegral(
+      Dimension<dim - 1>{}, DependsOn<0>{},
+      [](double /*t*/, auto /*x*/, auto temperature) { return get<0>(temperature); }, *pmesh);
+
+  mfem::Vector U(fespace.TrueVSize());
+  U = 1.0;
+
+  residual.enableElementCosts();
+  residual(0.0, U);
+
+  // the cost of each boundary element is attributed to the element it bounds
+  std::vector<bool> on_boundary(std::size_t(pmesh->GetNE()), false);
+  for (int f = 0; f < pmesh->GetNumFaces(); f++) {
+    auto info = pmesh->GetFaceInformation(f);
+    if (info.IsBoundary()) {
+      on_boundary[std::size_t(info.element[0].index)] = true;
+    }
+  }
+
+  mfem::Vector costs = residual.elementCosts();
+  ASSERT_EQ(costs.Size(), pmesh->GetNE());
+  for (int e = 0; e < costs.Size(); e++) {
+    if (on_boundary[std::size_t(e)]) {
+      EXPECT_GT(costs[e], 0.0);
+    } else {
+      EXPECT_EQ(costs[e], 0.0);
+    }
+  }
+}
+
+TEST(Rebalance, MigratesStatesAndQuadratureData)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  axom::sidre::DataStore datastore;
+  StateManager::initialize(datastore, "rebalance");
+
+  std::string mesh_tag{"mesh"};
+  auto&       old_mesh = StateManager::setMesh(mesh::refineAndDistribute(buildRectangleMesh(16, 16), 0), mesh_tag);
+
+  mfem::FunctionCoefficient linear([](const mfem::Vector& x) { return x[0] + 2.0 * x[1]; });
+
+  FiniteElementState old_state(old_mesh, H1<p>{}, "temperature");
+  old_state.project(linear);
+
+  mfem::VectorFunctionCoefficient quadratic(dim, [](const mfem::Vector& x, mfem::Vector& u) {
+    u[0] = x[0] * x[1];
+    u[1] = x[1] * x[1] - x[0];
+  });
+
+  FiniteElementState old_displacement(old_mesh, H1<2, dim>{}, "displacement");
+  old_displacement.project(quadratic);
+
+  // store the centroid of each element at its quadrature points
+  using geom_array_t                       = QuadratureData<double>::geom_array_t;
+  geom_array_t elements                    = {};
+  geom_array_t qpts_per_element            = {};
+  elements[mfem::Geometry::SQUARE]         = uint32_t(old_mesh.GetNE());
+  qpts_per_element[mfem::Geometry::SQUARE] = 4;
+  QuadratureData<double> qdata(elements, qpts_per_element);
+
+  mfem::Vector costs(old_mesh.GetNE());
+  for (int e = 0; e < old_mesh.GetNE(); e++) {
+    mfem::Vector centroid;
+    old_mesh.GetElementCenter(e, centroid);
+    for (int q = 0; q < 4; q++) {
+      qdata[mfem::Geometry::SQUARE](e, q) = centroid[0] + 100.0 * centroid[1];
+    }
+    costs[e] = cost(old_mesh, e);
+  }
+
+  auto  migration = StateManager::rebalance(mesh_tag, costs);
+  auto& new_mesh  = StateManager::mesh(mesh_tag);
+  EXPECT_NE(&new_mesh, &old_mesh);
+
+  // the total cost on each rank should now be (nearly) the same
+  double local_cost = 0.0;
+  for (int e = 0; e < new_mesh.GetNE(); e++) {
+    local_cost += cost(new_mesh, e);
+  }
+  double max_cost = local_cost;
+  double min_cost = local_cost;
+  MPI_Allreduce(MPI_IN_PLACE, &max_cost, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &min_cost, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  EXPECT_LT(max_cost, 1.1 * min_cost);
+
+  // fields are copied to the new partition exactly
+  FiniteElementState new_state(new_mesh, H1<p>{}, "temperature");
+  migration.migrate(old_state, new_state);
+
+  FiniteElementState expected(new_mesh, H1<p>{}, "expected");
+  expected.project(linear);
+  new_state -= expected;
+  EXPECT_LT(norm(new_state), 1.0e-12);
+
+  // including the edge and interior dofs of higher order, vector-valued fields
+  FiniteElementState new_displacement(new_mesh, H1<2, dim>{}, "displacement");
+  migration.migrate(old_displacement, new_displacement);
+
+  FiniteElementState expected_displacement(new_mesh, H1<2, dim>{}, "expected_displacement");
+  expected_displacement.project(quadratic);
+  new_displacement -= expected_displacement;
+  EXPECT_LT(norm(new_displacement), 1.0e-12);
+
+  // and so is the quadrature data of each element
+  migration.migrate(qdata);
+  ASSERT_EQ(qdata.data.at(mfem::Geometry::SQUARE).shape()[0], std::size_t(new_mesh.GetNE()));
+  for (int e = 0; e < new_mesh.GetNE(); e++) {
+    mfem::Vector centroid;
+    new_mesh.GetElementCenter(e, centroid);
+    for (int q = 0; q < 4; q++) {
+      EXPECT_NEAR(qdata[mfem::Geometry::SQUARE](e, q), centroid[0] + 100.0 * centroid[1], 1.0e-12);
+    }
+  }
+
+  // the new mesh has its own (zeroed) shape displacement field
+  EXPECT_EQ(&StateManager::shapeDisplacement(mesh_tag).mesh(), &new_mesh);
+  EXPECT_EQ(norm(StateManager::shapeDisplacement(mesh_tag)), 0.0);
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
@@ -251,6 +251,7 @@ private:
  *
  * @param exact_solution Exact solution of problem
  * @param bc Specifier for boundary condition type to test
+ * @param timestepping The time integration scheme to use
  * @return double L2 norm (continuous) of error in computed solution
  * *
  * @pre exact_solution must implement operator() that is an MFEM
@@ -263,7 +264,9 @@ private:
  * solid functional that should lead to the exact solution
  */
 template <typename element_type, typename solution_type>
-double solution_error(solution_type exact_solution, PatchBoundaryCondition bc)
+double solution_error(solution_type exact_solution, PatchBoundaryCondition bc,
+                      TimesteppingOptions timestepping = {TimestepMethod::Newmark,
+                                                          DirichletEnforcementMethod::DirectControl})
 {
   MPI_Barrier(MPI_COMM_WORLD);
 
@@ -307,8 +310,7 @@ double solution_error(solution_type exact_solution, PatchBoundaryCondition bc)
   // Construct a functional-based solid mechanics solver
   serac::NonlinearSolverOptions nonlin_opts{.relative_tol = 1.0e-13, .absolute_tol = 1.0e-13};
 
-  SolidMechanics<p, dim> solid(nonlin_opts, serac::solid_mechanics::default_linear_options,
-                               TimesteppingOptions{TimestepMethod::Newmark, DirichletEnforcementMethod::DirectControl},
+  SolidMechanics<p, dim> solid(nonlin_opts, serac::solid_mechanics::default_linear_options, timestepping,
                                GeometricNonlinearities::On, "solid_dynamics", mesh_tag);
 
   solid_mechanics::NeoHookean mat{.density = 1.0, .K = 1.0, .G = 1.0};
@@ -367,6 +369,23 @@ double constant_acceleration_test(PatchBoundaryCondition bc)
   return solution_error<element_type>(ConstantAccelerationSolution<dim>(), bc);
 }
 
+const TimesteppingOptions explicit_timestepping{TimestepMethod::CentralDifference,
+                                                DirichletEnforcementMethod::DirectControl};
+
+template <typename element_type>
+double explicit_affine_velocity_test(PatchBoundaryCondition bc)
+{
+  constexpr int dim = dimension_of(element_type::geometry);
+  return solution_error<element_type>(AffineSolution<dim>(), bc, explicit_timestepping);
+}
+
+template <typename element_type>
+double explicit_constant_acceleration_test(PatchBoundaryCondition bc)
+{
+  constexpr int dim = dimension_of(element_type::geometry);
+  return solution_error<element_type>(ConstantAccelerationSolution<dim>(), bc, explicit_timestepping);
+}
+
 const double tol = 1e-12;
 
 constexpr int LINEAR    = 1;
@@ -584,6 +603,43 @@ TEST(SolidMechanicsDynamic, ConstantAccelerationHexQ2EssentialAndNaturalBcs)
   EXPECT_LT(error, tol);
 }
 
+//
+// Explicit dynamics (central difference with a lumped mass matrix)
+//
+TEST(SolidMechanicsExplicitDynamic, PatchTestQuadQ1EssentialBcs)
+{
+  using element_type = finite_element<mfem::Geometry::SQUARE, H1<LINEAR> >;
+  double error       = explicit_affine_velocity_test<element_type>(PatchBoundaryCondition::Essential);
+  EXPECT_LT(error, tol);
+}
+
+TEST(SolidMechanicsExplicitDynamic, PatchTestHexQ1EssentialAndNaturalBcs)
+{
+  using element_type = finite_element<mfem::Geometry::CUBE, H1<LINEAR> >;
+  double error       = explicit_affine_velocity_test<element_type>(PatchBoundaryCondition::EssentialAndNatural);
+  EXPECT_LT(error, tol);
+}
+
+TEST(SolidMechanicsExplicitDynamic, ConstantAccelerationQuadQ2EssentialBcs)
+{
+  using element_type = finite_element<mfem::Geometry::SQUARE, H1<QUADRATIC> >;
+  double error       = explicit_constant_acceleration_test<element_type>(PatchBoundaryCondition::Essential);
+  EXPECT_LT(error, tol);
+}
+
+TEST(SolidMechanicsExplicitDynamic, PatchTestQuadQ1CheckpointsOnlyOutputCycles)
+{
+  using element_type = finite_element<mfem::Geometry::SQUARE, H1<LINEAR> >;
+  constexpr int dim  = dimension_of(element_type::geometry);
+
+  // the three steps of the test only checkpoint the last cycle
+  TimesteppingOptions timestepping = explicit_timestepping;
+  timestepping.output_interval     = 3;
+
+  double error = solution_error<element_type>(AffineSolution<dim>(), PatchBoundaryCondition::Essential, timestepping);
+  EXPECT_LT(error, tol);
+}
+
 }  // namespace serac
 
 int main(int argc, char* argv[])
@@ -98,7 +98,184 @@ void functional_solid_test_nonlinear_buckle()
   visit_dc.Save();
 }
 
+// Bend a beam with a large tip displacement, using a Newton solver that is only allowed a handful of iterations.
+// Taking the whole load in one step fails to converge, so the adaptive quasi-static solver has to cut the
+// timestep back. The result should agree with a run that uses many small, fixed steps.
+void functional_solid_test_nonlinear_cutback()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 1;
+  constexpr int dim = 3;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_mechanics_cutback_test");
+
+  std::string filename = SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+  auto        mesh     = mesh::refineAndDistribute(buildMeshFromFile(filename), 0, 0);
+
+  std::string mesh_tag{"mesh"};
+  serac::StateManager::setMesh(std::move(mesh), mesh_tag);
+
+  serac::LinearSolverOptions linear_options{.linear_solver = LinearSolver::SuperLU};
+
+  serac::NonlinearSolverOptions reference_nonlinear_options{.nonlin_solver  = NonlinearSolver::Newton,
+                                                            .relative_tol   = 1.0e-10,
+                                                            .absolute_tol   = 1.0e-12,
+                                                            .max_iterations = 50,
+                                                            .print_level    = 1};
+
+  serac::NonlinearSolverOptions limited_nonlinear_options = reference_nonlinear_options;
+  limited_nonlinear_options.max_iterations                = 4;
+
+  serac::TimesteppingOptions adaptive_options = solid_mechanics::default_quasistatic_options;
+  adaptive_options.adaptive.enabled           = true;
+
+  solid_mechanics::NeoHookean material{.density = 1.0, .K = 10.0, .G = 1.0};
+
+  std::set<int> support           = {1};
+  auto          zero_displacement = [](const mfem::Vector&, mfem::Vector& u) -> void { u = 0.0; };
+
+  std::set<int> tip        = {2};
+  auto          tip_motion = [](const mfem::Vector&, double t, mfem::Vector& u) -> void {
+    u    = 0.0;
+    u[2] = 3.0 * t;
+  };
+
+  SolidMechanics<p, dim> reference(reference_nonlinear_options, linear_options,
+                                   solid_mechanics::default_quasistatic_options, GeometricNonlinearities::On,
+                                   "solid_reference", mesh_tag);
+
+  SolidMechanics<p, dim> adaptive(limited_nonlinear_options, linear_options, adaptive_options,
+                                  GeometricNonlinearities::On, "solid_adaptive", mesh_tag);
+
+  for (auto* solid : {&reference, &adaptive}) {
+    solid->setMaterial(material);
+    solid->setDisplacementBCs(support, zero_displacement);
+    solid->setDisplacementBCs(tip, tip_motion);
+    solid->setDisplacement(zero_displacement);
+    solid->completeSetup();
+  }
+
+  int num_steps = 20;
+  for (int i = 0; i < num_steps; i++) {
+    reference.advanceTimestep(1.0 / num_steps);
+  }
+
+  adaptive.advanceTimestep(1.0);
+
+  auto diagnostics = adaptive.solverDiagnostics();
+  EXPECT_GT(diagnostics["cutbacks"], 0.0);
+  EXPECT_GT(diagnostics["substeps"], 1.0);
+  EXPECT_EQ(static_cast<int>(diagnostics["substeps"]), adaptive.cycle());
+
+  // the solver statistics include the work done in the failed attempts
+  EXPECT_GE(diagnostics["nonlinear_iterations"], diagnostics["newton_iterations"]);
+  EXPECT_GE(diagnostics["nonlinear_solves"], diagnostics["substeps"] + diagnostics["cutbacks"]);
+  EXPECT_GE(diagnostics["jacobian_evaluations"], diagnostics["nonlinear_iterations"]);
+  EXPECT_GT(diagnostics["residual_evaluations"], diagnostics["jacobian_evaluations"]);
+  EXPECT_EQ(diagnostics["linear_solves"], diagnostics["jacobian_evaluations"]);
+  EXPECT_GT(diagnostics["assembly_time"], 0.0);
+  EXPECT_GT(diagnostics["linear_solve_time"], 0.0);
+  EXPECT_GE(diagnostics["nonlinear_solve_time"], diagnostics["assembly_time"] + diagnostics["linear_solve_time"]);
+  EXPECT_NEAR(adaptive.time(), 1.0, 1.0e-12);
+
+  mfem::Vector difference(adaptive.displacement());
+  difference -= reference.displacement();
+  EXPECT_LT(mfem::ParNormlp(difference, 2, MPI_COMM_WORLD) / norm(reference.displacement()), 1.0e-6);
+}
+
+/// @brief the number of elements whose stress was evaluated through CountingNeoHookean::batch
+int batched_stress_evaluations = 0;
+
+/// @brief a Neo-Hookean material that counts its batched stress evaluations
+struct CountingNeoHookean : public solid_mechanics::NeoHookean {
+  /// @brief forward to NeoHookean::batch, counting the evaluation
+  template <typename T, int dim, int n>
+  auto batch(tensor<State, n>& states, const tensor<tensor<T, dim, dim>, n>& du_dX) const
+  {
+    batched_stress_evaluations++;
+    return solid_mechanics::NeoHookean::batch(states, du_dX);
+  }
+};
+
+/// @brief a Neo-Hookean material that can only be evaluated one quadrature point at a time
+struct PointwiseNeoHookean {
+  using State = Empty;  ///< this material has no internal variables
+
+  /// @brief the stress of the Neo-Hookean material
+  template <typename T, int dim>
+  auto operator()(State& state, const tensor<T, dim, dim>& du_dX) const
+  {
+    return solid_mechanics::NeoHookean{density, K, G}(state, du_dX);
+  }
+
+  double density;  ///< mass density
+  double K;        ///< bulk modulus
+  double G;        ///< shear modulus
+};
+
+// Bend a beam with a material that provides a batched stress evaluation, and check that SolidMechanics
+// uses it (through the shape-aware residual), and that it agrees with the pointwise evaluation.
+void functional_solid_test_batched_material()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 2;
+  constexpr int dim = 3;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_mechanics_batched_material_test");
+
+  std::string filename = SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+  auto        mesh     = mesh::refineAndDistribute(buildMeshFromFile(filename), 0, 0);
+
+  std::string mesh_tag{"mesh"};
+  serac::StateManager::setMesh(std::move(mesh), mesh_tag);
+
+  serac::LinearSolverOptions    linear_options{.linear_solver = LinearSolver::SuperLU};
+  serac::NonlinearSolverOptions nonlinear_options{.nonlin_solver  = NonlinearSolver::Newton,
+                                                  .relative_tol   = 1.0e-10,
+                                                  .absolute_tol   = 1.0e-12,
+                                                  .max_iterations = 20};
+
+  SolidMechanics<p, dim> batched(nonlinear_options, linear_options, solid_mechanics::default_quasistatic_options,
+                                 GeometricNonlinearities::On, "solid_batched", mesh_tag);
+  SolidMechanics<p, dim> pointwise(nonlinear_options, linear_options, solid_mechanics::default_quasistatic_options,
+                                   GeometricNonlinearities::On, "solid_pointwise", mesh_tag);
+
+  batched.setMaterial(CountingNeoHookean{{.density = 1.0, .K = 10.0, .G = 1.0}});
+  pointwise.setMaterial(PointwiseNeoHookean{.density = 1.0, .K = 10.0, .G = 1.0});
+
+  auto zero_displacement = [](const mfem::Vector&, mfem::Vector& u) -> void { u = 0.0; };
+  auto tip_motion        = [](const mfem::Vector&, double t, mfem::Vector& u) -> void {
+    u    = 0.0;
+    u[2] = 0.5 * t;
+  };
+
+  for (auto* solid : {&batched, &pointwise}) {
+    solid->setDisplacementBCs({1}, zero_displacement);
+    solid->setDisplacementBCs({2}, tip_motion);
+    solid->setDisplacement(zero_displacement);
+    solid->completeSetup();
+  }
+
+  batched_stress_evaluations = 0;
+  batched.advanceTimestep(1.0);
+  EXPECT_GT(batched_stress_evaluations, 0);
+
+  const int evaluations = batched_stress_evaluations;
+  pointwise.advanceTimestep(1.0);
+  EXPECT_EQ(batched_stress_evaluations, evaluations);
+
+  mfem::Vector difference(batched.displacement());
+  difference -= pointwise.displacement();
+  EXPECT_LT(mfem::ParNormlp(difference, 2, MPI_COMM_WORLD) / norm(pointwise.displacement()), 1.0e-10);
+}
+
 TEST(SolidMechanics, nonlinear_solve) { functional_solid_test_nonlinear_buckle(); }
+TEST(SolidMechanics, NewtonFailureCutback) { functional_solid_test_nonlinear_cutback(); }
+TEST(SolidMechanics, BatchedMaterial) { functional_solid_test_batched_material(); }
 
 int main(int argc, char* argv[])
 {
@@ -103,7 +103,7 @@ void functional_test_static_3D(double expected_norm)
 }
 
 template <int p>
-void functional_test_shrinking_3D(double expected_norm)
+void functional_test_shrinking_3D(double expected_norm, CouplingOptions coupling = {})
 {
   MPI_Barrier(MPI_COMM_WORLD);
 
@@ -156,6 +156,7 @@ void functional_test_shrinking_3D(double expected_norm)
   GreenSaintVenantThermoelasticMaterial::State initial_state{};
   auto                                         qdata = thermal_solid_solver.createQuadratureDataBuffer(initial_state);
   thermal_solid_solver.setMaterial(material, qdata);
+  thermal_solid_solver.setCouplingOptions(coupling);
 
   // Define the function for the initial temperature
   double theta_0                   = 1.0;
@@ -183,6 +184,91 @@ void functional_test_shrinking_3D(double expected_norm)
 
   // Check the final displacement norm
   EXPECT_NEAR(expected_norm, norm(thermal_solid_solver.displacement()), 1.0e-4);
+
+  if (coupling.scheme != CouplingScheme::OneWay) {
+    // the heat conduction doesn't depend on the displacement, so the passes after
+    // the first only tighten the nonlinear solves, and converge quickly
+    EXPECT_GE(thermal_solid_solver.solverDiagnostics()["coupling_iterations"], 2.0);
+    EXPECT_LE(thermal_solid_solver.solverDiagnostics()["coupling_iterations"], 3.0);
+  }
+}
+
+// a thermal contraction with a heat source that cools the beam where it contracts, so the
+// thermal and solid solves have to iterate. Returns the displacement norm and the number of coupling iterations.
+template <int p>
+std::pair<double, double> two_way_coupling_3D(CouplingScheme scheme)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int dim                 = 3;
+  int           serial_refinement   = 1;
+  int           parallel_refinement = 0;
+
+  // Create DataStore
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_functional_two_way_coupling");
+
+  // Construct the appropriate dimension mesh and give it to the data store
+  std::string filename = SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto mesh = mesh::refineAndDistribute(buildMeshFromFile(filename), serial_refinement, parallel_refinement);
+
+  std::string mesh_tag{"mesh"};
+
+  serac::StateManager::setMesh(std::move(mesh), mesh_tag);
+
+  std::set<int> constraint_bdr = {1};
+  std::set<int> temp_bdr       = {1, 2, 3};
+
+  const LinearSolverOptions linear_options = {.linear_solver  = LinearSolver::GMRES,
+                                              .preconditioner = Preconditioner::HypreAMG,
+                                              .relative_tol   = 1.0e-8,
+                                              .absolute_tol   = 1.0e-12,
+                                              .max_iterations = 500,
+                                              .print_level    = 0};
+
+  const NonlinearSolverOptions nonlinear_options = {
+      .relative_tol = 1.0e-8, .absolute_tol = 1.0e-12, .max_iterations = 10, .print_level = 0};
+
+  Thermomechanics<p, dim> thermal_solid_solver(
+      heat_transfer::default_nonlinear_options, heat_transfer::default_linear_options,
+      heat_transfer::default_static_options, nonlinear_options, linear_options,
+      solid_mechanics::default_quasistatic_options, GeometricNonlinearities::On, "thermal_solid_two_way", mesh_tag);
+
+  double                                       rho       = 1.0;
+  double                                       E         = 1.0;
+  double                                       nu        = 0.0;
+  double                                       c         = 1.0;
+  double                                       alpha     = 1.0e-3;
+  double                                       theta_ref = 2.0;
+  double                                       k         = 1.0;
+  GreenSaintVenantThermoelasticMaterial        material{rho, E, nu, c, alpha, theta_ref, k};
+  GreenSaintVenantThermoelasticMaterial::State initial_state{};
+  auto                                         qdata = thermal_solid_solver.createQuadratureDataBuffer(initial_state);
+  thermal_solid_solver.setMaterial(material, qdata);
+  thermal_solid_solver.setCouplingOptions({.scheme = scheme, .relative_tol = 1.0e-8, .max_iterations = 50});
+
+  // the axial displacement is negative where the beam contracts, which then cools it further
+  double gamma = 100.0;
+  thermal_solid_solver.addDisplacementDependentHeatSource(
+      [gamma](auto /* x */, double /* t */, auto /* theta */, auto /* dtheta_dX */, auto displacement) {
+        return gamma * get<0>(displacement)[0];
+      });
+
+  auto one = [](const mfem::Vector&, double) -> double { return 1.0; };
+  thermal_solid_solver.setTemperatureBCs(temp_bdr, one);
+  thermal_solid_solver.setTemperature(one);
+
+  auto zeroVector = [](const mfem::Vector&, mfem::Vector& u) { u = 0.0; };
+  thermal_solid_solver.setDisplacementBCs(constraint_bdr, zeroVector);
+  thermal_solid_solver.setDisplacement(zeroVector);
+
+  thermal_solid_solver.completeSetup();
+
+  thermal_solid_solver.advanceTimestep(1.0);
+
+  return {norm(thermal_solid_solver.displacement()),
+          thermal_solid_solver.solverDiagnostics()["coupling_iterations"]};
 }
 
 // TODO: investigate this failing test
@@ -339,6 +425,37 @@ TEST(Thermomechanics, thermalContraction)
   serac::functional_test_shrinking_3D<p>(std::sqrt(L * L * L / 3.0) * alpha * delta_theta);
 }
 
+TEST(Thermomechanics, thermalContractionAndersonCoupling)
+{
+  constexpr int p           = 2;
+  double        alpha       = 1e-3;
+  double        L           = 8;
+  double        delta_theta = 1.0;
+  serac::functional_test_shrinking_3D<p>(std::sqrt(L * L * L / 3.0) * alpha * delta_theta,
+                                         {.scheme = serac::CouplingScheme::Anderson});
+}
+
+TEST(Thermomechanics, twoWayCouplingAcceleration)
+{
+  constexpr int p = 2;
+
+  auto [picard_norm, picard_iterations]     = serac::two_way_coupling_3D<p>(serac::CouplingScheme::FixedPoint);
+  auto [aitken_norm, aitken_iterations]     = serac::two_way_coupling_3D<p>(serac::CouplingScheme::Aitken);
+  auto [anderson_norm, anderson_iterations] = serac::two_way_coupling_3D<p>(serac::CouplingScheme::Anderson);
+
+  // the coupling matters: a one-way step has a different solution
+  auto [one_way_norm, one_way_iterations] = serac::two_way_coupling_3D<p>(serac::CouplingScheme::OneWay);
+  EXPECT_EQ(one_way_iterations, 1.0);
+  EXPECT_GT(std::abs(one_way_norm - picard_norm), 1.0e-3 * picard_norm);
+
+  // every scheme converges to the same solution, but the accelerated ones need fewer passes
+  EXPECT_NEAR(aitken_norm, picard_norm, 1.0e-6 * picard_norm);
+  EXPECT_NEAR(anderson_norm, picard_norm, 1.0e-6 * picard_norm);
+  EXPECT_GT(picard_iterations, 3.0);
+  EXPECT_LT(aitken_iterations, picard_iterations);
+  EXPECT_LT(anderson_iterations, picard_iterations);
+}
+
 TEST(Thermomechanics, parameterized)
 {
   // this is the small strain solution, which works with a loose enought tolerance
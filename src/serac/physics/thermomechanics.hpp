@@ -14,6 +14,7 @@
 
 #include "mfem.hpp"
 
+#include "serac/numerics/fixed_point_accelerator.hpp"
 #include "serac/physics/base_physics.hpp"
 #include "serac/physics/thermomechanics_input.hpp"
 #include "serac/physics/solid_mechanics.hpp"
@@ -233,6 +234,25 @@ public:
     return solid_.displacement();
   }
 
+  /**
+   * @brief Set how the thermal and solid solves are coupled in each timestep
+   *
+   * By default (CouplingScheme::OneWay), each timestep does one thermal solve with the displacement from the start
+   * of the step, followed by one solid solve with the resulting temperature. The iterated schemes repeat these
+   * staggered solves, relaxing or accelerating the updates of the (temperature, displacement) pair, until neither
+   * field changes by more than the given tolerances. This allows larger timesteps for the same accuracy when the
+   * fields are strongly coupled.
+   *
+   * @param options The coupling options
+   * @note The iterated schemes require a quasi-static solid without adaptive timestepping, and a thermal problem
+   * without adaptive timestepping that does not use the generalized-alpha method
+   */
+  void setCouplingOptions(const CouplingOptions& options)
+  {
+    SLIC_ERROR_ROOT_IF(options.max_iterations < 1, "Thermomechanics coupling requires at least one iteration");
+    coupling_options_ = options;
+  }
+
   /**
    * @brief Advance the timestep
    *
@@ -240,16 +260,40 @@ public:
    */
   void advanceTimestep(double dt) override
   {
-    thermal_.setParameter(0, solid_.displacement());
-    thermal_.advanceTimestep(dt);
+    if (coupling_options_.scheme == CouplingScheme::OneWay) {
+      thermal_.setParameter(0, solid_.displacement());
+      thermal_.advanceTimestep(dt);
 
-    solid_.setParameter(0, thermal_.temperature());
-    solid_.advanceTimestep(dt);
+      solid_.setParameter(0, thermal_.temperature());
+      solid_.advanceTimestep(dt);
+
+      coupling_iterations_ = 1;
+    } else {
+      iteratedTimestep(dt);
+    }
 
     cycle_ += 1;
     time_ += dt;
   }
 
+  /**
+   * @brief Get diagnostic information about the thermal and solid solvers during the most recent timestep
+   *
+   * @return The number of passes through the thermal and solid solves ("coupling_iterations"), and the diagnostics
+   * of the thermal and solid modules, with their names prefixed by "thermal_" and "solid_"
+   */
+  std::map<std::string, double> solverDiagnostics() const override
+  {
+    std::map<std::string, double> diagnostics{{"coupling_iterations", coupling_iterations_}};
+    for (const auto& [name, value] : thermal_.solverDiagnostics()) {
+      diagnostics["thermal_" + name] = value;
+    }
+    for (const auto& [name, value] : solid_.solverDiagnostics()) {
+      diagnostics["solid_" + name] = value;
+    }
+    return diagnostics;
+  }
+
   /**
    * @brief Create a shared ptr to a quadrature data buffer for the given material type
    *
@@ -512,6 +556,22 @@ public:
     thermal_.setSource(source_function);
   }
 
+  /**
+   * @brief Set a thermal source function that depends on the displacement, which couples the thermal solve to the
+   * solid solve
+   *
+   * @tparam HeatSourceType The type of the source function
+   * @param source_function A source function for a displacement-dependent thermal load
+   *
+   * @pre source_function must be a object that can be called with the arguments of addHeatSource(), followed by
+   *    a `tuple{value, derivative}` of the displacement at the quadrature point
+   */
+  template <typename HeatSourceType>
+  void addDisplacementDependentHeatSource(HeatSourceType source_function)
+  {
+    thermal_.setSource(DependsOn<0>{}, source_function);
+  }
+
   /**
    * @brief Get the displacement state
    *
@@ -527,6 +587,101 @@ public:
   const serac::FiniteElementState& temperature() const { return thermal_.temperature(); };
 
 protected:
+  /**
+   * @brief Advance both modules by a timestep, repeating the staggered thermal and solid solves until the temperature
+   * and displacement converge
+   *
+   * The first pass is the one-way staggered step: a thermal solve with the displacement at the start of the
+   * timestep, followed by a solid solve with the resulting temperature. Its result is the first (temperature,
+   * displacement) pair x. Each later pass maps x to the pair G(x) that results from a solid solve with the temperature
+   * of x, followed by a thermal solve with the resulting displacement, and the FixedPointAccelerator computes the
+   * pair x used by the next pass. The displacement of x is the initial guess of the solid solve. As the first pass
+   * is a different map, it isn't part of the accelerator's history, and the temperature and displacement are scaled
+   * separately in its inner products.
+   *
+   * The solid solve comes first in these passes because HeatTransfer::solveTimestep() restarts the thermal solve
+   * from the temperature at the start of the timestep, which would discard the accelerated temperature. The solves
+   * after the first pass reuse the Jacobians of the previous pass, if requested by CouplingOptions::reuse_jacobians.
+   *
+   * @param dt The increment of simulation time to advance the underlying thermomechanical problem
+   */
+  void iteratedTimestep(double dt)
+  {
+    const auto& opts = coupling_options_;
+    MPI_Comm    comm = mesh_.GetComm();
+
+    FiniteElementState temperature(thermal_.temperature());
+    FiniteElementState displacement(solid_.displacement());
+
+    mfem::Array<int> offsets(3);
+    offsets[0] = 0;
+    offsets[1] = temperature.Size();
+    offsets[2] = temperature.Size() + displacement.Size();
+
+    mfem::BlockVector x(offsets);
+    mfem::BlockVector g(offsets);
+    x.GetBlock(0) = temperature;
+    x.GetBlock(1) = displacement;
+
+    // whether a field changed by more than the tolerances over the most recent pass
+    auto changed = [&](int block) {
+      mfem::Vector change(g.GetBlock(block));
+      change -= x.GetBlock(block);
+      const double tolerance =
+          std::max(opts.relative_tol * mfem::ParNormlp(g.GetBlock(block), 2, comm), opts.absolute_tol);
+      return mfem::ParNormlp(change, 2, comm) > tolerance;
+    };
+
+    FixedPointAccelerator accelerator(opts.scheme, opts.anderson_depth, comm);
+    accelerator.setBlocks(offsets);
+
+    bool converged = false;
+    for (coupling_iterations_ = 1;; coupling_iterations_++) {
+      const bool reuse_jacobian = opts.reuse_jacobians && coupling_iterations_ > 1;
+
+      if (coupling_iterations_ == 1) {
+        thermal_.setParameter(0, solid_.displacement());
+        thermal_.solveTimestep(dt);
+
+        solid_.setParameter(0, thermal_.temperature());
+        solid_.solveTimestep(dt);
+      } else {
+        solid_.setParameter(0, temperature);
+        solid_.solveTimestep(dt, reuse_jacobian);
+
+        thermal_.setParameter(0, solid_.displacement());
+        thermal_.solveTimestep(dt, reuse_jacobian);
+      }
+
+      g.GetBlock(0) = thermal_.temperature();
+      g.GetBlock(1) = solid_.displacement();
+
+      // the first pass starts from the previous timestep, so its change says nothing about convergence
+      converged = coupling_iterations_ > 1 && !changed(0) && !changed(1);
+      if (converged || coupling_iterations_ >= opts.max_iterations) {
+        break;
+      }
+
+      if (coupling_iterations_ == 1) {
+        x = g;
+      } else {
+        accelerator.update(x, g);
+      }
+
+      // the accelerated temperature is the parameter of the next solid solve, and the
+      // accelerated displacement its initial guess
+      temperature  = x.GetBlock(0);
+      displacement = x.GetBlock(1);
+      solid_.setDisplacement(displacement);
+    }
+
+    SLIC_WARNING_ROOT_IF(!converged, axom::fmt::format("Thermomechanics coupling did not converge in {} iterations",
+                                                       coupling_iterations_));
+
+    thermal_.completeTimestep();
+    solid_.completeTimestep();
+  }
+
   using displacement_field = H1<order, dim>;  ///< the function space for the displacement field
   using temperature_field  = H1<order>;       ///< the function space for the temperature field
 
@@ -535,6 +690,12 @@ protected:
 
   /// Submodule to compute the mechanics
   SolidMechanics<order, dim, Parameters<temperature_field, parameter_space...>> solid_;
+
+  /// How the thermal and solid solves are coupled in each timestep
+  CouplingOptions coupling_options_;
+
+  /// The number of passes through the thermal and solid solves during the most recent timestep
+  int coupling_iterations_ = 0;
 };
 
 }  // namespace serac